@@ -838,32 +838,33 @@ std::vector<double> ChCollisionModelBullet::GetShapeDimensions(int index) const
 
     auto shape = std::static_pointer_cast<ChCollisionShapeBullet>(m_shapes[index]);
 
+    // Report the dimensions as specified when the shape was added (i.e., without the collision envelope)
+    double env = model_envelope;
+
     std::vector<double> dims;
     switch (m_shapes[index]->GetType()) {
         case ChCollisionShape::Type::SPHERE: {
             auto bt_sphere = static_cast<btSphereShape*>(shape->m_bt_shape);
-            auto radius = (double)bt_sphere->getImplicitShapeDimensions().getX();
+            auto radius = (double)bt_sphere->getRadius() - env;
             dims = {radius};
             break;
         }
         case ChCollisionShape::Type::BOX: {
             auto bt_box = static_cast<btBoxShape*>(shape->m_bt_shape);
-            auto hdims = ChBulletToVect(bt_box->getHalfExtentsWithoutMargin());
-            dims = {hdims.x(), hdims.y(), hdims.z()};
+            auto hdims = ChBulletToVect(bt_box->getHalfExtentsWithMargin());
+            dims = {hdims.x() - env, hdims.y() - env, hdims.z() - env};
             break;
         }
         case ChCollisionShape::Type::ELLIPSOID: {
             auto bt_ell = static_cast<btMultiSphereShape*>(shape->m_bt_shape);
-            auto rx = (double)bt_ell->getSphereRadius(0);
-            auto ry = (double)bt_ell->getSphereRadius(1);
-            auto rz = (double)bt_ell->getSphereRadius(2);
-            dims = {rx, ry, rz};
+            auto radii = ChBulletToVect(bt_ell->getLocalScaling());
+            dims = {radii.x() - env, radii.y() - env, radii.z() - env};
             break;
         }
         case ChCollisionShape::Type::CYLINDER: {
             auto bt_cyl = static_cast<btCylinderShape*>(shape->m_bt_shape);
-            auto hdims = ChBulletToVect(bt_cyl->getHalfExtentsWithoutMargin());
-            dims = {hdims.x(), hdims.z(), hdims.y()};
+            auto hdims = ChBulletToVect(bt_cyl->getHalfExtentsWithMargin());
+            dims = {hdims.x() - env, hdims.z() - env, hdims.y() - env};
             break;
         }
         default:
@@ -15,6 +15,8 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
@@ -155,6 +157,22 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& mresult) const = 0;
 
+    /// Ray segment for batched ray-hit tests.
+    struct ChRay {
+        ChVector<> from;  ///< ray start point, in absolute coordinates
+        ChVector<> to;    ///< ray end point, in absolute coordinates
+    };
+
+    /// Perform a batch of ray-hit tests with the collision models.
+    /// On return, 'results' has the same size as 'rays', with results[i] the outcome of the test for rays[i].
+    /// Collision models must not be added, removed, or moved while this function executes.
+    /// The default implementation processes the rays sequentially. Derived classes may process them concurrently.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+        results.resize(rays.size());
+        for (size_t i = 0; i < rays.size(); i++)
+            RayHit(rays[i].from, rays[i].to, results[i]);
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) {
         // version number
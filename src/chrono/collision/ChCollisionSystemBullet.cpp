@@ -19,6 +19,7 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/collision/bullet/LinearMath/btPoolAllocator.h"
 #include "chrono/collision/bullet/LinearMath/btThreads.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSphereShape.h"
@@ -1511,6 +1512,51 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     return true;
 }
 
+// Parallel-for body for processing a range of rays in a batched ray-hit test.
+class RayHitBatchBody : public btIParallelForBody {
+  public:
+    RayHitBatchBody(const ChCollisionSystemBullet* system,
+                    const std::vector<ChCollisionSystem::ChRay>& rays,
+                    std::vector<ChCollisionSystem::ChRayhitResult>& results,
+                    short int filter_group,
+                    short int filter_mask)
+        : m_system(system),
+          m_rays(rays),
+          m_results(results),
+          m_filter_group(filter_group),
+          m_filter_mask(filter_mask) {}
+
+    virtual void forLoop(int iBegin, int iEnd) const override {
+        CH_TRACE("RayHitBatch");
+        for (int i = iBegin; i < iEnd; i++) {
+            m_system->RayHit(m_rays[i].from, m_rays[i].to, m_results[i], m_filter_group, m_filter_mask);
+        }
+    }
+
+  private:
+    const ChCollisionSystemBullet* m_system;
+    const std::vector<ChCollisionSystem::ChRay>& m_rays;
+    std::vector<ChCollisionSystem::ChRayhitResult>& m_results;
+    short int m_filter_group;
+    short int m_filter_mask;
+};
+
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    RayHitBatch(rays, results, btBroadphaseProxy::DefaultFilter, btBroadphaseProxy::AllFilter);
+}
+
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays,
+                                          std::vector<ChRayhitResult>& results,
+                                          short int filter_group,
+                                          short int filter_mask) const {
+    results.resize(rays.size());
+
+    // Note: btCollisionWorld::rayTest only reads the broadphase tree and the collision shapes, using per-call
+    // traversal stacks when Bullet is built with BT_THREADSAFE. Results are written to disjoint slots.
+    RayHitBatchBody body(this, rays, results, filter_group, filter_mask);
+    btParallelFor(0, (int)rays.size(), 64, body);
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (btScalar)threshold;
 }
@@ -109,6 +109,19 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// The rays are processed concurrently, using the Bullet task scheduler with the number of threads specified
+    /// through SetNumThreads. All queries are performed against the broadphase and collision shapes as of the last
+    /// collision detection pass, which are not modified during the batch.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
+    /// Perform a batch of ray-hit tests with all collision models. This version allows specifying the Bullet
+    /// collision filter group and mask (see btBroadphaseProxy::CollisionFilterGroups).
+    void RayHitBatch(const std::vector<ChRay>& rays,
+                     std::vector<ChRayhitResult>& results,
+                     short int filter_group,
+                     short int filter_mask) const;
+
     // For Bullet related stuff
     btCollisionWorld* GetBulletCollisionWorld() { return bt_collision_world; }
 
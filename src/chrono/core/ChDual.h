@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Dual numbers for forward-mode automatic differentiation.
+//
+// =============================================================================
+
+#ifndef CHDUAL_H
+#define CHDUAL_H
+
+#include <cmath>
+
+namespace chrono {
+
+/// Dual number for forward-mode automatic differentiation.
+/// A ChDual carries a value and its derivatives with respect to N independent variables, all propagated
+/// exactly through the arithmetic operations and elementary functions below. Evaluating a function once
+/// on dual numbers therefore provides N columns of its jacobian.
+/// ChDual can be used as the 'Real' type of ChVector and ChQuaternion for the operations that only involve
+/// arithmetic. Comparisons only consider the value.
+template <int N>
+class ChDual {
+  public:
+    /// Construct a constant (all derivatives zero).
+    ChDual(double v = 0) : val(v) {
+        for (int i = 0; i < N; i++)
+            der[i] = 0;
+    }
+
+    /// Construct the independent variable 'i' with value 'v' (its derivative with respect to itself is 'seed').
+    ChDual(double v, int i, double seed = 1) : ChDual(v) { der[i] = seed; }
+
+    /// Number of independent variables.
+    static constexpr int Size() { return N; }
+
+    double val;     ///< value
+    double der[N];  ///< derivatives with respect to the independent variables
+
+    ChDual& operator+=(const ChDual& b) {
+        val += b.val;
+        for (int i = 0; i < N; i++)
+            der[i] += b.der[i];
+        return *this;
+    }
+    ChDual& operator-=(const ChDual& b) {
+        val -= b.val;
+        for (int i = 0; i < N; i++)
+            der[i] -= b.der[i];
+        return *this;
+    }
+    ChDual& operator*=(const ChDual& b) {
+        for (int i = 0; i < N; i++)
+            der[i] = der[i] * b.val + val * b.der[i];
+        val *= b.val;
+        return *this;
+    }
+    ChDual& operator/=(const ChDual& b) {
+        double inv = 1 / b.val;
+        val *= inv;
+        for (int i = 0; i < N; i++)
+            der[i] = (der[i] - val * b.der[i]) * inv;
+        return *this;
+    }
+    ChDual& operator+=(double b) {
+        val += b;
+        return *this;
+    }
+    ChDual& operator-=(double b) {
+        val -= b;
+        return *this;
+    }
+    ChDual& operator*=(double b) {
+        val *= b;
+        for (int i = 0; i < N; i++)
+            der[i] *= b;
+        return *this;
+    }
+    ChDual& operator/=(double b) { return *this *= (1 / b); }
+
+    ChDual operator-() const {
+        ChDual r(*this);
+        r *= -1.0;
+        return r;
+    }
+    ChDual operator+() const { return *this; }
+
+    // Arithmetic operators
+
+    friend ChDual operator+(ChDual a, const ChDual& b) { return a += b; }
+    friend ChDual operator+(ChDual a, double b) { return a += b; }
+    friend ChDual operator+(double a, ChDual b) { return b += a; }
+    friend ChDual operator-(ChDual a, const ChDual& b) { return a -= b; }
+    friend ChDual operator-(ChDual a, double b) { return a -= b; }
+    friend ChDual operator-(double a, const ChDual& b) { return -b + a; }
+    friend ChDual operator*(ChDual a, const ChDual& b) { return a *= b; }
+    friend ChDual operator*(ChDual a, double b) { return a *= b; }
+    friend ChDual operator*(double a, ChDual b) { return b *= a; }
+    friend ChDual operator/(ChDual a, const ChDual& b) { return a /= b; }
+    friend ChDual operator/(ChDual a, double b) { return a /= b; }
+    friend ChDual operator/(double a, const ChDual& b) { return ChDual(a) /= b; }
+
+    // Comparison operators (on values only)
+
+    friend bool operator<(const ChDual& a, const ChDual& b) { return a.val < b.val; }
+    friend bool operator>(const ChDual& a, const ChDual& b) { return a.val > b.val; }
+    friend bool operator<=(const ChDual& a, const ChDual& b) { return a.val <= b.val; }
+    friend bool operator>=(const ChDual& a, const ChDual& b) { return a.val >= b.val; }
+    friend bool operator<(const ChDual& a, double b) { return a.val < b; }
+    friend bool operator>(const ChDual& a, double b) { return a.val > b; }
+    friend bool operator<=(const ChDual& a, double b) { return a.val <= b; }
+    friend bool operator>=(const ChDual& a, double b) { return a.val >= b; }
+
+    // Elementary functions.
+    // These are only found by argument-dependent lookup, so that they do not hide the functions on doubles.
+
+    friend ChDual sqrt(const ChDual& a) {
+        double v = std::sqrt(a.val);
+        return Chain(a, v, 0.5 / v);
+    }
+    friend ChDual sin(const ChDual& a) { return Chain(a, std::sin(a.val), std::cos(a.val)); }
+    friend ChDual cos(const ChDual& a) { return Chain(a, std::cos(a.val), -std::sin(a.val)); }
+    friend ChDual tan(const ChDual& a) {
+        double v = std::tan(a.val);
+        return Chain(a, v, 1 + v * v);
+    }
+    friend ChDual asin(const ChDual& a) { return Chain(a, std::asin(a.val), 1 / std::sqrt(1 - a.val * a.val)); }
+    friend ChDual acos(const ChDual& a) { return Chain(a, std::acos(a.val), -1 / std::sqrt(1 - a.val * a.val)); }
+    friend ChDual atan(const ChDual& a) { return Chain(a, std::atan(a.val), 1 / (1 + a.val * a.val)); }
+    friend ChDual atan2(const ChDual& y, const ChDual& x) {
+        double den = 1 / (x.val * x.val + y.val * y.val);
+        ChDual r(std::atan2(y.val, x.val));
+        for (int i = 0; i < N; i++)
+            r.der[i] = (x.val * y.der[i] - y.val * x.der[i]) * den;
+        return r;
+    }
+    friend ChDual exp(const ChDual& a) {
+        double v = std::exp(a.val);
+        return Chain(a, v, v);
+    }
+    friend ChDual log(const ChDual& a) { return Chain(a, std::log(a.val), 1 / a.val); }
+    friend ChDual pow(const ChDual& a, double e) {
+        return Chain(a, std::pow(a.val, e), e * std::pow(a.val, e - 1));
+    }
+    friend ChDual fabs(const ChDual& a) { return a.val < 0 ? -a : a; }
+    friend ChDual abs(const ChDual& a) { return fabs(a); }
+
+  private:
+    // Apply the chain rule: f(a) has value 'v' and derivative 'd' with respect to a.
+    static ChDual Chain(const ChDual& a, double v, double d) {
+        ChDual r(v);
+        for (int i = 0; i < N; i++)
+            r.der[i] = d * a.der[i];
+        return r;
+    }
+};
+
+}  // end namespace chrono
+
+#endif
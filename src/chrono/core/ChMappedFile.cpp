@@ -0,0 +1,70 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Read-only view of the contents of a file, memory-mapped where supported.
+//
+// =============================================================================
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define CH_MAPPED_FILE_MMAP
+#endif
+
+#include "chrono/core/ChMappedFile.h"
+
+namespace chrono {
+
+ChMappedFile::ChMappedFile(const std::string& filename) : m_data(nullptr), m_size(0), m_mapped(false) {
+#if defined(CH_MAPPED_FILE_MMAP)
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            madvise(addr, (size_t)st.st_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(addr);
+            m_size = (size_t)st.st_size;
+            m_mapped = true;
+        }
+    }
+    close(fd);
+#else
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile)
+        return;
+    m_size = (size_t)ifile.tellg();
+    if (m_size == 0)
+        return;
+    m_buffer.resize(m_size / sizeof(uint64_t) + 1);
+    ifile.seekg(0);
+    if (ifile.read(reinterpret_cast<char*>(m_buffer.data()), m_size))
+        m_data = reinterpret_cast<const char*>(m_buffer.data());
+    else
+        m_size = 0;
+#endif
+}
+
+ChMappedFile::~ChMappedFile() {
+#if defined(CH_MAPPED_FILE_MMAP)
+    if (m_mapped)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+}  // end namespace chrono
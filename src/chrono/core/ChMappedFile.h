@@ -0,0 +1,72 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Read-only view of the contents of a file, memory-mapped where supported.
+//
+// =============================================================================
+
+#ifndef CHMAPPEDFILE_H
+#define CHMAPPEDFILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// Read-only view of the contents of a file.
+/// Where supported (Linux, macOS), the file is memory-mapped, so that its pages are loaded on demand and shared with
+/// the operating system file cache. Otherwise, the file contents are read into a buffer. In both cases, the data is
+/// 8-byte aligned.
+class ChApi ChMappedFile {
+  public:
+    /// Open the specified file. Use IsValid to check whether the file could be read.
+    explicit ChMappedFile(const std::string& filename);
+
+    ~ChMappedFile();
+
+    ChMappedFile(const ChMappedFile&) = delete;
+    ChMappedFile& operator=(const ChMappedFile&) = delete;
+
+    /// Return true if the file was opened and is not empty.
+    bool IsValid() const { return m_data != nullptr; }
+
+    /// Return true if the file is memory-mapped.
+    bool IsMapped() const { return m_mapped; }
+
+    /// Return a pointer to the file contents.
+    const char* GetData() const { return m_data; }
+
+    /// Return the size of the file (in bytes).
+    size_t GetSize() const { return m_size; }
+
+    /// Return a pointer to the given number of records of type T at the specified offset (in bytes).
+    /// Return nullptr if the records are not suitably aligned or extend past the end of the file.
+    template <typename T>
+    const T* Get(uint64_t offset, uint64_t count) const {
+        if (!m_data || offset % alignof(T) != 0 || offset > m_size || count > (m_size - offset) / sizeof(T))
+            return nullptr;
+        return reinterpret_cast<const T*>(m_data + offset);
+    }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+    bool m_mapped;
+    std::vector<uint64_t> m_buffer;  ///< file contents, if not memory-mapped
+};
+
+}  // end namespace chrono
+
+#endif
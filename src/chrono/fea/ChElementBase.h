@@ -100,6 +100,9 @@ class ChApi ChElementBase {
     /// Adds the internal forces (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += forces * c
+    /// This function (as well as EleIntLoadResidual_Mv and EleIntLoadResidual_F_gravity) is called concurrently for
+    /// different elements, but never concurrently for elements sharing nodes and writing to the same vector R (see
+    /// ChMesh::ParallelLoadMode), so that implementations need no atomic updates.
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
     /// Adds the product of element mass M by a vector w (pasted at global nodes offsets) into
@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/fea/ChElementColoring.h"
+
+namespace chrono {
+namespace fea {
+
+const int ChElementColoring::max_colors;
+
+void ChElementColoring::Update(const std::vector<std::shared_ptr<ChElementBase>>& elements) {
+    m_seq_elements.clear();
+
+    // Bitmask of the colors of the elements already acting on each node.
+    std::unordered_map<ChNodeFEAbase*, uint64_t> node_colors;
+    std::vector<uint64_t*> elem_nodes;
+    std::vector<int> elem_colors(elements.size(), -1);
+
+    // Greedy coloring of the elements, in the order of the element list.
+    int num_colors = 0;
+    for (size_t ie = 0; ie < elements.size(); ie++) {
+        auto& element = elements[ie];
+        elem_nodes.clear();
+        uint64_t used = 0;
+        for (int in = 0; in < element->GetNnodes(); in++) {
+            uint64_t& colors = node_colors[element->GetNodeN(in).get()];
+            elem_nodes.push_back(&colors);
+            used |= colors;
+        }
+
+        if (~used != 0) {
+            // lowest color not yet acting on any of the element nodes
+            int color = 0;
+            while (used & (uint64_t(1) << color))
+                color++;
+            for (auto colors : elem_nodes)
+                *colors |= (uint64_t(1) << color);
+            num_colors = std::max(num_colors, color + 1);
+            elem_colors[ie] = color;
+        } else {
+            m_seq_elements.push_back((unsigned int)ie);
+        }
+    }
+
+    // Sort the colored elements by color (stable counting sort).
+    m_color_start.assign(num_colors + 1, 0);
+    for (auto color : elem_colors) {
+        if (color >= 0)
+            m_color_start[color + 1]++;
+    }
+    for (int c = 0; c < num_colors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+
+    m_elements.resize(m_color_start[num_colors]);
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end() - 1);
+    for (size_t ie = 0; ie < elements.size(); ie++) {
+        int color = elem_colors[ie];
+        if (color >= 0)
+            m_elements[next[color]++] = (unsigned int)ie;
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,74 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_ELEMENT_COLORING_H
+#define CH_ELEMENT_COLORING_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/fea/ChElementBase.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup chrono_fea
+/// @{
+
+/// Partition of the elements of a mesh into colors, for race-free multithreaded loading of element contributions
+/// (internal forces, gravity, M*v products) into global vectors.
+/// Elements are colored greedily, such that no two elements of the same color share a node. The elements of one color
+/// can therefore write their nodal contributions concurrently without atomic updates, while colors are processed in
+/// sequence. All nodes are considered, including fixed ones, so that the coloring remains valid if nodes are fixed or
+/// released later. Elements that cannot be colored (too many colors needed) are collected in a separate list, to be
+/// processed sequentially after all colors.
+class ChApi ChElementColoring {
+  public:
+    /// Maximum number of colors. Elements requiring more colors are processed sequentially.
+    static const int max_colors = 64;
+
+    ChElementColoring() {}
+
+    /// Partition the given elements.
+    /// This must be called whenever elements are added or removed (see ChMesh::SetupInitial).
+    void Update(const std::vector<std::shared_ptr<ChElementBase>>& elements);
+
+    /// Return the number of colors.
+    int GetNumColors() const { return m_color_start.empty() ? 0 : (int)m_color_start.size() - 1; }
+
+    /// Return the index (in GetElements) of the first element with the given color.
+    unsigned int GetColorStart(int color) const { return m_color_start[color]; }
+
+    /// Return the index (in GetElements) past the last element with the given color.
+    unsigned int GetColorEnd(int color) const { return m_color_start[color + 1]; }
+
+    /// Return the indices of the colored elements, sorted by color.
+    /// Within a color, elements are in the order of the mesh element list.
+    const std::vector<unsigned int>& GetElements() const { return m_elements; }
+
+    /// Return the indices of the elements that must be processed sequentially.
+    const std::vector<unsigned int>& GetSequentialElements() const { return m_seq_elements; }
+
+  private:
+    std::vector<unsigned int> m_elements;      ///< indices of colored elements, sorted by color
+    std::vector<unsigned int> m_seq_elements;  ///< indices of elements to be processed sequentially
+    std::vector<unsigned int> m_color_start;   ///< start of each color in m_elements (plus end marker)
+};
+
+/// @} chrono_fea
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
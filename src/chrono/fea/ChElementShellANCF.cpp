@@ -120,6 +120,9 @@ void ChElementShellANCF::SetupInitial(ChSystem* system) {
     // Cache the scaling factor (due to change of integration intervals)
     m_GaussScaling = (m_lenX * m_lenY * m_thickness) / 8;
 
+    // Precompute the Gauss point data used in the internal force and Jacobian calculations
+    ComputeGaussPoints();
+
     // Compute mass matrix and gravitational forces (constant)
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
@@ -277,155 +280,144 @@ void ChElementShellANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 }
 
 // -----------------------------------------------------------------------------
-// Elastic force calculation
+// Gauss point data
 // -----------------------------------------------------------------------------
 
-// The class ShellANCF_Force provides the integrand for the calculation of the internal forces
-// for one layer of an ANCF shell element.
-// The first 24 entries in the integrand represent the internal force.
-// The next 5 entries represent the residual of the EAS nonlinear system.
-// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
-// Capabilities of this class include: application of enhanced assumed strain (EAS) and
-// assumed natural strain (ANS) formulations to avoid thickness and (transverse and in-plane)
-// shear locking. This implementation also features a composite material implementation
-// that allows for selecting a number of layers over the element thickness; each of which
-// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class ShellANCF_Force : public ChIntegrable3D<ChVectorN<double, 54>> {
-  public:
-    ShellANCF_Force(ChElementShellANCF* element,     // Containing element
-                    size_t kl,                       // Current layer index
-                    ChVectorN<double, 5>* alpha_eas  // Vector of internal parameters for EAS formulation
-                    )
-        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
-    ~ShellANCF_Force() {}
-
-  private:
-    ChElementShellANCF* m_element;
-    size_t m_kl;
-    ChVectorN<double, 5>* m_alpha_eas;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) override;
-};
-
-void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChElementShellANCF::ShapeVector N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChElementShellANCF::ShapeVector Nx;
-    ChElementShellANCF::ShapeVector Ny;
-    ChElementShellANCF::ShapeVector Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0(1) * Ny_d0(2) - Nx_d0(2) * Ny_d0(1);
-    G1xG2.y() = Nx_d0(2) * Ny_d0(0) - Nx_d0(0) * Ny_d0(2);
-    G1xG2.z() = Nx_d0(0) * Ny_d0(1) - Nx_d0(1) * Ny_d0(0);
-    G1dotG1 = Nx_d0(0) * Nx_d0(0) + Nx_d0(1) * Nx_d0(1) + Nx_d0(2) * Nx_d0(2);
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0(0);
-    A1.y() = Nx_d0(1);
-    A1.z() = Nx_d0(2);
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChVectorN<double, 9> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
-    j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
-    j0(0, 2) = Ny_d0(0) * Nz_d0(1) - Nz_d0(0) * Ny_d0(1);
-    j0(1, 0) = Nz_d0(1) * Nx_d0(2) - Nx_d0(1) * Nz_d0(2);
-    j0(1, 1) = Nz_d0(2) * Nx_d0(0) - Nx_d0(2) * Nz_d0(0);
-    j0(1, 2) = Nz_d0(0) * Nx_d0(1) - Nz_d0(1) * Nx_d0(0);
-    j0(2, 0) = Nx_d0(1) * Ny_d0(2) - Ny_d0(1) * Nx_d0(2);
-    j0(2, 1) = Ny_d0(0) * Nx_d0(2) - Nx_d0(0) * Ny_d0(2);
-    j0(2, 2) = Nx_d0(0) * Ny_d0(1) - Ny_d0(0) * Nx_d0(1);
-    j0 /= detJ0;
+// Precompute, for each layer, the quantities at the 2x2x2 Gauss points that only depend on the initial
+// configuration. The points are ordered as in ChQuadrature::Integrate3D (x outermost, z innermost) and the
+// integration weights include the change of integration intervals and the determinant of the initial position
+// vector gradient.
+void ChElementShellANCF::ComputeGaussPoints() {
+    const std::vector<double>& roots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weights = ChQuadrature::GetStaticTables()->Weight[1];
 
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
+    m_gaussPoints.resize(8 * m_numLayers);
 
-    // Coefficients of contravariant transformation
-    beta(0) = Vdot(AA1, j01);
-    beta(1) = Vdot(AA2, j01);
-    beta(2) = Vdot(AA3, j01);
-    beta(3) = Vdot(AA1, j02);
-    beta(4) = Vdot(AA2, j02);
-    beta(5) = Vdot(AA3, j02);
-    beta(6) = Vdot(AA1, j03);
-    beta(7) = Vdot(AA2, j03);
-    beta(8) = Vdot(AA3, j03);
-
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
-
-    // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-    ChVectorN<double, 6> strain_EAS = G * (*m_alpha_eas);
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        // Layer z limits, fiber angle, transformation matrix and determinant at the element center
+        double Zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double Zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+        double theta = m_layers[kl].Get_theta();
+        const ChMatrixNM<double, 6, 6>& T0 = m_layers[kl].Get_T0();
+        double detJ0C = m_layers[kl].Get_detJ0C();
+
+        int ip = 0;
+        for (int ix = 0; ix < 2; ix++) {
+            for (int iy = 0; iy < 2; iy++) {
+                for (int iz = 0; iz < 2; iz++) {
+                    double x = roots[ix];
+                    double y = roots[iy];
+                    double z = Zc1 * roots[iz] + Zc2;
+
+                    GaussPoint& gp = m_gaussPoints[8 * kl + ip++];
+
+                    // Element shape functions and determinant of the initial position vector gradient
+                    ShapeVector Nz;
+                    ChMatrixNM<double, 1, 3> Nx_d0;
+                    ChMatrixNM<double, 1, 3> Ny_d0;
+                    ChMatrixNM<double, 1, 3> Nz_d0;
+                    ShapeFunctions(gp.N, x, y, z);
+                    double detJ0 = Calc_detJ0(x, y, z, gp.Nx, gp.Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                    // ANS and EAS shape functions
+                    ChMatrixNM<double, 6, 5> M;
+                    ShapeFunctionANSbilinearShell(gp.S_ANS, x, y);
+                    Basis_M(M, x, y, z);
+
+                    // Tangent frame
+                    ChVector<double> A1(Nx_d0(0), Nx_d0(1), Nx_d0(2));
+                    ChVector<double> G1xG2(Nx_d0(1) * Ny_d0(2) - Nx_d0(2) * Ny_d0(1),
+                                           Nx_d0(2) * Ny_d0(0) - Nx_d0(0) * Ny_d0(2),
+                                           Nx_d0(0) * Ny_d0(1) - Nx_d0(1) * Ny_d0(0));
+                    A1 = A1 / A1.Length();
+                    ChVector<double> A3 = G1xG2.GetNormalized();
+                    ChVector<double> A2;
+                    A2.Cross(A3, A1);
+
+                    // Direction for orthotropic material
+                    ChVector<double> AA1 = A1 * cos(theta) + A2 * sin(theta);
+                    ChVector<double> AA2 = -A1 * sin(theta) + A2 * cos(theta);
+                    ChVector<double> AA3 = A3;
+
+                    // Inverse of the initial position vector gradient (j0)
+                    ChMatrixNM<double, 3, 3> j0;
+                    j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
+                    j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
+                    j0(0, 2) = Ny_d0(0) * Nz_d0(1) - Nz_d0(0) * Ny_d0(1);
+                    j0(1, 0) = Nz_d0(1) * Nx_d0(2) - Nx_d0(1) * Nz_d0(2);
+                    j0(1, 1) = Nz_d0(2) * Nx_d0(0) - Nx_d0(2) * Nz_d0(0);
+                    j0(1, 2) = Nz_d0(0) * Nx_d0(1) - Nz_d0(1) * Nx_d0(0);
+                    j0(2, 0) = Nx_d0(1) * Ny_d0(2) - Ny_d0(1) * Nx_d0(2);
+                    j0(2, 1) = Ny_d0(0) * Nx_d0(2) - Nx_d0(0) * Ny_d0(2);
+                    j0(2, 2) = Nx_d0(0) * Ny_d0(1) - Ny_d0(0) * Nx_d0(1);
+                    j0 /= detJ0;
+
+                    ChVector<double> j01(j0(0, 0), j0(0, 1), j0(0, 2));
+                    ChVector<double> j02(j0(1, 0), j0(1, 1), j0(1, 2));
+                    ChVector<double> j03(j0(2, 0), j0(2, 1), j0(2, 2));
+
+                    // Coefficients of contravariant transformation
+                    gp.beta(0) = Vdot(AA1, j01);
+                    gp.beta(1) = Vdot(AA2, j01);
+                    gp.beta(2) = Vdot(AA3, j01);
+                    gp.beta(3) = Vdot(AA1, j02);
+                    gp.beta(4) = Vdot(AA2, j02);
+                    gp.beta(5) = Vdot(AA3, j02);
+                    gp.beta(6) = Vdot(AA1, j03);
+                    gp.beta(7) = Vdot(AA2, j03);
+                    gp.beta(8) = Vdot(AA3, j03);
+
+                    // Enhanced Assumed Strain interpolation
+                    gp.G = T0 * M * (detJ0C / detJ0);
+
+                    // Shape function derivatives w.r.t. the initial configuration coordinates
+                    gp.dN0.row(0) = j0(0, 0) * gp.Nx + j0(1, 0) * gp.Ny + j0(2, 0) * Nz;
+                    gp.dN0.row(1) = j0(0, 1) * gp.Nx + j0(1, 1) * gp.Ny + j0(2, 1) * Nz;
+                    gp.dN0.row(2) = j0(0, 2) * gp.Nx + j0(1, 2) * gp.Ny + j0(2, 2) * Nz;
+
+                    // In-plane strain terms of the initial configuration
+                    gp.strain0(0) = (gp.Nx * m_d0d0T * gp.Nx.transpose())(0, 0);
+                    gp.strain0(1) = (gp.Ny * m_d0d0T * gp.Ny.transpose())(0, 0);
+                    gp.strain0(2) = (gp.Nx * m_d0d0T * gp.Ny.transpose())(0, 0);
+
+                    gp.weight = weights[ix] * weights[iy] * weights[iz] * Zc1 * detJ0 * m_GaussScaling;
+                }
+            }
+        }
+    }
+}
 
-    ChVectorN<double, 8> ddNx = m_element->m_ddT * Nx.transpose();
-    ChVectorN<double, 8> ddNy = m_element->m_ddT * Ny.transpose();
-    ChVectorN<double, 8> ddNz = m_element->m_ddT * Nz.transpose();
+// -----------------------------------------------------------------------------
+// Elastic force calculation
+// -----------------------------------------------------------------------------
 
-    ChVectorN<double, 8> d0d0Nx = m_element->m_d0d0T * Nx.transpose();
-    ChVectorN<double, 8> d0d0Ny = m_element->m_d0d0T * Ny.transpose();
-    ChVectorN<double, 8> d0d0Nz = m_element->m_d0d0T * Nz.transpose();
+// Calculate the strain and strain derivatives at a Gauss point, for the current nodal coordinates and velocities.
+// Capabilities include the assumed natural strain (ANS) formulation to avoid thickness and (transverse) shear
+// locking, as well as orthotropic materials with a user-selected fiber angle for each layer. The strain includes
+// structural damping, but not the enhanced assumed strain (EAS), which depends on the EAS parameters of the layer.
+void ChElementShellANCF::ComputeStrain(const GaussPoint& gp,
+                                       ChVectorN<double, 6>& strain,
+                                       ChMatrixNM<double, 6, 24>& strainD) {
+    const ShapeVector& N = gp.N;
+    const ShapeVector& Nx = gp.Nx;
+    const ShapeVector& Ny = gp.Ny;
+    const ChMatrixNM<double, 1, 4>& S_ANS = gp.S_ANS;
+    const ChVectorN<double, 9>& beta = gp.beta;
+
+    // Current position vector gradient (first two columns)
+    ChMatrixNM<double, 1, 3> Nx_d = Nx * m_d;
+    ChMatrixNM<double, 1, 3> Ny_d = Ny * m_d;
 
     // Strain component
     ChVectorN<double, 6> strain_til;
-    strain_til(0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
-    strain_til(1) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
-    strain_til(2) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3) = N(0) * m_element->m_strainANS(0) + N(2) * m_element->m_strainANS(1) +
-                    N(4) * m_element->m_strainANS(2) + N(6) * m_element->m_strainANS(3);
-    strain_til(4) = S_ANS(0, 2) * m_element->m_strainANS(6) + S_ANS(0, 3) * m_element->m_strainANS(7);
-    strain_til(5) = S_ANS(0, 0) * m_element->m_strainANS(4) + S_ANS(0, 1) * m_element->m_strainANS(5);
+    strain_til(0) = 0.5 * (Nx_d.squaredNorm() - gp.strain0(0));
+    strain_til(1) = 0.5 * (Ny_d.squaredNorm() - gp.strain0(1));
+    strain_til(2) = Nx_d.dot(Ny_d) - gp.strain0(2);
+    strain_til(3) = N(0) * m_strainANS(0) + N(2) * m_strainANS(1) + N(4) * m_strainANS(2) + N(6) * m_strainANS(3);
+    strain_til(4) = S_ANS(0, 2) * m_strainANS(6) + S_ANS(0, 3) * m_strainANS(7);
+    strain_til(5) = S_ANS(0, 0) * m_strainANS(4) + S_ANS(0, 1) * m_strainANS(5);
 
     // For orthotropic material
-    ChVectorN<double, 6> strain;
-
     strain(0) = strain_til(0) * beta(0) * beta(0) + strain_til(1) * beta(3) * beta(3) +
                 strain_til(2) * beta(0) * beta(3) + strain_til(3) * beta(6) * beta(6) +
                 strain_til(4) * beta(0) * beta(6) + strain_til(5) * beta(3) * beta(6);
@@ -449,57 +441,20 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
                 strain_til(5) * (beta(5) * beta(7) + beta(4) * beta(8));
 
     // Strain derivative component
-
     ChMatrixNM<double, 6, 24> strainD_til;
-
-    ChMatrixNM<double, 1, 24> tempB;
-    ChMatrixNM<double, 1, 3> tempB3;
-    ChMatrixNM<double, 1, 3> tempB31;
-
-    tempB3 = Nx * m_element->m_d;
     for (int i = 0; i < 8; i++) {
         for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
+            strainD_til(0, i * 3 + j) = Nx_d(0, j) * Nx(0, i);
+            strainD_til(1, i * 3 + j) = Ny_d(0, j) * Ny(0, i);
+            strainD_til(2, i * 3 + j) = Ny_d(0, j) * Nx(0, i) + Nx_d(0, j) * Ny(0, i);
         }
     }
-    strainD_til.row(0) = tempB;
-
-    tempB3 = Ny * m_element->m_d;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.row(1) = tempB;
-
-    tempB31 = Nx * m_element->m_d;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.row(2) = tempB;
-
-    tempB.setZero();
-    for (int i = 0; i < 4; i++) {
-        tempB += N(i * 2) * m_element->m_strainANS_D.row(i);
-    }
-    strainD_til.row(3) = tempB;  // strainD for zz
-
-    tempB.setZero();
-    for (int i = 0; i < 2; i++) {
-        tempB += S_ANS(0, i + 2) * m_element->m_strainANS_D.row(i + 6);
-    }
-    strainD_til.row(4) = tempB;  // strainD for xz
-
-    tempB.setZero();
-    for (int i = 0; i < 2; i++) {
-        tempB += S_ANS(0, i) * m_element->m_strainANS_D.row(i + 4);
-    }
-    strainD_til.row(5) = tempB;  // strainD for yz
+    strainD_til.row(3) = N(0) * m_strainANS_D.row(0) + N(2) * m_strainANS_D.row(1) + N(4) * m_strainANS_D.row(2) +
+                         N(6) * m_strainANS_D.row(3);                                  // strainD for zz
+    strainD_til.row(4) = S_ANS(0, 2) * m_strainANS_D.row(6) + S_ANS(0, 3) * m_strainANS_D.row(7);  // strainD for xz
+    strainD_til.row(5) = S_ANS(0, 0) * m_strainANS_D.row(4) + S_ANS(0, 1) * m_strainANS_D.row(5);  // strainD for yz
 
     // For orthotropic material
-    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates. Includes orthotropy
     for (int ii = 0; ii < 24; ii++) {
         strainD(0, ii) = strainD_til(0, ii) * beta(0) * beta(0) + strainD_til(1, ii) * beta(3) * beta(3) +
                          strainD_til(2, ii) * beta(0) * beta(3) + strainD_til(3, ii) * beta(6) * beta(6) +
@@ -527,41 +482,14 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
                          strainD_til(5, ii) * (beta(5) * beta(7) + beta(4) * beta(8));
     }
 
-    // Enhanced Assumed Strain 2nd
-    strain += strain_EAS;
-
-    // Strain time derivative for structural damping
-    ChVectorN<double, 6> DEPS;
-    DEPS.setZero();
-    for (int ii = 0; ii < 24; ii++) {
-        DEPS(0) += strainD(0, ii) * m_element->m_d_dt(ii);
-        DEPS(1) += strainD(1, ii) * m_element->m_d_dt(ii);
-        DEPS(2) += strainD(2, ii) * m_element->m_d_dt(ii);
-        DEPS(3) += strainD(3, ii) * m_element->m_d_dt(ii);
-        DEPS(4) += strainD(4, ii) * m_element->m_d_dt(ii);
-        DEPS(5) += strainD(5, ii) * m_element->m_d_dt(ii);
-    }
-
-    // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
-
-    // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
-
-    // Internal force calculation
-    ChVectorN<double, 24> Fint = (strainD.transpose() * E_eps * strain) * (detJ0 * m_element->m_GaussScaling);
-
-    // EAS terms
-    ChMatrixNM<double, 5, 6> temp56 = G.transpose() * E_eps;
-    ChVectorN<double, 5> HE = (temp56 * strain) * (detJ0 * m_element->m_GaussScaling);     // EAS residual
-    ChMatrixNM<double, 5, 5> KALPHA = (temp56 * G) * (detJ0 * m_element->m_GaussScaling);  // EAS Jacobian
-
-    /// Total result vector
-    result.segment(0, 24) = Fint;
-    result.segment(24, 5) = HE;
-    result.segment(29, 5 * 5) = Eigen::Map<ChVectorN<double, 5 * 5>>(KALPHA.data(), 5 * 5);
+    // Add structural damping (strain time derivative)
+    strain += (strainD * m_d_dt) * m_Alpha;
 }
 
+// The internal forces of each layer are integrated over the precomputed Gauss points of the layer. The strains and
+// strain derivatives do not depend on the EAS parameters, so they are evaluated once per call, before the Newton
+// iterations for the EAS parameters; each iteration then only adds the EAS strain and accumulates the internal force
+// and the EAS residual. The EAS Jacobian is also independent of the EAS parameters.
 void ChElementShellANCF::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     // Current nodal coordinates and velocities
     CalcCoordMatrix(m_d);
@@ -573,30 +501,36 @@ void ChElementShellANCF::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     Fi.setZero();
 
     for (size_t kl = 0; kl < m_numLayers; kl++) {
+        const GaussPoint* gps = &m_gaussPoints[8 * kl];
+
+        // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
+
+        // Strains, strain derivatives and EAS Jacobian (independent of the EAS parameters)
+        ChVectorN<double, 6> strain[8];
+        ChMatrixNM<double, 6, 24> strainD[8];
+        ChMatrixNM<double, 5, 5> KALPHA;
+        KALPHA.setZero();
+        for (int ip = 0; ip < 8; ip++) {
+            ComputeStrain(gps[ip], strain[ip], strainD[ip]);
+            KALPHA += (gps[ip].G.transpose() * E_eps * gps[ip].G) * gps[ip].weight;
+        }
+
         ChVectorN<double, 24> Finternal;
         ChVectorN<double, 5> HE;
-        ChMatrixNM<double, 5, 5> KALPHA;
 
         // Initial guess for EAS parameters
         ChVectorN<double, 5> alphaEAS = m_alphaEAS[kl];
 
         // Newton loop for EAS
         for (int count = 0; count < m_maxIterationsEAS; count++) {
-            ShellANCF_Force formula(this, kl, &alphaEAS);
-            ChVectorN<double, 54> result;
-            result.setZero();
-            ChQuadrature::Integrate3D<ChVectorN<double, 54>>(result,                          // result of integration
-                                                             formula,                         // integrand formula
-                                                             -1, 1,                           // x limits
-                                                             -1, 1,                           // y limits
-                                                             m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                             2                                // order of integration
-            );
-
-            // Extract vectors and matrices from result of integration
-            Finternal = result.segment(0, 24);
-            HE = result.segment(24, 5);
-            KALPHA = Eigen::Map<ChMatrixNM<double, 5, 5>>(result.segment(29, 5 * 5).data(), 5, 5);
+            Finternal.setZero();
+            HE.setZero();
+            for (int ip = 0; ip < 8; ip++) {
+                ChVectorN<double, 6> stress = (E_eps * (strain[ip] + gps[ip].G * alphaEAS)) * gps[ip].weight;
+                Finternal += strainD[ip].transpose() * stress;
+                HE += gps[ip].G.transpose() * stress;
+            }
 
             // Check convergence (residual check)
             double norm_HE = HE.norm();
@@ -629,351 +563,6 @@ void ChElementShellANCF::ComputeInternalForces(ChVectorDynamic<>& Fi) {
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
 
-// The class ShellANCF_Jacobian provides the integrand for the calculation of the Jacobians
-// (stiffness and damping matrices) of the internal forces for one layer of an ANCF
-// shell element.
-// The first 576 entries in the integrated vector represent the 24x24 Jacobian
-//      Kfactor * [K] + Rfactor * [R]
-// where K does not include the EAS contribution.
-// The last 120 entries represent the 5x24 cross-dependency matrix.
-class ShellANCF_Jacobian : public ChIntegrable3D<ChVectorN<double, 696>> {
-  public:
-    ShellANCF_Jacobian(ChElementShellANCF* element,  // Containing element
-                       double Kfactor,               // Scaling coefficient for stiffness component
-                       double Rfactor,               // Scaling coefficient for damping component
-                       size_t kl                     // Current layer index
-                       )
-        : m_element(element), m_Kfactor(Kfactor), m_Rfactor(Rfactor), m_kl(kl) {}
-
-  private:
-    ChElementShellANCF* m_element;
-    double m_Kfactor;
-    double m_Rfactor;
-    size_t m_kl;
-
-    // Evaluate integrand at the specified point.
-    virtual void Evaluate(ChVectorN<double, 696>& result, const double x, const double y, const double z) override;
-};
-
-void ShellANCF_Jacobian::Evaluate(ChVectorN<double, 696>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChElementShellANCF::ShapeVector N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChElementShellANCF::ShapeVector Nx;
-    ChElementShellANCF::ShapeVector Ny;
-    ChElementShellANCF::ShapeVector Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0(1) * Ny_d0(2) - Nx_d0(2) * Ny_d0(1);
-    G1xG2.y() = Nx_d0(2) * Ny_d0(0) - Nx_d0(0) * Ny_d0(2);
-    G1xG2.z() = Nx_d0(0) * Ny_d0(1) - Nx_d0(1) * Ny_d0(0);
-    G1dotG1 = Nx_d0(0) * Nx_d0(0) + Nx_d0(1) * Nx_d0(1) + Nx_d0(2) * Nx_d0(2);
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0(0);
-    A1.y() = Nx_d0(1);
-    A1.z() = Nx_d0(2);
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
-    j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
-    j0(0, 2) = Ny_d0(0) * Nz_d0(1) - Nz_d0(0) * Ny_d0(1);
-    j0(1, 0) = Nz_d0(1) * Nx_d0(2) - Nx_d0(1) * Nz_d0(2);
-    j0(1, 1) = Nz_d0(2) * Nx_d0(0) - Nx_d0(2) * Nz_d0(0);
-    j0(1, 2) = Nz_d0(0) * Nx_d0(1) - Nz_d0(1) * Nx_d0(0);
-    j0(2, 0) = Nx_d0(1) * Ny_d0(2) - Ny_d0(1) * Nx_d0(2);
-    j0(2, 1) = Ny_d0(0) * Nx_d0(2) - Nx_d0(0) * Ny_d0(2);
-    j0(2, 2) = Nx_d0(0) * Ny_d0(1) - Ny_d0(0) * Nx_d0(1);
-    j0 /= detJ0;
-
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
-
-    // Coefficients of contravariant transformation
-    ChVectorN<double, 9> beta;
-    beta(0) = Vdot(AA1, j01);
-    beta(1) = Vdot(AA2, j01);
-    beta(2) = Vdot(AA3, j01);
-    beta(3) = Vdot(AA1, j02);
-    beta(4) = Vdot(AA2, j02);
-    beta(5) = Vdot(AA3, j02);
-    beta(6) = Vdot(AA1, j03);
-    beta(7) = Vdot(AA2, j03);
-    beta(8) = Vdot(AA3, j03);
-
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
-
-    // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-    ChVectorN<double, 6> strain_EAS = G * m_element->m_alphaEAS[m_kl];
-
-    ChVectorN<double, 8> ddNx = m_element->m_ddT * Nx.transpose();
-    ChVectorN<double, 8> ddNy = m_element->m_ddT * Ny.transpose();
-    ChVectorN<double, 8> ddNz = m_element->m_ddT * Nz.transpose();
-
-    ChVectorN<double, 8> d0d0Nx = m_element->m_d0d0T * Nx.transpose();
-    ChVectorN<double, 8> d0d0Ny = m_element->m_d0d0T * Ny.transpose();
-    ChVectorN<double, 8> d0d0Nz = m_element->m_d0d0T * Nz.transpose();
-
-    // Strain component
-    ChVectorN<double, 6> strain_til;
-    strain_til(0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
-    strain_til(1) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
-    strain_til(2) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3) = N(0) * m_element->m_strainANS(0) + N(2) * m_element->m_strainANS(1) +
-                    N(4) * m_element->m_strainANS(2) + N(6) * m_element->m_strainANS(3);
-    strain_til(4) = S_ANS(0, 2) * m_element->m_strainANS(6) + S_ANS(0, 3) * m_element->m_strainANS(7);
-    strain_til(5) = S_ANS(0, 0) * m_element->m_strainANS(4) + S_ANS(0, 1) * m_element->m_strainANS(5);
-
-    // For orthotropic material
-    ChVectorN<double, 6> strain;
-
-    strain(0) = strain_til(0) * beta(0) * beta(0) + strain_til(1) * beta(3) * beta(3) +
-                strain_til(2) * beta(0) * beta(3) + strain_til(3) * beta(6) * beta(6) +
-                strain_til(4) * beta(0) * beta(6) + strain_til(5) * beta(3) * beta(6);
-    strain(1) = strain_til(0) * beta(1) * beta(1) + strain_til(1) * beta(4) * beta(4) +
-                strain_til(2) * beta(1) * beta(4) + strain_til(3) * beta(7) * beta(7) +
-                strain_til(4) * beta(1) * beta(7) + strain_til(5) * beta(4) * beta(7);
-    strain(2) = strain_til(0) * 2.0 * beta(0) * beta(1) + strain_til(1) * 2.0 * beta(3) * beta(4) +
-                strain_til(2) * (beta(1) * beta(3) + beta(0) * beta(4)) + strain_til(3) * 2.0 * beta(6) * beta(7) +
-                strain_til(4) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                strain_til(5) * (beta(4) * beta(6) + beta(3) * beta(7));
-    strain(3) = strain_til(0) * beta(2) * beta(2) + strain_til(1) * beta(5) * beta(5) +
-                strain_til(2) * beta(2) * beta(5) + strain_til(3) * beta(8) * beta(8) +
-                strain_til(4) * beta(2) * beta(8) + strain_til(5) * beta(5) * beta(8);
-    strain(4) = strain_til(0) * 2.0 * beta(0) * beta(2) + strain_til(1) * 2.0 * beta(3) * beta(5) +
-                strain_til(2) * (beta(2) * beta(3) + beta(0) * beta(5)) + strain_til(3) * 2.0 * beta(6) * beta(8) +
-                strain_til(4) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                strain_til(5) * (beta(5) * beta(6) + beta(3) * beta(8));
-    strain(5) = strain_til(0) * 2.0 * beta(1) * beta(2) + strain_til(1) * 2.0 * beta(4) * beta(5) +
-                strain_til(2) * (beta(2) * beta(4) + beta(1) * beta(5)) + strain_til(3) * 2.0 * beta(7) * beta(8) +
-                strain_til(4) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                strain_til(5) * (beta(5) * beta(7) + beta(4) * beta(8));
-
-    // Strain derivative component
-
-    ChMatrixNM<double, 6, 24> strainD_til;
-    strainD_til.setZero();
-
-    ChMatrixNM<double, 1, 24> tempB;
-    ChMatrixNM<double, 1, 3> tempB3;
-    ChMatrixNM<double, 1, 3> tempB31;
-
-    tempB3 = Nx * m_element->m_d;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
-        }
-    }
-    strainD_til.row(0) = tempB;
-
-    tempB3 = Ny * m_element->m_d;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.row(1) = tempB;
-
-    tempB31 = Nx * m_element->m_d;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 3; j++) {
-            tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
-        }
-    }
-    strainD_til.row(2) = tempB;
-
-    tempB.setZero();
-    for (int i = 0; i < 4; i++) {
-        tempB += N(i * 2) * m_element->m_strainANS_D.row(i);
-    }
-    strainD_til.row(3) = tempB;  // strainD for zz
-
-    tempB.setZero();
-    for (int i = 0; i < 2; i++) {
-        tempB += S_ANS(0, i + 2) * m_element->m_strainANS_D.row(i + 6);
-    }
-    strainD_til.row(4) = tempB;  // strainD for xz
-
-    tempB.setZero();
-    for (int i = 0; i < 2; i++) {
-        int ij = i + 4;
-        int ij1 = i;
-        tempB += S_ANS(0, i) * m_element->m_strainANS_D.row(i + 4);
-    }
-    strainD_til.row(5) = tempB;  // strainD for yz
-
-    //// For orthotropic material
-    ChMatrixNM<double, 6, 24> strainD;  // Derivative of the strains w.r.t. the coordinates. Includes orthotropy
-    for (int ii = 0; ii < 24; ii++) {
-        strainD(0, ii) = strainD_til(0, ii) * beta(0) * beta(0) + strainD_til(1, ii) * beta(3) * beta(3) +
-                         strainD_til(2, ii) * beta(0) * beta(3) + strainD_til(3, ii) * beta(6) * beta(6) +
-                         strainD_til(4, ii) * beta(0) * beta(6) + strainD_til(5, ii) * beta(3) * beta(6);
-        strainD(1, ii) = strainD_til(0, ii) * beta(1) * beta(1) + strainD_til(1, ii) * beta(4) * beta(4) +
-                         strainD_til(2, ii) * beta(1) * beta(4) + strainD_til(3, ii) * beta(7) * beta(7) +
-                         strainD_til(4, ii) * beta(1) * beta(7) + strainD_til(5, ii) * beta(4) * beta(7);
-        strainD(2, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(1) + strainD_til(1, ii) * 2.0 * beta(3) * beta(4) +
-                         strainD_til(2, ii) * (beta(1) * beta(3) + beta(0) * beta(4)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(7) +
-                         strainD_til(4, ii) * (beta(1) * beta(6) + beta(0) * beta(7)) +
-                         strainD_til(5, ii) * (beta(4) * beta(6) + beta(3) * beta(7));
-        strainD(3, ii) = strainD_til(0, ii) * beta(2) * beta(2) + strainD_til(1, ii) * beta(5) * beta(5) +
-                         strainD_til(2, ii) * beta(2) * beta(5) + strainD_til(3, ii) * beta(8) * beta(8) +
-                         strainD_til(4, ii) * beta(2) * beta(8) + strainD_til(5) * beta(5) * beta(8);
-        strainD(4, ii) = strainD_til(0, ii) * 2.0 * beta(0) * beta(2) + strainD_til(1, ii) * 2.0 * beta(3) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(3) + beta(0) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(6) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(6) + beta(0) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(6) + beta(3) * beta(8));
-        strainD(5, ii) = strainD_til(0, ii) * 2.0 * beta(1) * beta(2) + strainD_til(1, ii) * 2.0 * beta(4) * beta(5) +
-                         strainD_til(2, ii) * (beta(2) * beta(4) + beta(1) * beta(5)) +
-                         strainD_til(3, ii) * 2.0 * beta(7) * beta(8) +
-                         strainD_til(4, ii) * (beta(2) * beta(7) + beta(1) * beta(8)) +
-                         strainD_til(5, ii) * (beta(5) * beta(7) + beta(4) * beta(8));
-    }
-
-    /// Gd : Jacobian (w.r.t. coordinates) of the initial position vector gradient matrix
-    ChMatrixNM<double, 9, 24> Gd;
-    Gd.setZero();
-
-    for (int ii = 0; ii < 8; ii++) {
-        Gd(0, 3 * ii) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-        Gd(1, 3 * ii + 1) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-        Gd(2, 3 * ii + 2) = j0(0, 0) * Nx(0, ii) + j0(1, 0) * Ny(0, ii) + j0(2, 0) * Nz(0, ii);
-
-        Gd(3, 3 * ii) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-        Gd(4, 3 * ii + 1) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-        Gd(5, 3 * ii + 2) = j0(0, 1) * Nx(0, ii) + j0(1, 1) * Ny(0, ii) + j0(2, 1) * Nz(0, ii);
-
-        Gd(6, 3 * ii) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-        Gd(7, 3 * ii + 1) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-        Gd(8, 3 * ii + 2) = j0(0, 2) * Nx(0, ii) + j0(1, 2) * Ny(0, ii) + j0(2, 2) * Nz(0, ii);
-    }
-
-    // Enhanced Assumed Strain 2nd
-    strain += strain_EAS;
-
-    // Structural damping
-    // Strain time derivative for structural damping
-    ChVectorN<double, 6> DEPS;
-    DEPS.setZero();
-    for (int ii = 0; ii < 24; ii++) {
-        DEPS(0) += strainD(0, ii) * m_element->m_d_dt(ii);
-        DEPS(1) += strainD(1, ii) * m_element->m_d_dt(ii);
-        DEPS(2) += strainD(2, ii) * m_element->m_d_dt(ii);
-        DEPS(3) += strainD(3, ii) * m_element->m_d_dt(ii);
-        DEPS(4) += strainD(4, ii) * m_element->m_d_dt(ii);
-        DEPS(5) += strainD(5, ii) * m_element->m_d_dt(ii);
-    }
-
-    // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
-
-    // Matrix of elastic coefficients: The input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
-
-    // Stress tensor calculation
-    ChVectorN<double, 6> stress = E_eps * strain;
-
-    // Declaration and computation of Sigm, to be removed
-    ChMatrixNM<double, 9, 9> Sigm;  ///< Rearrangement of stress vector (not always needed)
-    Sigm.setZero();
-
-    Sigm(0, 0) = stress(0);  // XX
-    Sigm(1, 1) = stress(0);
-    Sigm(2, 2) = stress(0);
-
-    Sigm(0, 3) = stress(2);  // XY
-    Sigm(1, 4) = stress(2);
-    Sigm(2, 5) = stress(2);
-
-    Sigm(0, 6) = stress(4);  // XZ
-    Sigm(1, 7) = stress(4);
-    Sigm(2, 8) = stress(4);
-
-    Sigm(3, 0) = stress(2);  // XY
-    Sigm(4, 1) = stress(2);
-    Sigm(5, 2) = stress(2);
-
-    Sigm(3, 3) = stress(1);  // YY
-    Sigm(4, 4) = stress(1);
-    Sigm(5, 5) = stress(1);
-
-    Sigm(3, 6) = stress(5);  // YZ
-    Sigm(4, 7) = stress(5);
-    Sigm(5, 8) = stress(5);
-
-    Sigm(6, 0) = stress(4);  // XZ
-    Sigm(7, 1) = stress(4);
-    Sigm(8, 2) = stress(4);
-
-    Sigm(6, 3) = stress(5);  // YZ
-    Sigm(7, 4) = stress(5);
-    Sigm(8, 5) = stress(5);
-
-    Sigm(6, 6) = stress(3);  // ZZ
-    Sigm(7, 7) = stress(3);
-    Sigm(8, 8) = stress(3);
-
-    // Jacobian of internal forces (excluding the EAS contribution).
-    ChMatrixNM<double, 24, 24> KTE;
-    KTE = (strainD.transpose() * E_eps * strainD) * (m_Kfactor + m_Rfactor * m_element->m_Alpha) +
-          (Gd.transpose() * Sigm * Gd) * m_Kfactor;
-    KTE *= detJ0 * m_element->m_GaussScaling;
-
-    // EAS cross-dependency matrix.
-    ChMatrixNM<double, 5, 24> GDEPSP = (G.transpose() * E_eps * strainD) * (detJ0 * m_element->m_GaussScaling);
-
-    // Load result vector (integrand)
-    result.segment(0, 24 * 24) = Eigen::Map<ChVectorN<double, 24 * 24>>(KTE.data(), 24 * 24);
-    result.segment(576, 5 * 24) = Eigen::Map<ChVectorN<double, 5 * 24>>(GDEPSP.data(), 5 * 24);
-}
-
 void ChElementShellANCF::ComputeInternalJacobians(double Kfactor, double Rfactor) {
     // Note that the matrices with current nodal coordinates and velocities are
     // already available in m_d and m_d_dt (as set in ComputeInternalForces).
@@ -984,22 +573,51 @@ void ChElementShellANCF::ComputeInternalJacobians(double Kfactor, double Rfactor
 
     // Loop over all layers.
     for (size_t kl = 0; kl < m_numLayers; kl++) {
-        ShellANCF_Jacobian formula(this, Kfactor, Rfactor, kl);
-        ChVectorN<double, 696> result;
-        result.setZero();
-        ChQuadrature::Integrate3D<ChVectorN<double, 696>>(result,                          // result of integration
-                                                          formula,                         // integrand formula
-                                                          -1, 1,                           // x limits
-                                                          -1, 1,                           // y limits
-                                                          m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                          2                                // order of integration
-        );
+        const GaussPoint* gps = &m_gaussPoints[8 * kl];
+
+        // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
+        const ChMatrixNM<double, 6, 6>& E_eps = m_layers[kl].GetMaterial()->Get_E_eps();
 
-        // Extract matrices from result of integration
+        // Jacobian of internal forces (excluding the EAS contribution) and EAS cross-dependency matrix
         ChMatrixNM<double, 24, 24> KTE;
         ChMatrixNM<double, 5, 24> GDEPSP;
-        KTE = Eigen::Map<ChMatrixNM<double, 24, 24>>(result.segment(0, 24 * 24).data(), 24, 24);
-        GDEPSP = Eigen::Map<ChMatrixNM<double, 5, 24>>(result.segment(576, 5 * 24).data(), 5, 24);
+        KTE.setZero();
+        GDEPSP.setZero();
+
+        for (int ip = 0; ip < 8; ip++) {
+            const GaussPoint& gp = gps[ip];
+
+            ChVectorN<double, 6> strain;
+            ChMatrixNM<double, 6, 24> strainD;
+            ComputeStrain(gp, strain, strainD);
+
+            // Enhanced Assumed Strain
+            strain += gp.G * m_alphaEAS[kl];
+
+            // Stress tensor calculation
+            ChVectorN<double, 6> stress = E_eps * strain;
+            ChMatrix33<> Sigm;
+            Sigm << stress(0), stress(2), stress(4),  // XX XY XZ
+                stress(2), stress(1), stress(5),      // XY YY YZ
+                stress(4), stress(5), stress(3);      // XZ YZ ZZ
+
+            // Material and damping contributions
+            ChMatrixNM<double, 6, 24> EstrainD = E_eps * strainD;
+            KTE += (strainD.transpose() * EstrainD) * ((Kfactor + Rfactor * m_Alpha) * gp.weight);
+            GDEPSP += (gp.G.transpose() * EstrainD) * gp.weight;
+
+            // Geometric stiffness contribution, Gd' * (Sigm x I3) * Gd, where Gd (the Jacobian of the position
+            // vector gradient w.r.t. the coordinates) interpolates each coordinate direction with dN0. The result is
+            // the same 8x8 block for each coordinate direction.
+            ChMatrixNM<double, 8, 8> KG = (gp.dN0.transpose() * Sigm * gp.dN0) * (Kfactor * gp.weight);
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    KTE(3 * i + 0, 3 * j + 0) += KG(i, j);
+                    KTE(3 * i + 1, 3 * j + 1) += KG(i, j);
+                    KTE(3 * i + 2, 3 * j + 2) += KG(i, j);
+                }
+            }
+        }
 
         // Include EAS contribution to the stiffness component (hence scaled by Kfactor)
         // EAS = GDEPSP' * KalphaEAS_inv * GDEPSP
@@ -88,8 +88,6 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
         friend class ChElementShellANCF;
-        friend class ShellANCF_Force;
-        friend class ShellANCF_Jacobian;
     };
 
     /// Get the number of nodes used by this element.
@@ -350,10 +348,32 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
     virtual ChVector<> ComputeNormal(const double U, const double V) override;
 
   private:
+    /// Quantities at a Gauss point of a layer that only depend on the initial configuration.
+    struct GaussPoint {
+        ShapeVector N;                   ///< shape functions
+        ShapeVector Nx;                  ///< shape function derivatives w.r.t. x
+        ShapeVector Ny;                  ///< shape function derivatives w.r.t. y
+        ChMatrixNM<double, 3, 8> dN0;    ///< shape function derivatives w.r.t. the initial configuration coordinates
+        ChMatrixNM<double, 1, 4> S_ANS;  ///< ANS shape functions
+        ChVectorN<double, 9> beta;       ///< coefficients of contravariant transformation
+        ChMatrixNM<double, 6, 5> G;      ///< EAS interpolation matrix
+        ChVectorN<double, 3> strain0;    ///< in-plane strain terms of the initial configuration
+        double weight;                   ///< integration weight (including detJ0 and the interval scaling)
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    };
+
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
 
+    /// Precompute the Gauss point data of all layers (called in SetupInitial).
+    void ComputeGaussPoints();
+
+    /// Calculate the strain (including structural damping, but not EAS) and the strain derivatives at the specified
+    /// Gauss point, for the current nodal coordinates and velocities.
+    void ComputeStrain(const GaussPoint& gp, ChVectorN<double, 6>& strain, ChMatrixNM<double, 6, 24>& strainD);
+
     //// RADU
     //// Why is m_d_dt inconsistent with m_d?  Why not keep it as an 8x3 matrix?
 
@@ -379,6 +399,7 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
     ChMatrixNM<double, 8, 24> m_strainANS_D;            ///< ANS strain derivatives
     std::vector<ChVectorN<double, 5>> m_alphaEAS;       ///< EAS parameters (5 per layer)
     std::vector<ChMatrixNM<double, 5, 5>> m_KalphaEAS;  ///< EAS Jacobians (a 5x5 matrix per layer)
+    std::vector<GaussPoint, Eigen::aligned_allocator<GaussPoint>> m_gaussPoints;  ///< Gauss point data (8 per layer)
     static const double m_toleranceEAS;                 ///< tolerance for nonlinear EAS solver (on residual)
     static const int m_maxIterationsEAS;                ///< maximum number of nonlinear EAS iterations
 
@@ -387,8 +408,6 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
 
     friend class ShellANCF_Mass;
     friend class ShellANCF_Gravity;
-    friend class ShellANCF_Force;
-    friend class ShellANCF_Jacobian;
 };
 
 /// @} fea_elements
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "chrono/core/ChMath.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
@@ -47,6 +48,10 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    load_mode = other.load_mode;
+    coloring_threshold = other.coloring_threshold;
+    coloring_stale = true;
 }
 
 void ChMesh::SetupInitial() {
@@ -65,6 +70,10 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    //    - partition the elements for parallel loading of their contributions
+    coloring.Update(velements);
+    coloring_stale = false;
 }
 
 void ChMesh::Relax() {
@@ -94,6 +103,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    coloring_stale = true;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -104,6 +114,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 
 void ChMesh::ClearElements() {
     velements.clear();
+    coloring_stale = true;
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -114,6 +125,7 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    coloring_stale = true;
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -267,6 +279,71 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
 	}
 }
 
+template <class LoadFunction>
+void ChMesh::LoadElementContributions(const unsigned int off, ChVectorDynamic<>& R, LoadFunction load) {
+    int nthreads = GetSystem()->nthreads_chrono;
+    int nelements = (int)velements.size();
+
+    if (nthreads <= 1 || nelements < 2) {
+        for (int ie = 0; ie < nelements; ie++)
+            load(*velements[ie], R);
+        return;
+    }
+
+    bool use_coloring = load_mode == ParallelLoadMode::COLORING ||
+                        (load_mode == ParallelLoadMode::AUTOMATIC && velements.size() >= coloring_threshold);
+
+    if (use_coloring) {
+        // Elements of the same color do not share nodes and write to R concurrently.
+        // Colors are processed in sequence (implicit barrier at the end of each omp for).
+        if (coloring_stale) {
+            coloring.Update(velements);
+            coloring_stale = false;
+        }
+        const auto& elements = coloring.GetElements();
+        int ncolors = coloring.GetNumColors();
+#pragma omp parallel num_threads(nthreads)
+        for (int color = 0; color < ncolors; color++) {
+            int start = (int)coloring.GetColorStart(color);
+            int end = (int)coloring.GetColorEnd(color);
+#pragma omp for schedule(dynamic, 4)
+            for (int i = start; i < end; i++)
+                load(*velements[elements[i]], R);
+        }
+        for (auto ie : coloring.GetSequentialElements())
+            load(*velements[ie], R);
+        return;
+    }
+
+    // Each thread loads its elements into a private buffer; buffers are then summed into R.
+    // Elements write at the global offsets of their nodes, so the buffers have the length of R, but only the range
+    // of the mesh DOFs [off, off + n_dofs_w) is cleared and summed. Buffers are only reallocated if R changes size.
+    if ((int)thread_loads.size() < nthreads)
+        thread_loads.resize(nthreads);
+    int size = (int)R.size();
+    int start = (int)off;
+    int end = (int)(off + n_dofs_w);
+#pragma omp parallel num_threads(nthreads)
+    {
+        int nteam = ChOMP::GetNumThreads();
+        ChVectorDynamic<>& buffer = thread_loads[ChOMP::GetThreadNum()];
+        buffer.resize(size);
+        buffer.segment(start, end - start).setZero();
+
+#pragma omp for schedule(dynamic, 4)
+        for (int ie = 0; ie < nelements; ie++)
+            load(*velements[ie], buffer);
+
+#pragma omp for schedule(static)
+        for (int i = start; i < end; i++) {
+            double sum = 0;
+            for (int t = 0; t < nteam; t++)
+                sum += thread_loads[t](i);
+            R(i) += sum;
+        }
+    }
+}
+
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
     // nodes applied forces
     unsigned int local_off_v = 0;
@@ -277,25 +354,20 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
         }
     }
 
-    int nthreads = GetSystem()->nthreads_chrono;
-
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
-    }
+    LoadElementContributions(off, R, [c](ChElementBase& element, ChVectorDynamic<>& load) {
+        element.EleIntLoadResidual_F(load, c);
+    });
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
-        }
+        ChVector<> G_acc = GetSystem()->Get_G_acc();
+        LoadElementContributions(off, R, [&G_acc, c](ChElementBase& element, ChVectorDynamic<>& load) {
+            element.EleIntLoadResidual_F_gravity(load, G_acc, c);
+        });
     }
 
     // nodes gravity forces
@@ -358,9 +430,9 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    LoadElementContributions(off, R, [&w, c](ChElementBase& element, ChVectorDynamic<>& load) {
+        element.EleIntLoadResidual_Mv(load, w, c);
+    });
 }
 
 void ChMesh::IntToDescriptor(const unsigned int off_v,
@@ -23,6 +23,7 @@
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementColoring.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -38,6 +39,14 @@ namespace fea {
 /// Class which defines a mesh of finite elements of class ChElementBase,
 /// between nodes of class ChNodeFEAbase.
 class ChApi ChMesh : public ChIndexedNodes {
+  public:
+    /// Strategy for avoiding write conflicts between elements that share nodes, when element contributions
+    /// (internal forces, gravity loads, M*v products) are loaded in parallel into a global vector.
+    enum class ParallelLoadMode {
+        AUTOMATIC,      ///< per-thread buffers for small meshes, coloring for large meshes
+        COLORING,       ///< concurrently processed elements never share nodes (see ChElementColoring)
+        THREAD_BUFFERS  ///< each thread loads into its own buffer, then buffers are summed
+    };
 
   private:
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
@@ -57,6 +66,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    ParallelLoadMode load_mode;                   ///< strategy for parallel loading of element contributions
+    unsigned int coloring_threshold;              ///< minimum number of elements for coloring in AUTOMATIC mode
+    ChElementColoring coloring;                   ///< element coloring
+    bool coloring_stale;                          ///< true if the coloring must be updated
+    std::vector<ChVectorDynamic<>> thread_loads;  ///< per-thread buffers
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -64,7 +79,10 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          load_mode(ParallelLoadMode::AUTOMATIC),
+          coloring_threshold(2000),
+          coloring_stale(true) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -120,6 +138,20 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Set the strategy for loading element contributions in parallel (default: AUTOMATIC).
+    /// With COLORING, the elements of each color (which do not share nodes) are processed concurrently, one color
+    /// after the other. With THREAD_BUFFERS, each thread loads its elements into a private buffer, and the mesh DOFs of
+    /// the buffers are then summed; this requires more memory and a reduction pass, but no synchronization between
+    /// colors, and is preferable for small meshes. AUTOMATIC selects COLORING for meshes with at least the number of
+    /// elements set with SetColoringThreshold, and THREAD_BUFFERS otherwise.
+    void SetParallelLoadMode(ParallelLoadMode mode) { load_mode = mode; }
+
+    /// Set the minimum number of elements for which the AUTOMATIC parallel load mode uses coloring (default: 2000).
+    void SetColoringThreshold(unsigned int num_elements) { coloring_threshold = num_elements; }
+
+    /// Get the element coloring (updated at initial setup and whenever elements are added or removed).
+    const ChElementColoring& GetElementColoring() const { return coloring; }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -271,6 +303,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
 
   private:
+    /// Load the contributions of all elements into the global vector R, using the given function.
+    /// Elements are processed in parallel, according to the parallel load mode.
+    /// 'off' is the offset of the mesh DOFs in R.
+    template <class LoadFunction>
+    void LoadElementContributions(const unsigned int off, ChVectorDynamic<>& R, LoadFunction load);
+
     /// Initial setup (before analysis).
     /// This function is called from ChSystem::SetupInitial, marking a point where system
     /// construction is completed.
@@ -40,10 +40,14 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 
+#include "chrono/core/ChMappedFile.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
 namespace chrono {
@@ -943,6 +947,215 @@ bool ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// Binary mesh format and shared mesh cache
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Layout of a binary mesh file: a header, followed by the vertex, normal, UV, and color arrays, and by the vertex,
+// normal, UV, and color face index arrays (in this order). Each array is padded to a multiple of 8 bytes.
+struct BinaryMeshHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t counts[8];
+};
+
+const char binary_mesh_magic[8] = {'C', 'H', 'M', 'E', 'S', 'H', '\0', '\0'};
+const uint32_t binary_mesh_version = 1;
+const uint32_t binary_mesh_byte_order = 0x01020304;
+
+uint64_t PaddedSize(uint64_t num_bytes) {
+    return (num_bytes + 7) & ~uint64_t(7);
+}
+
+template <typename T>
+void WriteArray(std::ofstream& ofile, const std::vector<ChVector<T>>& v) {
+    static_assert(sizeof(ChVector<T>) == 3 * sizeof(T), "ChVector must be stored as 3 contiguous components");
+    static const char padding[8] = {};
+    uint64_t num_bytes = v.size() * sizeof(ChVector<T>);
+    ofile.write(reinterpret_cast<const char*>(v.data()), num_bytes);
+    ofile.write(padding, PaddedSize(num_bytes) - num_bytes);
+}
+
+template <typename T>
+bool ReadArray(const ChMappedFile& file, uint64_t& offset, uint64_t count, std::vector<ChVector<T>>& v) {
+    const ChVector<T>* data = file.Get<ChVector<T>>(offset, count);
+    if (!data)
+        return false;
+    v.assign(data, data + count);
+    offset += PaddedSize(count * sizeof(ChVector<T>));
+    return true;
+}
+
+bool CheckIndices(const std::vector<ChVector<int>>& indices, size_t num_entries) {
+    int n = (int)num_entries;
+    for (const auto& i : indices) {
+        if (i.x() < 0 || i.x() >= n || i.y() < 0 || i.y() >= n || i.z() < 0 || i.z() >= n)
+            return false;
+    }
+    return true;
+}
+
+bool IsBinaryMesh(const ChMappedFile& file) {
+    return file.GetSize() >= sizeof(binary_mesh_magic) &&
+           std::memcmp(file.GetData(), binary_mesh_magic, sizeof(binary_mesh_magic)) == 0;
+}
+
+bool ReadBinaryMesh(const ChMappedFile& file, ChTriangleMeshConnected& mesh) {
+    const BinaryMeshHeader* header = file.Get<BinaryMeshHeader>(0, 1);
+    if (!header || !IsBinaryMesh(file) || header->version != binary_mesh_version ||
+        header->byte_order != binary_mesh_byte_order)
+        return false;
+
+    uint64_t offset = sizeof(BinaryMeshHeader);
+    const uint64_t* counts = header->counts;
+    return ReadArray(file, offset, counts[0], mesh.m_vertices) &&
+           ReadArray(file, offset, counts[1], mesh.m_normals) &&
+           ReadArray(file, offset, counts[2], mesh.m_UV) &&
+           ReadArray(file, offset, counts[3], mesh.m_colors) &&
+           ReadArray(file, offset, counts[4], mesh.m_face_v_indices) &&
+           ReadArray(file, offset, counts[5], mesh.m_face_n_indices) &&
+           ReadArray(file, offset, counts[6], mesh.m_face_uv_indices) &&
+           ReadArray(file, offset, counts[7], mesh.m_face_col_indices) &&
+           CheckIndices(mesh.m_face_v_indices, mesh.m_vertices.size()) &&
+           CheckIndices(mesh.m_face_n_indices, mesh.m_normals.size()) &&
+           CheckIndices(mesh.m_face_uv_indices, mesh.m_UV.size()) &&
+           CheckIndices(mesh.m_face_col_indices, mesh.m_colors.size());
+}
+
+// 64-bit FNV-1a hash of the file contents, processed in 8-byte words (the file data is 8-byte aligned).
+uint64_t HashContents(const ChMappedFile& file) {
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+    size_t num_words = file.GetSize() / sizeof(uint64_t);
+    const uint64_t* words = file.Get<uint64_t>(0, num_words);
+    for (size_t i = 0; i < num_words; i++) {
+        hash ^= words[i];
+        hash *= prime;
+    }
+    const unsigned char* tail = reinterpret_cast<const unsigned char*>(file.GetData());
+    for (size_t i = num_words * sizeof(uint64_t); i < file.GetSize(); i++) {
+        hash ^= tail[i];
+        hash *= prime;
+    }
+    return hash;
+}
+
+// Process-wide cache of shared meshes, keyed by the hash and size of the file contents and by the load flags.
+struct SharedMeshCache {
+    typedef std::tuple<uint64_t, uint64_t, bool, bool> Key;
+    std::mutex mutex;
+    std::map<Key, std::shared_ptr<ChTriangleMeshConnected>> meshes;
+};
+
+SharedMeshCache& GetSharedMeshCache() {
+    static SharedMeshCache cache;
+    return cache;
+}
+
+}  // end anonymous namespace
+
+bool ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename) {
+    ChMappedFile file(filename);
+    ChTriangleMeshConnected mesh;
+    if (!ReadBinaryMesh(file, mesh)) {
+        std::cerr << "Error loading binary mesh file " << filename << std::endl;
+        return false;
+    }
+
+    m_vertices = std::move(mesh.m_vertices);
+    m_normals = std::move(mesh.m_normals);
+    m_UV = std::move(mesh.m_UV);
+    m_colors = std::move(mesh.m_colors);
+    m_face_v_indices = std::move(mesh.m_face_v_indices);
+    m_face_n_indices = std::move(mesh.m_face_n_indices);
+    m_face_uv_indices = std::move(mesh.m_face_uv_indices);
+    m_face_col_indices = std::move(mesh.m_face_col_indices);
+    m_filename = filename;
+
+    return true;
+}
+
+bool ChTriangleMeshConnected::WriteBinaryMesh(const std::string& filename) const {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile)
+        return false;
+
+    BinaryMeshHeader header = {};
+    std::memcpy(header.magic, binary_mesh_magic, sizeof(binary_mesh_magic));
+    header.version = binary_mesh_version;
+    header.byte_order = binary_mesh_byte_order;
+    header.counts[0] = m_vertices.size();
+    header.counts[1] = m_normals.size();
+    header.counts[2] = m_UV.size();
+    header.counts[3] = m_colors.size();
+    header.counts[4] = m_face_v_indices.size();
+    header.counts[5] = m_face_n_indices.size();
+    header.counts[6] = m_face_uv_indices.size();
+    header.counts[7] = m_face_col_indices.size();
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    WriteArray(ofile, m_vertices);
+    WriteArray(ofile, m_normals);
+    WriteArray(ofile, m_UV);
+    WriteArray(ofile, m_colors);
+    WriteArray(ofile, m_face_v_indices);
+    WriteArray(ofile, m_face_n_indices);
+    WriteArray(ofile, m_face_uv_indices);
+    WriteArray(ofile, m_face_col_indices);
+
+    return ofile.good();
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::LoadShared(const std::string& filename,
+                                                                             bool load_normals,
+                                                                             bool load_uv) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+
+    ChMappedFile file(filename);
+    if (!file.IsValid()) {
+        std::cerr << "Error loading mesh file " << filename << std::endl;
+        return mesh;
+    }
+    SharedMeshCache::Key key(HashContents(file), file.GetSize(), load_normals, load_uv);
+
+    // The lock is also held while loading the mesh, as the Wavefront parser is not reentrant.
+    SharedMeshCache& cache = GetSharedMeshCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.meshes.find(key);
+    if (it != cache.meshes.end())
+        return it->second;
+
+    if (IsBinaryMesh(file)) {
+        if (!ReadBinaryMesh(file, *mesh)) {
+            std::cerr << "Error loading binary mesh file " << filename << std::endl;
+            return chrono_types::make_shared<ChTriangleMeshConnected>();
+        }
+        mesh->m_filename = filename;
+        if (!load_normals) {
+            mesh->m_normals.clear();
+            mesh->m_face_n_indices.clear();
+        }
+        if (!load_uv) {
+            mesh->m_UV.clear();
+            mesh->m_face_uv_indices.clear();
+        }
+    } else if (!mesh->LoadWavefrontMesh(filename, load_normals, load_uv)) {
+        return mesh;
+    }
+
+    cache.meshes.emplace(key, mesh);
+    return mesh;
+}
+
+void ChTriangleMeshConnected::ClearSharedMeshes() {
+    SharedMeshCache& cache = GetSharedMeshCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.meshes.clear();
+}
+
 // Write the specified meshes in a Wavefront .obj file
 void ChTriangleMeshConnected::WriteWavefront(const std::string& filename,
                                              std::vector<ChTriangleMeshConnected>& meshes) {
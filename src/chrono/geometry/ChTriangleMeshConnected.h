@@ -18,6 +18,7 @@
 #include <array>
 #include <cmath>
 #include <map>
+#include <memory>
 
 #include "chrono/geometry/ChTriangleMesh.h"
 
@@ -62,6 +63,28 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Load a triangle mesh saved as a Wavefront .obj file
     bool LoadWavefrontMesh(std::string filename, bool load_normals = true, bool load_uv = false);
 
+    /// Load a triangle mesh saved in the Chrono binary mesh format (see WriteBinaryMesh).
+    /// The file is memory-mapped where supported, and its arrays are copied without any parsing.
+    bool LoadBinaryMesh(const std::string& filename);
+
+    /// Write this mesh in the Chrono binary mesh format.
+    /// The file stores all vertex and face index arrays in native byte order; it can only be read on machines with the
+    /// same byte order (this is checked at load time).
+    bool WriteBinaryMesh(const std::string& filename) const;
+
+    /// Return a mesh loaded from the specified file (Wavefront .obj or Chrono binary mesh format), shared with all
+    /// other callers that load a file with the same contents and flags.
+    /// Loaded meshes are kept in a process-wide cache, keyed by a hash of the file contents, so that identical files
+    /// are parsed only once. The returned mesh is shared and must not be modified; to transform it, work on a copy.
+    /// If the file cannot be loaded, an empty mesh is returned (and not cached). This function is thread-safe.
+    static std::shared_ptr<ChTriangleMeshConnected> LoadShared(const std::string& filename,
+                                                               bool load_normals = true,
+                                                               bool load_uv = false);
+
+    /// Release all meshes held by the shared mesh cache.
+    /// Meshes still in use elsewhere remain valid, but will not be returned by subsequent calls to LoadShared.
+    static void ClearSharedMeshes();
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, std::vector<ChTriangleMeshConnected>& meshes);
 
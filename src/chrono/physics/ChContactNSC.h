@@ -122,6 +122,10 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactForce() const override { return react_force; }
 
+    /// Set the contact force, in contact coordinate system.
+    /// This is used as initial guess for the contact reactions, if the solver is warm started.
+    void SetContactForce(const ChVector<>& force) { react_force = force; }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
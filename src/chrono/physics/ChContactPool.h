@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Pooled storage for contact objects of a given type.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Pool of contact objects of type Tcont, stored in contiguous fixed-size blocks.
+/// Contact objects are constructed in place inside the pool blocks and are never moved, so that pointers to them
+/// (e.g. constraints referenced by the system descriptor) remain valid for their lifetime. Between collision
+/// detection passes, the pool is rewound and the previously constructed contacts are reinitialized in order,
+/// avoiding per-contact heap allocations and keeping contacts of the same type adjacent in memory.
+/// Iterators dereference to Tcont*, so that the pool can be traversed like a list of contact pointers.
+template <class Tcont, unsigned int BLOCK_BITS = 7>
+class ChContactPool {
+  public:
+    static const size_t block_size = size_t(1) << BLOCK_BITS;
+
+    /// Forward iterator over the active contacts in the pool.
+    class iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont* const* pointer;
+        typedef Tcont* reference;
+
+        iterator(const ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+
+        Tcont* operator*() const { return m_pool->Get(m_index); }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    ChContactPool() : m_active(0), m_constructed(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { Clear(); }
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_active == 0; }
+
+    /// Return the number of contact slots currently allocated.
+    size_t capacity() const { return m_blocks.size() * block_size; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_active); }
+
+    /// Access the i-th contact in the pool (no range checking).
+    Tcont* Get(size_t i) const { return m_blocks[i >> BLOCK_BITS] + (i & (block_size - 1)); }
+
+    /// Mark all contacts as inactive, without destroying them.
+    /// Subsequent calls to Recycle() return the previously constructed contacts, in order.
+    void Rewind() { m_active = 0; }
+
+    /// Return the next previously constructed (but currently inactive) contact and mark it as active.
+    /// Return nullptr if no such contact exists, in which case a new one must be created with Emplace().
+    /// The caller is responsible for reinitializing the returned contact.
+    Tcont* Recycle() {
+        if (m_active == m_constructed)
+            return nullptr;
+        return Get(m_active++);
+    }
+
+    /// Construct a new contact in place, at the end of the pool, and mark it as active.
+    /// Must only be called if Recycle() returned nullptr.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_active == m_constructed);
+        if (m_constructed == capacity())
+            m_blocks.push_back(m_allocator.allocate(block_size));
+        Tcont* contact = new (Get(m_constructed)) Tcont(std::forward<Args>(args)...);
+        m_constructed++;
+        m_active++;
+        return contact;
+    }
+
+    /// Destroy all constructed contacts beyond the active ones.
+    /// The pool blocks are retained, to be reused at the next insertion pass.
+    void Trim() {
+        while (m_constructed > m_active)
+            Get(--m_constructed)->~Tcont();
+    }
+
+    /// Destroy all contacts and release the pool memory.
+    void Clear() {
+        m_active = 0;
+        Trim();
+        for (auto block : m_blocks)
+            m_allocator.deallocate(block, block_size);
+        m_blocks.clear();
+    }
+
+  private:
+    std::vector<Tcont*> m_blocks;                 ///< pool blocks, each with storage for block_size contacts
+    size_t m_active;                              ///< number of active contacts
+    size_t m_constructed;                         ///< number of constructed contacts (active or not)
+    Eigen::aligned_allocator<Tcont> m_allocator;  ///< allocator for block storage (honors Eigen alignment)
+};
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChContactReactionCache.h"
+
+namespace chrono {
+
+void ChContactReactionCache::Clear() {
+    m_entries.clear();
+    m_heads.clear();
+}
+
+void ChContactReactionCache::Add(ChContactable* objA,
+                                 ChContactable* objB,
+                                 const ChVector<>& pointA_loc,
+                                 const ChVector<>& reaction_abs) {
+    int index = (int)m_entries.size();
+    auto result = m_heads.insert(std::make_pair(Key(objA, objB), index));
+    int next = -1;
+    if (!result.second) {
+        // prepend to the list of entries for this pair of objects
+        next = result.first->second;
+        result.first->second = index;
+    }
+    m_entries.push_back({pointA_loc, reaction_abs, next});
+}
+
+bool ChContactReactionCache::Find(ChContactable* objA,
+                                  ChContactable* objB,
+                                  const ChVector<>& pointA_loc,
+                                  double radius,
+                                  ChVector<>& reaction_abs) const {
+    auto head = m_heads.find(Key(objA, objB));
+    if (head == m_heads.end())
+        return false;
+
+    double min_dist2 = radius * radius;
+    int found = -1;
+    for (int i = head->second; i >= 0; i = m_entries[i].next) {
+        double dist2 = (m_entries[i].point - pointA_loc).Length2();
+        if (dist2 < min_dist2) {
+            min_dist2 = dist2;
+            found = i;
+        }
+    }
+
+    if (found < 0)
+        return false;
+
+    reaction_abs = m_entries[found].reaction;
+    return true;
+}
+
+void ChContactReactionCache::ForEachEntry(const std::function<void(ChContactable* objA,
+                                                                   ChContactable* objB,
+                                                                   const ChVector<>& pointA_loc,
+                                                                   const ChVector<>& reaction_abs)>& func) const {
+    for (const auto& head : m_heads) {
+        for (int i = head.second; i >= 0; i = m_entries[i].next)
+            func(head.first.first, head.first.second, m_entries[i].point, m_entries[i].reaction);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Persistent cache of contact reactions, used to warm start iterative solvers.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_REACTION_CACHE_H
+#define CH_CONTACT_REACTION_CACHE_H
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+
+class ChContactable;
+
+/// Cache of contact reactions from a previous collision detection pass.
+/// Reactions are stored per pair of contactable objects, together with the contact point expressed in the local frame
+/// of the first object (see ChContactable::GetCsysForCollisionModel). A new contact between the same pair of objects
+/// is matched to the closest cached contact point (the contact "feature"), within a matching radius proportional to
+/// the collision envelopes of the two objects. Reactions are stored in the absolute frame, so that they can be
+/// projected onto the contact plane of the new contact, even if the contact normal has changed slightly.
+class ChApi ChContactReactionCache {
+  public:
+    ChContactReactionCache() : m_radius_factor(0.5) {}
+
+    /// Set the matching radius, as a fraction of the collision envelope (default: 0.5).
+    /// A new contact is matched to a cached one only if their contact points, expressed in the local frame of the
+    /// first object, are closer than this fraction of the larger collision envelope of the two collision models.
+    void SetRelativeMatchingRadius(double factor) { m_radius_factor = factor; }
+
+    /// Return the current matching radius, as a fraction of the collision envelope.
+    double GetRelativeMatchingRadius() const { return m_radius_factor; }
+
+    /// Return the number of cached contacts.
+    size_t GetNumEntries() const { return m_entries.size(); }
+
+    /// Remove all cached contacts (the memory is retained for subsequent passes).
+    void Clear();
+
+    /// Cache the reaction of a contact between the two given objects.
+    void Add(ChContactable* objA,            ///< first contactable object
+             ChContactable* objB,            ///< second contactable object
+             const ChVector<>& pointA_loc,   ///< contact point on objA, in the local frame of objA
+             const ChVector<>& reaction_abs  ///< contact reaction, in the absolute frame
+    );
+
+    /// Find the cached reaction of the contact closest to the given contact point.
+    /// Return false if no cached contact between the two objects is within the given distance.
+    bool Find(ChContactable* objA,           ///< first contactable object
+              ChContactable* objB,           ///< second contactable object
+              const ChVector<>& pointA_loc,  ///< contact point on objA, in the local frame of objA
+              double radius,                 ///< matching radius (see SetRelativeMatchingRadius)
+              ChVector<>& reaction_abs       ///< [out] cached contact reaction, in the absolute frame
+    ) const;
+
+    /// Invoke the given function on each cached contact.
+    /// The arguments are the two contactable objects, the contact point on the first object (local frame), and the
+    /// contact reaction (absolute frame).
+    void ForEachEntry(const std::function<void(ChContactable* objA,
+                                               ChContactable* objB,
+                                               const ChVector<>& pointA_loc,
+                                               const ChVector<>& reaction_abs)>& func) const;
+
+  private:
+    typedef std::pair<ChContactable*, ChContactable*> Key;
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            size_t h1 = std::hash<ChContactable*>()(key.first);
+            size_t h2 = std::hash<ChContactable*>()(key.second);
+            return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+        }
+    };
+
+    struct Entry {
+        ChVector<> point;     ///< contact point on first object (local frame)
+        ChVector<> reaction;  ///< contact reaction (absolute frame)
+        int next;             ///< index of next entry for the same pair of objects (-1 if none)
+    };
+
+    double m_radius_factor;                         ///< matching radius, relative to the collision envelope
+    std::vector<Entry> m_entries;                   ///< cached contacts
+    std::unordered_map<Key, int, KeyHash> m_heads;  ///< index of first entry for each pair of objects
+};
+
+}  // end namespace chrono
+
+#endif
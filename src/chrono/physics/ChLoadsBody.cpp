@@ -141,7 +141,7 @@ ChVector<> ChLoadBodyTorque::GetTorque() const {
 ChLoadBodyBody::ChLoadBodyBody(std::shared_ptr<ChBody> mbodyA,
                                std::shared_ptr<ChBody> mbodyB,
                                const ChFrame<>& abs_application)
-    : ChLoadCustomMultiple(mbodyA, mbodyB) {
+    : ChLoadCustomMultiple(mbodyA, mbodyB), use_AD(false) {
     mbodyA->ChFrame::TransformParentToLocal(abs_application, loc_application_A);
     mbodyB->ChFrame::TransformParentToLocal(abs_application, loc_application_B);
 }
@@ -195,6 +195,82 @@ void ChLoadBodyBody::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(9, 3) = (loc_ftorque + loc_torque).eigen();
 }
 
+void ChLoadBodyBody::ComputeJacobian(ChState* state_x,
+                                     ChStateDelta* state_w,
+                                     ChMatrixRef mK,
+                                     ChMatrixRef mR,
+                                     ChMatrixRef mM) {
+    if (!use_AD) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w, mK, mR, mM);
+        return;
+    }
+
+    // Seed the dual numbers. Independent variables 0-11 are the position increments of body A then body B
+    // (translation, then rotation in body coordinates, as in LoadStateIncrement); variables 12-23 are the
+    // speeds of body A then body B (linear velocity, then angular velocity in body coordinates).
+    ChVector<Dual> pos[2];
+    ChQuaternion<Dual> rot[2];
+    ChVector<Dual> pos_dt[2];
+    ChVector<Dual> Wvel_loc[2];
+    for (int ib = 0; ib < 2; ib++) {
+        for (int k = 0; k < 3; k++) {
+            pos[ib][k] = Dual((*state_x)(7 * ib + k), 6 * ib + k);
+            pos_dt[ib][k] = Dual((*state_w)(6 * ib + k), 12 + 6 * ib + k);
+            Wvel_loc[ib][k] = Dual((*state_w)(6 * ib + 3 + k), 12 + 6 * ib + 3 + k);
+        }
+        // rot' = rot * delta, with the derivative of delta w.r.t. the rotation increment being 1/2 at zero increment
+        ChQuaternion<Dual> delta(1, Dual(0, 6 * ib + 3, 0.5), Dual(0, 6 * ib + 4, 0.5), Dual(0, 6 * ib + 5, 0.5));
+        rot[ib] = ChQuaternion<Dual>(ChQuaternion<>(state_x->segment(7 * ib + 3, 4))) * delta;
+    }
+
+    // Absolute motion of the application frames (same as frame_Aw and frame_Bw in ComputeQ)
+    const ChFrame<>* loc_application[2] = {&loc_application_A, &loc_application_B};
+    ChVector<Dual> frame_pos[2];
+    ChQuaternion<Dual> frame_rot[2];
+    ChVector<Dual> frame_pos_dt[2];
+    ChVector<Dual> frame_Wvel_abs[2];
+    for (int ib = 0; ib < 2; ib++) {
+        ChVector<Dual> arm = rot[ib].Rotate(ChVector<Dual>(loc_application[ib]->GetPos()));
+        frame_pos[ib] = pos[ib] + arm;
+        frame_rot[ib] = rot[ib] * ChQuaternion<Dual>(loc_application[ib]->GetRot());
+        frame_Wvel_abs[ib] = rot[ib].Rotate(Wvel_loc[ib]);
+        frame_pos_dt[ib] = pos_dt[ib] + frame_Wvel_abs[ib] % arm;
+    }
+
+    // Relative motion of frame A with respect to frame B (same as rel_AB in ComputeQ)
+    ChVector<Dual> dist = frame_pos[0] - frame_pos[1];
+    ChVector<Dual> rel_pos = frame_rot[1].RotateBack(dist);
+    ChQuaternion<Dual> rel_rot = frame_rot[1].GetConjugate() * frame_rot[0];
+    ChVector<Dual> rel_pos_dt =
+        frame_rot[1].RotateBack(frame_pos_dt[0] - frame_pos_dt[1] - frame_Wvel_abs[1] % dist);
+    ChVector<Dual> rel_Wvel = frame_rot[1].RotateBack(frame_Wvel_abs[0] - frame_Wvel_abs[1]);
+
+    ChVector<Dual> loc_force;
+    ChVector<Dual> loc_torque;
+    if (!ComputeBodyBodyForceTorqueDual(rel_pos, rel_rot, rel_pos_dt, rel_Wvel, loc_force, loc_torque)) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w, mK, mR, mM);
+        return;
+    }
+
+    // Compute Q (same as in ComputeQ)
+    ChVector<Dual> abs_force = frame_rot[1].Rotate(loc_force);
+    ChVector<Dual> abs_torque = frame_rot[1].Rotate(loc_torque);
+    ChVector<Dual> Q[4];
+    Q[0] = -abs_force;
+    Q[1] = rot[0].RotateBack((frame_pos[0] - pos[0]) % -abs_force - abs_torque);
+    Q[2] = abs_force;
+    Q[3] = rot[1].RotateBack((frame_pos[1] - pos[1]) % abs_force + abs_torque);
+
+    // K=-dQ/dx, R=-dQ/dv
+    for (int i = 0; i < 12; i++) {
+        const Dual& Qi = Q[i / 3][i % 3];
+        for (int j = 0; j < 12; j++) {
+            mK(i, j) = -Qi.der[j];
+            mR(i, j) = -Qi.der[12 + j];
+        }
+    }
+}
+
 std::shared_ptr<ChBody> ChLoadBodyBody::GetBodyA() const {
     return std::dynamic_pointer_cast<ChBody>(this->loadables[0]);
 }
@@ -236,6 +312,85 @@ void ChLoadBodyBodyTorque::Update(double time) {
     ChLoadCustomMultiple::Update(time);
 }
 
+// -----------------------------------------------------------------------------
+// Bushing force laws, templated on the scalar type so that they can be used both
+// for computing the load and for computing its jacobians with dual numbers.
+// -----------------------------------------------------------------------------
+
+// Element-wise product.
+template <typename Real>
+static ChVector<Real> ScaleComponents(const ChVector<Real>& v, const ChVector<>& s) {
+    return ChVector<Real>(v.x() * s.x(), v.y() * s.y(), v.z() * s.z());
+}
+
+// Rotation vector (axis * angle, with angle in [-PI, PI]) of a unit quaternion, as obtained from Q_to_AngAxis.
+// Unlike Q_to_AngAxis, this is also differentiable at the null rotation.
+template <typename Real>
+static ChVector<Real> RotationVector(const ChQuaternion<Real>& quat) {
+    // q and -q are the same rotation; the one with e0 >= 0 has its angle in [-PI, PI]
+    ChQuaternion<Real> q = (quat.e0() < 0) ? -quat : quat;
+    ChVector<Real> v(q.e1(), q.e2(), q.e3());
+    Real sin_squared = v.x() * v.x() + v.y() * v.y() + v.z() * v.z();
+    Real k;
+    if (sin_squared > 1e-8) {
+        Real sin_half = sqrt(sin_squared);
+        k = 2.0 * atan2(sin_half, q.e0()) / sin_half;
+    } else {
+        // angle / sin(angle/2), expanded for small angles
+        k = (2.0 - sin_squared / (1.5 * q.e0() * q.e0())) / q.e0();
+    }
+    return v * k;
+}
+
+template <typename Real>
+static ChVector<Real> BushingSphericalForce(const ChVector<Real>& rel_pos,
+                                            const ChVector<Real>& rel_pos_dt,
+                                            const ChVector<>& stiffness,
+                                            const ChVector<>& damping) {
+    return ScaleComponents(rel_pos, stiffness) + ScaleComponents(rel_pos_dt, damping);
+}
+
+template <typename Real>
+static ChVector<Real> BushingMateTorque(const ChQuaternion<Real>& rel_rot,
+                                        const ChVector<Real>& rel_Wvel,
+                                        const ChVector<>& rot_stiffness,
+                                        const ChVector<>& rot_damping) {
+    // small rotations
+    return ScaleComponents(RotationVector(rel_rot), rot_stiffness) + ScaleComponents(rel_Wvel, rot_damping);
+}
+
+template <typename Real>
+static void BushingGenericForceTorque(const ChVector<Real>& rel_pos,
+                                      const ChQuaternion<Real>& rel_rot,
+                                      const ChVector<Real>& rel_pos_dt,
+                                      const ChVector<Real>& rel_Wvel,
+                                      const ChMatrixNM<double, 6, 6>& stiffness,
+                                      const ChMatrixNM<double, 6, 6>& damping,
+                                      const ChFrame<>& neutral_displacement,
+                                      ChVector<Real>& loc_force,
+                                      ChVector<Real>& loc_torque) {
+    // assuming small rotations
+    ChVector<Real> vect_rot = RotationVector(rel_rot * ChQuaternion<Real>(neutral_displacement.GetRot()));
+    Real S[6];
+    Real Sdt[6];
+    for (int k = 0; k < 3; k++) {
+        S[k] = rel_pos[k] + neutral_displacement.GetPos()[k];
+        S[3 + k] = vect_rot[k];
+        Sdt[k] = rel_pos_dt[k];
+        Sdt[3 + k] = rel_Wvel[k];
+    }
+
+    Real F[6];
+    for (int i = 0; i < 6; i++) {
+        F[i] = 0;
+        for (int j = 0; j < 6; j++)
+            F[i] += stiffness(i, j) * S[j] + damping(i, j) * Sdt[j];
+    }
+
+    loc_force = ChVector<Real>(F[0], F[1], F[2]);
+    loc_torque = ChVector<Real>(F[3], F[4], F[5]);
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingSpherical
 // -----------------------------------------------------------------------------
@@ -250,11 +405,21 @@ ChLoadBodyBodyBushingSpherical::ChLoadBodyBodyBushingSpherical(std::shared_ptr<C
 void ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                                                 ChVector<>& loc_force,
                                                                 ChVector<>& loc_torque) {
-    loc_force = rel_AB.GetPos() * stiffness      // element-wise product!
-                + rel_AB.GetPos_dt() * damping;  // element-wise product!
+    loc_force = BushingSphericalForce(rel_AB.GetPos(), rel_AB.GetPos_dt(), stiffness, damping);
     loc_torque = VNULL;
 }
 
+bool ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                                    const ChQuaternion<Dual>& rel_rot,
+                                                                    const ChVector<Dual>& rel_pos_dt,
+                                                                    const ChVector<Dual>& rel_Wvel,
+                                                                    ChVector<Dual>& loc_force,
+                                                                    ChVector<Dual>& loc_torque) {
+    loc_force = BushingSphericalForce(rel_pos, rel_pos_dt, stiffness, damping);
+    loc_torque = ChVector<Dual>(0, 0, 0);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingPlastic
 // -----------------------------------------------------------------------------
@@ -307,6 +472,27 @@ void ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorque(const ChFrameMovin
     loc_torque = VNULL;
 }
 
+bool ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                                  const ChQuaternion<Dual>& rel_rot,
+                                                                  const ChVector<Dual>& rel_pos_dt,
+                                                                  const ChVector<Dual>& rel_Wvel,
+                                                                  ChVector<Dual>& loc_force,
+                                                                  ChVector<Dual>& loc_torque) {
+    // Same as above, with the current plastic deformation (not updated here)
+    loc_force = BushingSphericalForce(rel_pos - ChVector<Dual>(plastic_def), rel_pos_dt, stiffness, damping);
+
+    // A capped force component does not depend on the state
+    for (int k = 0; k < 3; k++) {
+        if (loc_force[k] > yield[k])
+            loc_force[k] = yield[k];
+        if (loc_force[k] < -yield[k])
+            loc_force[k] = -yield[k];
+    }
+
+    loc_torque = ChVector<Dual>(0, 0, 0);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingMate
 // -----------------------------------------------------------------------------
@@ -329,19 +515,18 @@ void ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorque(const ChFrameMoving<>
     ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(rel_AB, loc_force, loc_torque);
 
     // compute local torque using small rotations:
-    ChQuaternion<> rel_rot = rel_AB.GetRot();
-
-    ChVector<> dir_rot;
-    double angle_rot;
-    rel_rot.Q_to_AngAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_C_PI)
-        angle_rot -= CH_C_2PI;
-    if (angle_rot < -CH_C_PI)
-        angle_rot += CH_C_2PI;
-    ChVector<> vect_rot = dir_rot * angle_rot;
+    loc_torque = BushingMateTorque(rel_AB.GetRot(), rel_AB.GetWvel_par(), rot_stiffness, rot_damping);
+}
 
-    loc_torque = vect_rot * rot_stiffness           // element-wise product!
-                 + rel_AB.GetWvel_par() * rot_damping;  // element-wise product!
+bool ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                               const ChQuaternion<Dual>& rel_rot,
+                                                               const ChVector<Dual>& rel_pos_dt,
+                                                               const ChVector<Dual>& rel_Wvel,
+                                                               ChVector<Dual>& loc_force,
+                                                               ChVector<Dual>& loc_torque) {
+    loc_force = BushingSphericalForce(rel_pos, rel_pos_dt, stiffness, damping);
+    loc_torque = BushingMateTorque(rel_rot, rel_Wvel, rot_stiffness, rot_damping);
+    return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -358,30 +543,23 @@ ChLoadBodyBodyBushingGeneric::ChLoadBodyBodyBushingGeneric(std::shared_ptr<ChBod
 void ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                                               ChVector<>& loc_force,
                                                               ChVector<>& loc_torque) {
-    // compute local force & torque (assuming small rotations):
-    ChVectorDynamic<> mF(6);
-    ChVectorDynamic<> mS(6);
-    ChVectorDynamic<> mSdt(6);
-    ChVector<> rel_pos = rel_AB.GetPos() + neutral_displacement.GetPos();
-    ChQuaternion<> rel_rot = rel_AB.GetRot() * neutral_displacement.GetRot();
-    ChVector<> dir_rot;
-    double angle_rot;
-    rel_rot.Q_to_AngAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_C_PI)
-        angle_rot -= CH_C_2PI;
-    if (angle_rot < -CH_C_PI)
-        angle_rot += CH_C_2PI;
-    ChVector<> vect_rot = dir_rot * angle_rot;
-
-    mS.segment(0, 3) = rel_pos.eigen();
-    mS.segment(3, 3) = vect_rot.eigen();
-    mSdt.segment(0, 3) = rel_AB.GetPos_dt().eigen();
-    mSdt.segment(3, 3) = rel_AB.GetWvel_par().eigen();
-
-    mF = stiffness * mS + damping * mSdt;
-
-    loc_force = ChVector<>(mF.segment(0, 3)) - neutral_force;
-    loc_torque = ChVector<>(mF.segment(3, 3)) - neutral_torque;
+    BushingGenericForceTorque(rel_AB.GetPos(), rel_AB.GetRot(), rel_AB.GetPos_dt(), rel_AB.GetWvel_par(), stiffness,
+                              damping, neutral_displacement, loc_force, loc_torque);
+    loc_force -= neutral_force;
+    loc_torque -= neutral_torque;
+}
+
+bool ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                                  const ChQuaternion<Dual>& rel_rot,
+                                                                  const ChVector<Dual>& rel_pos_dt,
+                                                                  const ChVector<Dual>& rel_Wvel,
+                                                                  ChVector<Dual>& loc_force,
+                                                                  ChVector<Dual>& loc_torque) {
+    BushingGenericForceTorque(rel_pos, rel_rot, rel_pos_dt, rel_Wvel, stiffness, damping, neutral_displacement,
+                              loc_force, loc_torque);
+    loc_force -= ChVector<Dual>(neutral_force);
+    loc_torque -= ChVector<Dual>(neutral_torque);
+    return true;
 }
 
 }  // end namespace chrono
@@ -36,6 +36,7 @@
 #ifndef CHLOADSBODY_H
 #define CHLOADSBODY_H
 
+#include "chrono/core/ChDual.h"
 #include "chrono/motion_functions/ChFunction.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChLoad.h"
@@ -164,9 +165,40 @@ class ChApi ChLoadBodyBody : public ChLoadCustomMultiple {
                                             ChVector<>& loc_force,
                                             ChVector<>& loc_torque) = 0;
 
-    // Optional: inherited classes could implement this to avoid the
-    // default numerical computation of jacobians:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Dual number type used for the automatic differentiation of the load: derivatives with respect to
+    /// the 12 position increments and the 12 speeds of the two bodies.
+    typedef ChDual<24> Dual;
+
+    /// Same as ComputeBodyBodyForceTorque, evaluated on dual numbers, for computing exact jacobians.
+    /// The relative motion of loc_application_A with respect to loc_application_B is given by its position,
+    /// rotation, speed and angular velocity, all expressed in loc_application_B (as in rel_AB).
+    /// This must not modify the state of the load.
+    /// Optional: inherited classes can implement this and return true. The default returns false, in which
+    /// case the jacobians are always computed by numerical differentiation.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                const ChQuaternion<Dual>& rel_rot,
+                                                const ChVector<Dual>& rel_pos_dt,
+                                                const ChVector<Dual>& rel_Wvel,
+                                                ChVector<Dual>& loc_force,
+                                                ChVector<Dual>& loc_torque) {
+        return false;
+    }
+
+    /// Enable/disable the computation of the jacobians by forward automatic differentiation (default: false).
+    /// If enabled, and if ComputeBodyBodyForceTorqueDual is implemented, the K and R jacobians are exact and are
+    /// obtained with a single evaluation of the load, instead of one evaluation per perturbed coordinate.
+    void SetAutomaticDifferentiation(bool val) { use_AD = val; }
+    bool GetAutomaticDifferentiation() const { return use_AD; }
+
+    /// Compute the K=-dQ/dx, R=-dQ/dv, M=-dQ/da jacobians.
+    /// Uses automatic differentiation if enabled and supported, numerical differentiation otherwise.
+    /// Called automatically at each Update().
+    virtual void ComputeJacobian(ChState* state_x,       ///< state position to evaluate jacobians
+                                 ChStateDelta* state_w,  ///< state speed to evaluate jacobians
+                                 ChMatrixRef mK,         ///< result dQ/dx
+                                 ChMatrixRef mR,         ///< result dQ/dv
+                                 ChMatrixRef mM          ///< result dQ/da
+                                 ) override;
 
     /// For diagnosis purposes, this can return the actual last computed value of
     /// the applied force, expressed in coordinate system of loc_application_B, assumed applied to body B
@@ -200,6 +232,7 @@ class ChApi ChLoadBodyBody : public ChLoadCustomMultiple {
     ChVector<> locB_torque;       ///< store computed values here
     ChFrameMoving<> frame_Aw;     ///< for results
     ChFrameMoving<> frame_Bw;     ///< for results
+    bool use_AD;                  ///< compute jacobians by automatic differentiation
 
     /// Compute Q, the generalized load. It calls ComputeBodyBodyForceTorque, so in
     /// children classes you do not need to implement it.
@@ -287,6 +320,14 @@ class ChApi ChLoadBodyBodyBushingSpherical : public ChLoadBodyBody {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector<>& loc_force,
                                             ChVector<>& loc_torque) override;
+
+    /// Dual number version of ComputeBodyBodyForceTorque, for automatic differentiation.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                const ChQuaternion<Dual>& rel_rot,
+                                                const ChVector<Dual>& rel_pos_dt,
+                                                const ChVector<Dual>& rel_Wvel,
+                                                ChVector<Dual>& loc_force,
+                                                ChVector<Dual>& loc_torque) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -325,6 +366,14 @@ class ChApi ChLoadBodyBodyBushingPlastic : public ChLoadBodyBodyBushingSpherical
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector<>& loc_force,
                                             ChVector<>& loc_torque) override;
+
+    /// Dual number version of ComputeBodyBodyForceTorque, for automatic differentiation.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                const ChQuaternion<Dual>& rel_rot,
+                                                const ChVector<Dual>& rel_pos_dt,
+                                                const ChVector<Dual>& rel_Wvel,
+                                                ChVector<Dual>& loc_force,
+                                                ChVector<Dual>& loc_torque) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -364,6 +413,14 @@ class ChApi ChLoadBodyBodyBushingMate : public ChLoadBodyBodyBushingSpherical {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector<>& loc_force,
                                             ChVector<>& loc_torque) override;
+
+    /// Dual number version of ComputeBodyBodyForceTorque, for automatic differentiation.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                const ChQuaternion<Dual>& rel_rot,
+                                                const ChVector<Dual>& rel_pos_dt,
+                                                const ChVector<Dual>& rel_Wvel,
+                                                ChVector<Dual>& loc_force,
+                                                ChVector<Dual>& loc_torque) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -432,6 +489,14 @@ class ChApi ChLoadBodyBodyBushingGeneric : public ChLoadBodyBody {
                                             ChVector<>& loc_force,
                                             ChVector<>& loc_torque) override;
 
+    /// Dual number version of ComputeBodyBodyForceTorque, for automatic differentiation.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector<Dual>& rel_pos,
+                                                const ChQuaternion<Dual>& rel_rot,
+                                                const ChVector<Dual>& rel_pos_dt,
+                                                const ChVector<Dual>& rel_Wvel,
+                                                ChVector<Dual>& loc_force,
+                                                ChVector<Dual>& loc_torque) override;
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
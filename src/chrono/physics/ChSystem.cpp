@@ -968,14 +968,25 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // R and Qc vectors  --> solver sparse solver structures  (also sets L and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, L, Qc);
 
+    // Make the Chrono thread count available to multithreaded solvers
+    descriptor->SetNumThreads(nthreads_chrono);
+
+    // Cq matrix.
+    // Always loaded, even if the solver's Setup() is not called, since the constraint objects also provide the
+    // Jacobians used in the residual (see LoadResidual_CqL) at the next Newton iteration.
+    {
+        CH_TRACE("LoadConstraintJacobians");
+        timer_jacobian.start();
+        ConstraintsLoadJacobians();
+        timer_jacobian.stop();
+    }
+
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
-    // fill the sparse system structures with information in G and Cq.
+    // fill the sparse system structures with information in G.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_TRACE("LoadJacobians");
         timer_jacobian.start();
 
-        // Cq  matrix
-        ConstraintsLoadJacobians();
-
         // G matrix: M, K, R components
         if (c_a || c_v || c_x)
             KRMmatricesLoad(-c_x, -c_v, c_a);
@@ -1006,6 +1017,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_TRACE("SolverSetup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1016,9 +1028,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        CH_TRACE("SolverSolve");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and L vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, L);
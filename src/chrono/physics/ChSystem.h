@@ -235,7 +235,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
     ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///                           in SCM deformable terrain calculations, and by multithreaded VI solvers
+    ///                           (see ChSolverPSOR::EnableMultithreading).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
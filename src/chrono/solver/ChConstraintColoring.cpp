@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChConstraintColoring.h"
+
+namespace chrono {
+
+const int ChConstraintColoring::max_colors;
+
+int ChConstraintColoring::GetVariablesIndex(ChVariables* var) {
+    if (!var || !var->IsActive())
+        return -1;
+    auto result = m_var_index.insert(std::make_pair(var, (int)m_var_colors.size()));
+    if (result.second)
+        m_var_colors.push_back(0);
+    return result.first->second;
+}
+
+void ChConstraintColoring::Update(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+
+    m_all_blocks.clear();
+    m_block_colors.clear();
+    m_seq_blocks.clear();
+    m_var_index.clear();
+    m_var_colors.clear();
+
+    // Group the active constraints into blocks, the same way a sequential PSOR sweep does:
+    // every third active friction constraint closes a triplet starting two constraints before.
+    int i_friction_comp = 0;
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            if (++i_friction_comp == 3) {
+                m_all_blocks.push_back({ic - 2, 3});
+                i_friction_comp = 0;
+            }
+        } else {
+            m_all_blocks.push_back({ic, 1});
+        }
+    }
+
+    // Greedy coloring of the blocks, in the order of the constraint list.
+    int num_colors = 0;
+    for (const auto& block : m_all_blocks) {
+        bool colorable = true;
+        m_vars.clear();
+        for (unsigned int k = 0; k < block.size; k++) {
+            if (!mconstraints[block.start + k]->CollectVariables(m_vars)) {
+                colorable = false;
+                break;
+            }
+        }
+
+        int color = -1;
+        if (colorable) {
+            m_block_vars.clear();
+            uint64_t used = 0;
+            for (auto var : m_vars) {
+                int iv = GetVariablesIndex(var);
+                if (iv >= 0) {
+                    m_block_vars.push_back(iv);
+                    used |= m_var_colors[iv];
+                }
+            }
+            // lowest color not yet acting on any of the block variables
+            for (int c = 0; c < max_colors; c++) {
+                if (!(used & (uint64_t(1) << c))) {
+                    color = c;
+                    break;
+                }
+            }
+            if (color >= 0) {
+                for (auto iv : m_block_vars)
+                    m_var_colors[iv] |= (uint64_t(1) << color);
+                num_colors = std::max(num_colors, color + 1);
+            }
+        }
+
+        if (color < 0)
+            m_seq_blocks.push_back(block);
+        m_block_colors.push_back(color);
+    }
+
+    // Sort the colored blocks by color (stable counting sort).
+    m_color_start.assign(num_colors + 1, 0);
+    for (auto color : m_block_colors) {
+        if (color >= 0)
+            m_color_start[color + 1]++;
+    }
+    for (int c = 0; c < num_colors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+
+    m_blocks.resize(m_color_start[num_colors]);
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end() - 1);
+    for (size_t ib = 0; ib < m_all_blocks.size(); ib++) {
+        int color = m_block_colors[ib];
+        if (color >= 0)
+            m_blocks[next[color]++] = m_all_blocks[ib];
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONSTRAINT_COLORING_H
+#define CH_CONSTRAINT_COLORING_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Partition of the active constraints of a system descriptor into colors, for use in multithreaded projected
+/// Gauss-Seidel solvers (e.g., ChSolverPSOR).
+/// Constraints are first grouped into blocks that a PSOR-like solver must process together: a single constraint, or a
+/// triplet of CONSTRAINT_FRIC constraints (normal and two tangential components) which is projected as a whole.
+/// Blocks are then colored greedily, such that no two blocks of the same color act on a common active ChVariables
+/// object. The blocks of one color can therefore be processed concurrently without write conflicts on the variables,
+/// while colors are processed in sequence, so that blocks sharing a variable still see each other's updates.
+/// Inactive variables (e.g., fixed bodies) are never written by the solver and do not introduce conflicts.
+/// Blocks that cannot be colored (too many colors needed, or constraints that do not list their variables) are
+/// collected in a separate list, to be processed sequentially after all colors.
+class ChApi ChConstraintColoring {
+  public:
+    /// A group of consecutive constraints in the descriptor, processed as a unit.
+    struct Block {
+        unsigned int start;  ///< index of the first constraint in the descriptor list
+        unsigned int size;   ///< number of constraints in the block (1, or 3 for a friction triplet)
+    };
+
+    /// Maximum number of colors. Blocks requiring more colors are processed sequentially.
+    /// The colors acting on a variables object are stored in a 64-bit mask, hence at most 64 colors.
+    static const int max_colors = 64;
+
+    ChConstraintColoring() {}
+
+    /// Partition the active constraints of the given descriptor.
+    /// This must be called whenever the set of constraints or their active states change, typically at the beginning
+    /// of each solver call.
+    void Update(ChSystemDescriptor& sysd);
+
+    /// Return the number of colors.
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Return the index (in GetBlocks) of the first block with the given color.
+    unsigned int GetColorStart(int color) const { return m_color_start[color]; }
+
+    /// Return the index (in GetBlocks) past the last block with the given color.
+    unsigned int GetColorEnd(int color) const { return m_color_start[color + 1]; }
+
+    /// Return the list of colored blocks, sorted by color.
+    /// Within a color, blocks are in the order of the descriptor constraint list.
+    const std::vector<Block>& GetBlocks() const { return m_blocks; }
+
+    /// Return the list of blocks that must be processed sequentially.
+    const std::vector<Block>& GetSequentialBlocks() const { return m_seq_blocks; }
+
+  private:
+    /// Return the index of the given variables object in m_var_colors (-1 if inactive).
+    int GetVariablesIndex(ChVariables* var);
+
+    std::vector<Block> m_blocks;                        ///< colored blocks, sorted by color
+    std::vector<Block> m_seq_blocks;                    ///< blocks to be processed sequentially
+    std::vector<unsigned int> m_color_start;            ///< start of each color in m_blocks (plus end marker)
+    std::unordered_map<ChVariables*, int> m_var_index;  ///< index of each active variables object
+    std::vector<uint64_t> m_var_colors;                 ///< bitmask of colors already acting on each variables object
+
+    static_assert(max_colors <= 64, "color bitmask holds at most 64 colors");
+
+    // Scratch data, persistent to avoid reallocations
+    std::vector<Block> m_all_blocks;
+    std::vector<int> m_block_colors;
+    std::vector<ChVariables*> m_vars;
+    std::vector<int> m_block_vars;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -56,6 +56,12 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Access the Nth variable object
     ChVariables* GetVariables_N(size_t n) { return variables[n]; }
 
+    /// Append to 'vars' the variable objects referenced by this constraint.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     void SetVariables(std::vector<ChVariables*> mvars);
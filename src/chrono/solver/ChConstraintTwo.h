@@ -61,6 +61,13 @@ class ChApi ChConstraintTwo : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_b() { return variables_b; }
 
+    /// Append to 'vars' the two variable objects referenced by this constraint.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) override {
+        vars.push_back(variables_a);
+        vars.push_back(variables_b);
+        return true;
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b) = 0;
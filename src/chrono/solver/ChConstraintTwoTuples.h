@@ -60,6 +60,13 @@ class ChConstraintTwoTuples : public ChConstraint {
     /// Access tuple b
     type_constraint_tuple_b& Get_tuple_b() { return tuple_b; }
 
+    /// Append to 'vars' the variable objects referenced by the two tuples.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) override {
+        tuple_a.CollectVariables(vars);
+        tuple_b.CollectVariables(vars);
+        return true;
+    }
+
     virtual void Update_auxiliary() override {
         g_i = 0;
         tuple_a.Update_auxiliary(g_i);
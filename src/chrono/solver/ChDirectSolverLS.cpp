@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
@@ -23,6 +24,7 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_parallel_assembly(true),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -40,6 +42,7 @@ void ChDirectSolverLS::ResetTimers() {
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChDirectSolverLS::Setup");
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
@@ -57,6 +60,11 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
     bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
 
+    // Use parallel assembly if the sparsity pattern is locked and was not just updated, and if the slots of the matrix
+    // elements were recorded at a previous call.
+    bool use_parallel = m_parallel_assembly && m_lock && sysd.GetNumThreads() > 1;
+    bool call_parallel = use_parallel && !call_learner && !call_reserve && !m_slots.IsEmpty();
+
     if (verbose) {
         GetLog() << "Solver setup\n";
         GetLog() << "  call number:    " << m_setup_call << "\n";
@@ -64,6 +72,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         GetLog() << "  pattern locked? " << m_lock << "\n";
         GetLog() << "  CALL learner:   " << call_learner << "\n";
         GetLog() << "  CALL reserve:   " << call_reserve << "\n";
+        GetLog() << "  CALL parallel:  " << call_parallel << "\n";
     }
 
     if (call_learner) {
@@ -77,11 +86,20 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.ConvertToMatrixForm(&m_mat, nullptr);
+    // Let the system descriptor load the current matrix, in parallel if possible.
+    // If parallel assembly fails (the system structure changed), fall back to serial assembly.
+    if (!call_parallel || !sysd.ConvertToMatrixFormParallel(m_mat, m_slots)) {
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
 
-    // Allow the matrix to be compressed
-    m_mat.makeCompressed();
+        // Allow the matrix to be compressed
+        m_mat.makeCompressed();
+
+        // Record the matrix slots for parallel assembly at subsequent calls
+        if (use_parallel)
+            sysd.LearnAssemblySlots(m_mat, m_slots);
+        else
+            m_slots.Reset();
+    }
 
     m_timer_setup_assembly.stop();
 
@@ -109,6 +127,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChDirectSolverLS::Solve");
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -132,6 +151,8 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
                  << "  solve:             " << m_timer_solve_solvercall.GetTimeSecondsIntermediate() << "\n";
     }
 
+    m_solve_call++;
+
     if (!result) {
         // If the solution failed, let the concrete solver display an error message.
         GetLog() << "Solver solve failed\n";
@@ -190,6 +211,8 @@ double ChDirectSolverLS::SolveCurrent() {
                  << "  solve:             " << m_timer_solve_solvercall.GetTimeSecondsIntermediate() << "\n";
     }
 
+    m_solve_call++;
+
     if (!result) {
         // If the solution failed, let the concrete solver display an error message.
         GetLog() << "Solver SolveCurrent() failed\n";
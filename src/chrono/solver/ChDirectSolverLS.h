@@ -92,6 +92,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable parallel assembly of the problem matrix (default: enabled).\n
+    /// Only used if the sparsity pattern is locked and the system descriptor allows more than one thread. The slot of
+    /// each matrix element in the compressed matrix is then recorded once and reused at subsequent calls, so that the
+    /// matrix blocks can be scattered concurrently without locks or sparsity pattern lookups.
+    /// See ChSystemDescriptor::ConvertToMatrixFormParallel.
+    void UseParallelAssembly(bool val) { m_parallel_assembly = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -206,6 +213,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_parallel_assembly;  ///< use parallel assembly (with locked sparsity pattern)?
+    ChAssemblySlots m_slots;   ///< matrix slots of the assembled elements, for parallel assembly
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
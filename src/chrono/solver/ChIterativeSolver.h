@@ -45,7 +45,9 @@ class ChApi ChIterativeSolver {
 
     /// Enable/disable warm starting by providing an initial guess (default: false).\n
     /// If enabled, the solvers use as an initial guess the current values for [x; -lambda].\n
-    /// ATTENTION: enable this option **only** if using the Euler implicit linearized integrator!
+    /// ATTENTION: enable this option **only** if using the Euler implicit linearized integrator!\n
+    /// For NSC contacts, the reactions of persisting contacts are carried over from one step to the next (see
+    /// ChContactContainerNSC::EnableReactionCache).
     void EnableWarmStart(bool val) { m_warm_start = val; }
 
     /// Get the current maximum number of iterations.
@@ -54,6 +56,9 @@ class ChApi ChIterativeSolver {
     /// Get the current tolerance value.
     double GetTolerance() const { return m_tolerance; }
 
+    /// Return true if warm starting is enabled.
+    bool GetWarmStart() const { return m_warm_start; }
+
     /// Return the number of iterations performed during the last solve.
     virtual int GetIterations() const = 0;
 
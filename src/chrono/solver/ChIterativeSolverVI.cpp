@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/utils/ChTracer.h"
+#include "chrono/core/ChMathematics.h"
 
 namespace chrono {
 
@@ -48,6 +50,132 @@ void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalamb
     dlambda_history.push_back(mdeltalambda);
 }
 
+double ChIterativeSolverVI::UpdateBlockPSOR(std::vector<ChConstraint*>& mconstraints,
+                                            const ChConstraintColoring::Block& block,
+                                            bool reverse,
+                                            double& maxdeltalambda) {
+    ChConstraint** constr = &mconstraints[block.start];
+
+    if (block.size == 1) {
+        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+        double mresidual =
+            constr[0]->Compute_Cq_q() + constr[0]->Get_b_i() + constr[0]->Get_cfm_i() * constr[0]->Get_l_i();
+
+        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+        double violation = fabs(constr[0]->Violation(mresidual));
+
+        // update:   lambda += delta_lambda,  with delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+        double old_lambda = constr[0]->Get_l_i();
+        constr[0]->Set_l_i(old_lambda + (m_omega / constr[0]->Get_g_i()) * (-mresidual));
+        constr[0]->Project();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        double new_lambda = constr[0]->Get_l_i();
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            constr[0]->Set_l_i(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+        constr[0]->Increment_q(true_delta);
+
+        if (record_violation_history)
+            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+
+        return violation;
+    }
+
+    // Friction triplet: update the N, U, V components (in reverse order for a backward sweep), then project the
+    // triplet onto the friction cone (the N normal component will take care of N,U,V).
+    double old_lambda[3];
+    double violation = 0;
+    for (unsigned int k = 0; k < 3; k++) {
+        unsigned int i = reverse ? 2 - k : k;
+        double mresidual =
+            constr[i]->Compute_Cq_q() + constr[i]->Get_b_i() + constr[i]->Get_cfm_i() * constr[i]->Get_l_i();
+        old_lambda[i] = constr[i]->Get_l_i();
+        constr[i]->Set_l_i(old_lambda[i] + (m_omega / constr[i]->Get_g_i()) * (-mresidual));
+        if (i == 0)
+            violation = fabs(ChMin(0.0, mresidual));
+    }
+
+    constr[0]->Project();
+
+    for (unsigned int i = 0; i < 3; i++) {
+        double new_lambda = constr[i]->Get_l_i();
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[i];
+            constr[i]->Set_l_i(new_lambda);
+        }
+        double true_delta = new_lambda - old_lambda[i];
+        constr[i]->Increment_q(true_delta);
+
+        if (record_violation_history)
+            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+    }
+
+    return violation;
+}
+
+double ChIterativeSolverVI::SweepColoredPSOR(std::vector<ChConstraint*>& mconstraints,
+                                             const ChConstraintColoring& coloring,
+                                             bool reverse,
+                                             int num_threads,
+                                             double& maxdeltalambda) {
+    const std::vector<ChConstraintColoring::Block>& blocks = coloring.GetBlocks();
+    const std::vector<ChConstraintColoring::Block>& seq_blocks = coloring.GetSequentialBlocks();
+    const int num_colors = coloring.GetNumColors();
+
+    double maxviolation = 0;
+
+    if (reverse) {
+        for (int ib = (int)seq_blocks.size() - 1; ib >= 0; ib--)
+            maxviolation = ChMax(maxviolation, UpdateBlockPSOR(mconstraints, seq_blocks[ib], true, maxdeltalambda));
+    }
+
+    if (num_threads <= 1) {
+        // Same sweep without opening a parallel region
+        for (int c = 0; c < num_colors; c++) {
+            int color = reverse ? num_colors - 1 - c : c;
+            for (unsigned int ib = coloring.GetColorStart(color); ib < coloring.GetColorEnd(color); ib++)
+                maxviolation = ChMax(maxviolation, UpdateBlockPSOR(mconstraints, blocks[ib], reverse, maxdeltalambda));
+        }
+    } else {
+#pragma omp parallel num_threads(num_threads)
+        {
+            CH_TRACE("SweepColoredPSOR");
+            double t_maxviolation = 0;
+            double t_maxdeltalambda = 0;
+
+            for (int c = 0; c < num_colors; c++) {
+                int color = reverse ? num_colors - 1 - c : c;
+                int start = (int)coloring.GetColorStart(color);
+                int end = (int)coloring.GetColorEnd(color);
+
+                // Implicit barrier at the end of each color
+#pragma omp for schedule(static)
+                for (int ib = start; ib < end; ib++) {
+                    double violation = UpdateBlockPSOR(mconstraints, blocks[ib], reverse, t_maxdeltalambda);
+                    t_maxviolation = ChMax(t_maxviolation, violation);
+                }
+            }
+
+#pragma omp critical
+            {
+                maxviolation = ChMax(maxviolation, t_maxviolation);
+                maxdeltalambda = ChMax(maxdeltalambda, t_maxdeltalambda);
+            }
+        }
+    }
+
+    if (!reverse) {
+        for (size_t ib = 0; ib < seq_blocks.size(); ib++)
+            maxviolation = ChMax(maxviolation, UpdateBlockPSOR(mconstraints, seq_blocks[ib], false, maxdeltalambda));
+    }
+
+    return maxviolation;
+}
+
 void ChIterativeSolverVI::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChIterativeSolverVI>();
@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChSolverVI.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChConstraintColoring.h"
 
 namespace chrono {
 
@@ -97,6 +98,25 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note: 'iternum' starts at 0 for the first iteration.
     void AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum);
 
+    /// Perform a projected SOR update of one block of constraints (a single constraint or a friction triplet, see
+    /// ChConstraintColoring), processing the constraints of the block in forward or reverse order.
+    /// Return the constraint violation and update the maximum change in Lagrange multipliers.
+    double UpdateBlockPSOR(std::vector<ChConstraint*>& mconstraints,
+                           const ChConstraintColoring::Block& block,
+                           bool reverse,
+                           double& maxdeltalambda);
+
+    /// Perform one multithreaded projected SOR sweep over all constraints, using the given coloring.
+    /// Colors are processed in sequence (in reverse order, if requested) and the blocks of each color are processed
+    /// concurrently, using the specified number of threads. Blocks that could not be colored are processed last
+    /// (first, for a reverse sweep), sequentially.
+    /// Return the maximum constraint violation and update the maximum change in Lagrange multipliers.
+    double SweepColoredPSOR(std::vector<ChConstraint*>& mconstraints,
+                            const ChConstraintColoring& coloring,
+                            bool reverse,
+                            int num_threads,
+                            double& maxdeltalambda);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverADMM.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/core/ChMathematics.h"
 
 #include "chrono/solver/ChIterativeSolverLS.h"
@@ -48,6 +49,7 @@ ChSolverADMM::ChSolverADMM(std::shared_ptr<ChDirectSolverLS> my_LS_engine) :
 
 
 double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChSolverADMM::Solve");
 
     ChTimer<> m_timer_convert;
     ChTimer<> m_timer_factorize;
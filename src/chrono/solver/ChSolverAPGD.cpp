@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/utils/ChTracer.h"
 
 #include "chrono/core/ChStream.h"
 
@@ -72,6 +73,7 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChSolverAPGD::Solve");
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -25,6 +26,7 @@ ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
 }
 
 double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChSolverPJacobi::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -44,8 +44,21 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable multithreaded iterations (default: false).
+    /// If enabled, the constraints are partitioned into colors (groups of constraints acting on disjoint sets of
+    /// variables) which are processed in sequence, while the constraints within a color are processed concurrently.
+    /// Constraints sharing a body still see each other's updates, as in a Gauss-Seidel sweep, but are processed in a
+    /// different order than in the sequential solver. The number of threads is that set for the system descriptor
+    /// (see ChSystem::SetNumThreads).
+    void EnableMultithreading(bool val) { m_multithreaded = val; }
+
+    /// Return true if multithreaded iterations are enabled.
+    bool IsMultithreaded() const { return m_multithreaded; }
+
   private:
     double maxviolation;
+    bool m_multithreaded;             ///< use the colored multithreaded sweep
+    ChConstraintColoring m_coloring;  ///< partition of the constraints for multithreaded sweeps
 };
 
 /// @} chrono_solver
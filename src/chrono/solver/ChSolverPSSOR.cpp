@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -20,9 +21,10 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSSOR)
 
-ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
+ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0), m_multithreaded(false) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChSolverPSSOR::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -33,9 +35,13 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     const unsigned int nConstr = (unsigned int)mconstraints.size();
     const unsigned int nVars = (unsigned int)mvariables.size();
 
+    // Number of threads for the parallel sections
+    int nthreads = m_multithreaded ? sysd.GetNumThreads() : 1;
+
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-    for (unsigned int ic = 0; ic < nConstr; ic++)
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < (int)nConstr; ic++)
         mconstraints[ic]->Update_auxiliary();
 
     // Average all g_i for the triplet of contact constraints n,u,v.
@@ -57,7 +63,8 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
     // 2)  Compute, for all items with variables, the initial guess for
     //     still unconstrained system:
-    for (unsigned int iv = 0; iv < nVars; iv++)
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1)
+    for (int iv = 0; iv < (int)nVars; iv++)
         if (mvariables[iv]->IsActive())
             mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
 
@@ -73,6 +80,10 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->Set_l_i(0.);
     }
 
+    // Partition the constraints for the multithreaded sweeps
+    if (m_multithreaded)
+        m_coloring.Update(sysd);
+
     // 4)  Perform the iteration loops
     for (int iter = 0; iter < m_max_iterations;) {
         //
@@ -81,195 +92,207 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
         maxviolation = 0;
         maxdeltalambda = 0;
         i_friction_comp = 0;
-        size_t dummy = mconstraints.size();
-        for (size_t ic = 0; ic < dummy; ic++) {
-            // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
-                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
-                                   mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
-
-                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
-
-                // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
-
-                if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
-                    candidate_violation = 0;
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
-                    i_friction_comp++;
-
-                    if (i_friction_comp == 1)
-                        candidate_violation = fabs(ChMin(0.0, mresidual));
-
-                    if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
-
-                        double new_lambda_0 = mconstraints[ic - 2]->Get_l_i();
-                        double new_lambda_1 = mconstraints[ic - 1]->Get_l_i();
-                        double new_lambda_2 = mconstraints[ic - 0]->Get_l_i();
-                        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                        if (m_shlambda != 1.0) {
-                            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
-                            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->Set_l_i(new_lambda_0);
-                            mconstraints[ic - 1]->Set_l_i(new_lambda_1);
-                            mconstraints[ic - 0]->Set_l_i(new_lambda_2);
+        if (m_multithreaded) {
+            maxviolation = SweepColoredPSOR(mconstraints, m_coloring, false, nthreads, maxdeltalambda);
+        } else {
+            size_t dummy = mconstraints.size();
+            for (size_t ic = 0; ic < dummy; ic++) {
+                // skip computations if constraint not active.
+                if (mconstraints[ic]->IsActive()) {
+                    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+                    double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                                       mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
+
+                    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+                    double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+
+                    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+                    double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
+
+                    if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+                        candidate_violation = 0;
+                        // update:   lambda += delta_lambda;
+                        old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
+                        mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
+                        i_friction_comp++;
+
+                        if (i_friction_comp == 1)
+                            candidate_violation = fabs(ChMin(0.0, mresidual));
+
+                        if (i_friction_comp == 3) {
+                            mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
+
+                            double new_lambda_0 = mconstraints[ic - 2]->Get_l_i();
+                            double new_lambda_1 = mconstraints[ic - 1]->Get_l_i();
+                            double new_lambda_2 = mconstraints[ic - 0]->Get_l_i();
+                            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                            if (m_shlambda != 1.0) {
+                                new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+                                new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+                                new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+                                mconstraints[ic - 2]->Set_l_i(new_lambda_0);
+                                mconstraints[ic - 1]->Set_l_i(new_lambda_1);
+                                mconstraints[ic - 0]->Set_l_i(new_lambda_2);
+                            }
+                            double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+                            double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+                            double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+                            mconstraints[ic - 2]->Increment_q(true_delta_0);
+                            mconstraints[ic - 1]->Increment_q(true_delta_1);
+                            mconstraints[ic - 0]->Increment_q(true_delta_2);
+
+                            if (this->record_violation_history) {
+                                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
+                                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
+                                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
+                            }
+                            i_friction_comp = 0;
                         }
-                        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->Increment_q(true_delta_0);
-                        mconstraints[ic - 1]->Increment_q(true_delta_1);
-                        mconstraints[ic - 0]->Increment_q(true_delta_2);
-
-                        if (this->record_violation_history) {
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
-                        }
-                        i_friction_comp = 0;
-                    }
-                } else {
-                    // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda + deltal);
-
-                    // If new lagrangian multiplier does not satisfy inequalities, project
-                    // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
-
-                    // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->Get_l_i();
-
-                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                    if (m_shlambda != 1.0) {
-                        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->Set_l_i(new_lambda);
-                    }
-
-                    double true_delta = new_lambda - old_lambda;
+                    } else {
+                        // update:   lambda += delta_lambda;
+                        double old_lambda = mconstraints[ic]->Get_l_i();
+                        mconstraints[ic]->Set_l_i(old_lambda + deltal);
 
-                    // For all items with variables, add the effect of incremented
-                    // (and projected) lagrangian reactions:
-                    mconstraints[ic]->Increment_q(true_delta);
+                        // If new lagrangian multiplier does not satisfy inequalities, project
+                        // it into an admissible orthant (or, in general, onto an admissible set)
+                        mconstraints[ic]->Project();
 
-                    if (this->record_violation_history)
-                        maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
-                }
+                        // After projection, the lambda may have changed a bit..
+                        double new_lambda = mconstraints[ic]->Get_l_i();
 
-                maxviolation = ChMax(maxviolation, fabs(candidate_violation));
-
-            }  // end IsActive()
-
-        }  // end constraint loop
-
-        // Terminate the loop if violation in constraints has been successfully limited.
-        // if (maxviolation < m_tolerance)
-        //	break;
-
-        // For recording into violation history, if debugging
-        if (this->record_violation_history)
-            AtIterationEnd(maxviolation, maxdeltalambda, iter);
-
-        // Increment iter count (each sweep, either forward or backward, is considered
-        // as a complete iteration, to be fair when comparing to the non-symmetric SOR :)
-        iter++;
-
-        //
-        // Backward sweep, for symmetric SOR
-        //
-        maxviolation = 0.;
-        maxdeltalambda = 0.;
-        i_friction_comp = 0;
-
-        for (int ic = (nConstr - 1); ic >= 0; ic--) {
-            // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
-                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
-                                   mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
-
-                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
-
-                // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
-
-                if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
-                    candidate_violation = 0;
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
-                    i_friction_comp++;
-                    if (i_friction_comp == 3) {
-                        mconstraints[ic]->Project();  // the N normal component will take care of N,U,V
-
-                        double new_lambda_0 = mconstraints[ic + 2]->Get_l_i();
-                        double new_lambda_1 = mconstraints[ic + 1]->Get_l_i();
-                        double new_lambda_2 = mconstraints[ic + 0]->Get_l_i();
                         // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                         if (m_shlambda != 1.0) {
-                            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
-                            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic + 2]->Set_l_i(new_lambda_0);
-                            mconstraints[ic + 1]->Set_l_i(new_lambda_1);
-                            mconstraints[ic + 0]->Set_l_i(new_lambda_2);
-                        }
-                        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic + 2]->Increment_q(true_delta_0);
-                        mconstraints[ic + 1]->Increment_q(true_delta_1);
-                        mconstraints[ic + 0]->Increment_q(true_delta_2);
-
-                        candidate_violation = fabs(ChMin(0.0, mresidual));
-
-                        if (this->record_violation_history) {
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
-                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
+                            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+                            mconstraints[ic]->Set_l_i(new_lambda);
                         }
-                        i_friction_comp = 0;
-                    }
-                } else {
-                    // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->Get_l_i();
-                    mconstraints[ic]->Set_l_i(old_lambda + deltal);
-
-                    // If new lagrangian multiplier does not satisfy inequalities, project
-                    // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
-
-                    // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->Get_l_i();
-
-                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                    if (m_shlambda != 1.0) {
-                        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->Set_l_i(new_lambda);
-                    }
 
-                    double true_delta = new_lambda - old_lambda;
+                        double true_delta = new_lambda - old_lambda;
 
-                    // For all items with variables, add the effect of incremented
-                    // (and projected) lagrangian reactions:
-                    mconstraints[ic]->Increment_q(true_delta);
+                        // For all items with variables, add the effect of incremented
+                        // (and projected) lagrangian reactions:
+                        mconstraints[ic]->Increment_q(true_delta);
 
-                    if (this->record_violation_history)
-                        maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
-                }
+                        if (this->record_violation_history)
+                            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+                    }
 
-                maxviolation = ChMax(maxviolation, fabs(candidate_violation));
+                    maxviolation = ChMax(maxviolation, fabs(candidate_violation));
+
+                }  // end IsActive()
+
+            }  // end constraint loop
+
+            // Terminate the loop if violation in constraints has been successfully limited.
+            // if (maxviolation < m_tolerance)
+            //	break;
+
+            // For recording into violation history, if debugging
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+            // Increment iter count (each sweep, either forward or backward, is considered
+            // as a complete iteration, to be fair when comparing to the non-symmetric SOR :)
+            iter++;
+
+            //
+            // Backward sweep, for symmetric SOR
+            //
+            maxviolation = 0.;
+            maxdeltalambda = 0.;
+            i_friction_comp = 0;
+
+            if (m_multithreaded) {
+            maxviolation = SweepColoredPSOR(mconstraints, m_coloring, true, nthreads, maxdeltalambda);
+        } else {
+            for (int ic = (nConstr - 1); ic >= 0; ic--) {
+                    // skip computations if constraint not active.
+                    if (mconstraints[ic]->IsActive()) {
+                        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+                        double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                                           mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
+
+                        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+                        double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+
+                        // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+                        double deltal = (m_omega / mconstraints[ic]->Get_g_i()) * (-mresidual);
+
+                        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+                            candidate_violation = 0;
+                            // update:   lambda += delta_lambda;
+                            old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
+                            mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
+                            i_friction_comp++;
+                            if (i_friction_comp == 3) {
+                                mconstraints[ic]->Project();  // the N normal component will take care of N,U,V
+
+                                double new_lambda_0 = mconstraints[ic + 2]->Get_l_i();
+                                double new_lambda_1 = mconstraints[ic + 1]->Get_l_i();
+                                double new_lambda_2 = mconstraints[ic + 0]->Get_l_i();
+                                // Apply the smoothing:
+                                // lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                                if (m_shlambda != 1.0) {
+                                    new_lambda_0 =
+                                        m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+                                    new_lambda_1 =
+                                        m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+                                    new_lambda_2 =
+                                        m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+                                    mconstraints[ic + 2]->Set_l_i(new_lambda_0);
+                                    mconstraints[ic + 1]->Set_l_i(new_lambda_1);
+                                    mconstraints[ic + 0]->Set_l_i(new_lambda_2);
+                                }
+                                double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+                                double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+                                double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+                                mconstraints[ic + 2]->Increment_q(true_delta_0);
+                                mconstraints[ic + 1]->Increment_q(true_delta_1);
+                                mconstraints[ic + 0]->Increment_q(true_delta_2);
+
+                                candidate_violation = fabs(ChMin(0.0, mresidual));
+
+                                if (this->record_violation_history) {
+                                    maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
+                                    maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
+                                    maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
+                                }
+                                i_friction_comp = 0;
+                            }
+                        } else {
+                            // update:   lambda += delta_lambda;
+                            double old_lambda = mconstraints[ic]->Get_l_i();
+                            mconstraints[ic]->Set_l_i(old_lambda + deltal);
+
+                            // If new lagrangian multiplier does not satisfy inequalities, project
+                            // it into an admissible orthant (or, in general, onto an admissible set)
+                            mconstraints[ic]->Project();
+
+                            // After projection, the lambda may have changed a bit..
+                            double new_lambda = mconstraints[ic]->Get_l_i();
+
+                            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                            if (m_shlambda != 1.0) {
+                                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+                                mconstraints[ic]->Set_l_i(new_lambda);
+                            }
+
+                            double true_delta = new_lambda - old_lambda;
+
+                            // For all items with variables, add the effect of incremented
+                            // (and projected) lagrangian reactions:
+                            mconstraints[ic]->Increment_q(true_delta);
+
+                            if (this->record_violation_history)
+                                maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+                        }
 
-            }  // end IsActive()
+                        maxviolation = ChMax(maxviolation, fabs(candidate_violation));
 
-        }  // end loop on constraints
+                    }  // end IsActive()
+
+                }  // end loop on constraints
+        }
+        }
 
         // For recording into violation history, if debugging
         if (this->record_violation_history)
@@ -49,8 +49,18 @@ ChSolverPSSOR : public ChIterativeSolverVI {
     /// For the PSSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable multithreaded iterations (default: false).
+    /// If enabled, the forward and backward sweeps process colors of non-conflicting constraints in sequence, and the
+    /// constraints within a color concurrently (see ChSolverPSOR::EnableMultithreading).
+    void EnableMultithreading(bool val) { m_multithreaded = val; }
+
+    /// Return true if multithreaded iterations are enabled.
+    bool IsMultithreaded() const { return m_multithreaded; }
+
   private:
     double maxviolation;
+    bool m_multithreaded;             ///< use the colored multithreaded sweeps
+    ChConstraintColoring m_coloring;  ///< partition of the constraints for multithreaded sweeps
 };
 
 /// @} chrono_solver
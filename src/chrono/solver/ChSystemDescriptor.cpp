@@ -16,6 +16,9 @@
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChTracer.h"
+
+#include <algorithm>
 
 namespace chrono {
 
@@ -25,7 +28,7 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), num_threads(1), freeze_count(false) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -264,6 +267,221 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+// -----------------------------------------------------------------------------
+// Parallel assembly of the system matrix
+// -----------------------------------------------------------------------------
+
+// Matrix stand-in that records, instead of setting elements, their slots in the value array of a compressed matrix.
+class ChAssemblySlotRecorder : public ChSparseMatrix {
+  public:
+    ChAssemblySlotRecorder(const ChSparseMatrix& Z, std::vector<int>& slots)
+        : m_Z(Z), m_slots(slots), m_failed(false) {}
+
+    virtual void SetElement(int row, int col, double el, bool overwrite = true) override {
+        if (row < 0 || row >= m_Z.rows()) {
+            m_failed = true;
+            return;
+        }
+        const int* first = m_Z.innerIndexPtr() + m_Z.outerIndexPtr()[row];
+        const int* last = m_Z.innerIndexPtr() + m_Z.outerIndexPtr()[row + 1];
+        const int* pos = std::lower_bound(first, last, col);
+        if (pos == last || *pos != col) {
+            m_failed = true;
+            return;
+        }
+        m_slots.push_back((int)(pos - m_Z.innerIndexPtr()));
+    }
+
+    int GetNumRecorded() const { return (int)m_slots.size(); }
+    bool Failed() const { return m_failed; }
+
+  private:
+    const ChSparseMatrix& m_Z;
+    std::vector<int>& m_slots;
+    bool m_failed;
+};
+
+// Matrix stand-in that sets the elements of one block directly in their precomputed slots.
+// Each element is checked against the row and column of its slot, so that any change in the structure of the block
+// (e.g., a constraint attached to other variables, or variables with new offsets) is detected.
+class ChAssemblySlotWriter : public ChSparseMatrix {
+  public:
+    ChAssemblySlotWriter(ChSparseMatrix& Z, const int* slots)
+        : m_values(Z.valuePtr()),
+          m_outer(Z.outerIndexPtr()),
+          m_inner(Z.innerIndexPtr()),
+          m_rows((int)Z.rows()),
+          m_slots(slots),
+          m_next(0),
+          m_end(0),
+          m_atomic(false),
+          m_failed(false) {}
+
+    // Start a new block, with elements in slots[begin, end).
+    void Begin(int begin, int end, bool atomic) {
+        m_next = begin;
+        m_end = end;
+        m_atomic = atomic;
+        m_failed = false;
+    }
+
+    // Return true if the block set exactly its recorded elements.
+    bool End() const { return !m_failed && m_next == m_end; }
+
+    virtual void SetElement(int row, int col, double el, bool overwrite = true) override {
+        if (m_next >= m_end) {
+            m_failed = true;
+            return;
+        }
+        int slot = m_slots[m_next++];
+        if (row < 0 || row >= m_rows || slot < m_outer[row] || slot >= m_outer[row + 1] || m_inner[slot] != col) {
+            m_failed = true;
+            return;
+        }
+        double& val = m_values[slot];
+        if (overwrite) {
+            val = el;
+        } else if (m_atomic) {
+#pragma omp atomic
+            val += el;
+        } else {
+            val += el;
+        }
+    }
+
+  private:
+    double* m_values;
+    const int* m_outer;
+    const int* m_inner;
+    int m_rows;
+    const int* m_slots;
+    int m_next;
+    int m_end;
+    bool m_atomic;
+    bool m_failed;
+};
+
+bool ChSystemDescriptor::LearnAssemblySlots(const ChSparseMatrix& Z, ChAssemblySlots& slots) {
+    slots.Reset();
+    if (!Z.isCompressed())
+        return false;
+
+    n_q = CountActiveVariables();
+
+    // Replay the assembly sequence of ConvertToMatrixForm, recording the slot of each element.
+    ChAssemblySlotRecorder recorder(Z, slots.slots);
+
+    for (unsigned int iv = 0; iv < vvariables.size(); iv++) {
+        if (vvariables[iv]->IsActive()) {
+            slots.var_start.push_back(recorder.GetNumRecorded());
+            vvariables[iv]->Build_M(recorder, vvariables[iv]->GetOffset(), vvariables[iv]->GetOffset(), c_a);
+        }
+    }
+    slots.var_start.push_back(recorder.GetNumRecorded());
+
+    for (unsigned int ik = 0; ik < vstiffness.size(); ik++) {
+        slots.kblock_start.push_back(recorder.GetNumRecorded());
+        vstiffness[ik]->Build_K(recorder, true);
+    }
+    slots.kblock_start.push_back(recorder.GetNumRecorded());
+
+    int s_c = 0;
+    for (unsigned int ic = 0; ic < vconstraints.size(); ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            slots.con_start.push_back(recorder.GetNumRecorded());
+            vconstraints[ic]->Build_Cq(recorder, n_q + s_c);
+            vconstraints[ic]->Build_CqT(recorder, n_q + s_c);
+            recorder.SetElement(n_q + s_c, n_q + s_c, 0);
+            s_c++;
+        }
+    }
+    slots.con_start.push_back(recorder.GetNumRecorded());
+
+    if (recorder.Failed() || Z.rows() != n_q + s_c || Z.cols() != n_q + s_c) {
+        slots.Reset();
+        return false;
+    }
+
+    slots.dim = n_q + s_c;
+    slots.nnz = (int)Z.nonZeros();
+
+    return true;
+}
+
+bool ChSystemDescriptor::ConvertToMatrixFormParallel(ChSparseMatrix& Z, const ChAssemblySlots& slots) {
+    CH_TRACE("ChSystemDescriptor::ConvertToMatrixFormParallel");
+
+    if (slots.IsEmpty() || !Z.isCompressed() || Z.rows() != slots.dim || Z.cols() != slots.dim ||
+        Z.nonZeros() != slots.nnz || vstiffness.size() + 1 != slots.kblock_start.size())
+        return false;
+
+    n_q = CountActiveVariables();
+
+    // Collect the active variables and constraints, in assembly order.
+    std::vector<ChVariables*> variables;
+    variables.reserve(slots.var_start.size() - 1);
+    for (unsigned int iv = 0; iv < vvariables.size(); iv++) {
+        if (vvariables[iv]->IsActive())
+            variables.push_back(vvariables[iv]);
+    }
+
+    std::vector<ChConstraint*> constraints;
+    constraints.reserve(slots.con_start.size() - 1);
+    for (unsigned int ic = 0; ic < vconstraints.size(); ic++) {
+        if (vconstraints[ic]->IsActive())
+            constraints.push_back(vconstraints[ic]);
+    }
+
+    if (variables.size() + 1 != slots.var_start.size() || constraints.size() + 1 != slots.con_start.size() ||
+        n_q + (int)constraints.size() != slots.dim)
+        return false;
+
+    double* values = Z.valuePtr();
+    const int* slot_data = slots.slots.data();
+    int nnz = slots.nnz;
+    int nv = (int)variables.size();
+    int nk = (int)vstiffness.size();
+    int nc = (int)constraints.size();
+    bool ok = true;
+
+#pragma omp parallel num_threads(num_threads) reduction(&& : ok)
+    {
+        ChAssemblySlotWriter writer(Z, slot_data);
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < nnz; i++)
+            values[i] = 0;
+
+        // Masses and inertias: variable blocks do not overlap.
+#pragma omp for schedule(dynamic, 64)
+        for (int iv = 0; iv < nv; iv++) {
+            writer.Begin(slots.var_start[iv], slots.var_start[iv + 1], false);
+            variables[iv]->Build_M(writer, variables[iv]->GetOffset(), variables[iv]->GetOffset(), c_a);
+            ok = writer.End() && ok;
+        }
+
+        // Stiffness blocks: blocks sharing variables overlap, so accumulate atomically.
+#pragma omp for schedule(dynamic, 16)
+        for (int ik = 0; ik < nk; ik++) {
+            writer.Begin(slots.kblock_start[ik], slots.kblock_start[ik + 1], true);
+            vstiffness[ik]->Build_K(writer, true);
+            ok = writer.End() && ok;
+        }
+
+        // Constraints: each one fills its own row and column.
+#pragma omp for schedule(dynamic, 64)
+        for (int ic = 0; ic < nc; ic++) {
+            writer.Begin(slots.con_start[ic], slots.con_start[ic + 1], false);
+            constraints[ic]->Build_Cq(writer, n_q + ic);
+            constraints[ic]->Build_CqT(writer, n_q + ic);
+            writer.SetElement(n_q + ic, n_q + ic, constraints[ic]->Get_cfm_i());
+            ok = writer.End() && ok;
+        }
+    }
+
+    return ok;
+}
+
 void ChSystemDescriptor::DumpLastMatrices(bool assembled, const char* path) {
     char filename[300];
     try {
@@ -24,6 +24,37 @@
 
 namespace chrono {
 
+/// Map of the elements assembled by ChSystemDescriptor::ConvertToMatrixForm to their slots (positions in the value
+/// array) in a compressed system matrix. Built with ChSystemDescriptor::LearnAssemblySlots and used for parallel
+/// assembly with ChSystemDescriptor::ConvertToMatrixFormParallel, while the system structure does not change.
+class ChAssemblySlots {
+  public:
+    ChAssemblySlots() : dim(0), nnz(0) {}
+
+    /// Discard the slot map.
+    void Reset() {
+        dim = 0;
+        nnz = 0;
+        slots.clear();
+        var_start.clear();
+        kblock_start.clear();
+        con_start.clear();
+    }
+
+    /// Return true if the slot map is empty.
+    bool IsEmpty() const { return var_start.empty(); }
+
+  private:
+    int dim;                        ///< size of the system matrix
+    int nnz;                        ///< number of non-zeros in the system matrix
+    std::vector<int> slots;         ///< slot of each assembled element, in assembly order
+    std::vector<int> var_start;     ///< first element of each active variable block (plus end marker)
+    std::vector<int> kblock_start;  ///< first element of each stiffness block (plus end marker)
+    std::vector<int> con_start;     ///< first element of each active constraint (plus end marker)
+
+    friend class ChSystemDescriptor;
+};
+
 /// Base class for collecting objects inherited from ChConstraint,
 /// ChVariables and optionally ChKblock. These objects
 /// can be used to define a sparse representation of the system.
@@ -80,6 +111,8 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    int num_threads;  ///< number of threads available to multithreaded solvers
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
@@ -149,6 +182,13 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of threads that solvers may use when operating on this descriptor (default: 1).
+    /// This is set automatically by the owning ChSystem (see ChSystem::SetNumThreads).
+    void SetNumThreads(int nthreads) { num_threads = nthreads; }
+
+    /// Get the number of threads that solvers may use when operating on this descriptor.
+    int GetNumThreads() const { return num_threads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -328,6 +368,21 @@ class ChApi ChSystemDescriptor {
                                      ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     );
 
+    /// Record the slot, in the value array of the given matrix, of each element assembled by ConvertToMatrixForm.
+    /// Z must be in compressed mode and its sparsity pattern must include all elements of the system matrix (as is
+    /// the case right after a call to ConvertToMatrixForm followed by makeCompressed). Return false, leaving the slot
+    /// map empty, if an element is missing from the sparsity pattern of Z.
+    virtual bool LearnAssemblySlots(const ChSparseMatrix& Z, ChAssemblySlots& slots);
+
+    /// Assemble the system matrix in parallel, using a slot map recorded with LearnAssemblySlots.
+    /// Each thread scatters the elements of its variable, stiffness and constraint blocks directly into their slots,
+    /// with no locks and no lookups in the sparsity pattern; overlapping stiffness blocks are accumulated atomically.
+    /// The system structure (active blocks and their sparsity) must be the same as when the slot map was recorded.
+    /// Return false, leaving Z in an unspecified state, if Z does not match the slot map or if some element is not at
+    /// the same row and column as when its slot was recorded (e.g., after a change in variable offsets or in the
+    /// variables of a constraint); the caller must then fall back to ConvertToMatrixForm.
+    virtual bool ConvertToMatrixFormParallel(ChSparseMatrix& Z, const ChAssemblySlots& slots);
+
     /// Saves to disk the LAST used matrices of the problem.
     /// If assembled == true,
     ///    dump_Z.dat   has the assembled optimization matrix (Matlab sparse format)
@@ -12,9 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -73,6 +75,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 // Euler explicit timestepper.
 // This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 void ChTimestepperEulerExpl::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -109,6 +112,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExplIIorder)
 //    v_new = v + a * dt
 // integration with Euler formula.
 void ChTimestepperEulerExplIIorder::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerExplIIorder::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -147,6 +151,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerSemiImplicit)
 //    x_new = x + v_new * dt
 // integration with Euler semi-implicit formula.
 void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerSemiImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -180,6 +185,7 @@ CH_FACTORY_REGISTER(ChTimestepperRungeKuttaExpl)
 
 // Performs a step of a 4th order explicit Runge-Kutta integration scheme.
 void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
+    CH_TRACE("ChTimestepperRungeKuttaExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -226,6 +232,7 @@ CH_FACTORY_REGISTER(ChTimestepperHeun)
 
 // Performs a step of a Heun explicit integrator. It is like a 2nd Runge Kutta.
 void ChTimestepperHeun::Advance(const double dt) {
+    CH_TRACE("ChTimestepperHeun::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -269,6 +276,7 @@ CH_FACTORY_REGISTER(ChTimestepperLeapfrog)
 // Suggestion: use the ChTimestepperEulerSemiImplicit, it gives
 // the same accuracy with a bit of faster performance.
 void ChTimestepperLeapfrog::Advance(const double dt) {
+    CH_TRACE("ChTimestepperLeapfrog::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -306,6 +314,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -337,6 +346,13 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // Unless reusing the Newton matrix across steps, the solver's Setup is called at each iteration.
+    // Otherwise, the matrix from a previous step is used until the residual norm decreases too slowly.
+    int n = mintegrable->GetNcoords_v();
+    int m = mintegrable->GetNconstr();
+    bool call_setup = !CanReuseJacobian(dt, n, m);
+    double R_nrm_prev = 0;
+
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
@@ -346,13 +362,19 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         mintegrable->LoadResidual_CqL(R, L, dt);
         mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp, Qc_clamping);
 
+        double R_nrm = R.lpNorm<Eigen::Infinity>();
+        double Qc_nrm = Qc.lpNorm<Eigen::Infinity>();
+
         if (verbose)
-            GetLog() << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
-                     << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
+            GetLog() << " Euler iteration=" << i << "  |R|=" << R_nrm << "  |Qc|=" << Qc_nrm << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R_nrm < abstolS) && (Qc_nrm < abstolL))
             break;
 
+        if (i > 0 && JacobianRateExceeded(std::max(R_nrm, Qc_nrm), R_nrm_prev))
+            call_setup = true;
+        R_nrm_prev = std::max(R_nrm, Qc_nrm);
+
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
             1.0,                            // factor for  M
@@ -361,12 +383,16 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, n, m);
+        }
+        call_setup = !jacobian_reuse;
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -399,6 +425,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicitLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -469,6 +496,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicitProjected::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -562,6 +590,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidal::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -657,6 +686,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidalLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -737,6 +767,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized2)
 // Performs a step of trapezoidal implicit linearized for II order systems
 //*** SIMPLIFIED VERSION -DOES NOT WORK - PREFER ChTimestepperTrapezoidalLinearized
 void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidalLinearized2::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -822,6 +853,7 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE("ChTimestepperNewmark::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
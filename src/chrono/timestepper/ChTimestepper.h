@@ -183,9 +183,28 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     int numsetups;  ///< number of calls to the solver's Setup function
     int numsolves;  ///< number of calls to the solver's Solve function
 
+    bool jacobian_reuse;     ///< reuse the Newton matrix across steps?
+    double reuse_max_rate;   ///< maximum Newton convergence rate with a reused Newton matrix
+    bool reuse_valid;        ///< is there a Newton matrix from a previous step?
+    double reuse_h;          ///< step size used for the current Newton matrix
+    int reuse_n;             ///< number of coordinates (speeds) for the current Newton matrix
+    int reuse_m;             ///< number of constraints for the current Newton matrix
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_reuse(false),
+          reuse_max_rate(0.5),
+          reuse_valid(false),
+          reuse_h(0),
+          reuse_n(0),
+          reuse_m(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -225,6 +244,28 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     int GetNumSolveCalls() const { return numsolves; }
 
+    /// Enable/disable reuse of the Newton matrix across steps (default: false).
+    /// If enabled, the Newton matrix is evaluated, assembled, and factorized only if:
+    ///   - the step size or the problem size changed since the last evaluation
+    ///   - the Newton convergence rate (ratio of successive iteration norms) exceeds the value set
+    ///     with SetJacobianReuseRate
+    ///   - the Newton iteration does not converge with a matrix from a previous step.
+    /// Only supported by integrators that check convergence of the Newton iteration (HHT and Euler implicit).
+    /// The number of Setup and Solve calls in a step can be monitored with GetNumSetupCalls and GetNumSolveCalls.
+    void SetJacobianReuse(bool val) {
+        jacobian_reuse = val;
+        reuse_valid = false;
+    }
+
+    /// Set the maximum Newton convergence rate before the Newton matrix is re-evaluated (default: 0.5).
+    /// Only used if reuse of the Newton matrix is enabled.
+    void SetJacobianReuseRate(double rate) { reuse_max_rate = rate; }
+
+    /// Force a re-evaluation of the Newton matrix at the next step.
+    /// Call this if the system changed in a way that does not change the problem size (e.g., a new set of contacts
+    /// with the same number of constraints) and should not wait for a drop in the Newton convergence rate.
+    void ForceJacobianUpdate() { reuse_valid = false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive) {
         // version number
@@ -246,6 +287,27 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
     }
+
+  protected:
+    /// Return true if the Newton matrix from a previous step can be reused for a step of size h
+    /// and a problem with n coordinates (speeds) and m constraints.
+    bool CanReuseJacobian(double h, int n, int m) const {
+        return jacobian_reuse && reuse_valid && h == reuse_h && n == reuse_n && m == reuse_m;
+    }
+
+    /// Record that the Newton matrix was evaluated for a step of size h and a problem of size (n, m).
+    void JacobianUpdated(double h, int n, int m) {
+        reuse_valid = true;
+        reuse_h = h;
+        reuse_n = n;
+        reuse_m = m;
+    }
+
+    /// Return true if the Newton matrix must be re-evaluated because of a slow convergence rate,
+    /// given the norms of two successive Newton iterations.
+    bool JacobianRateExceeded(double nrm, double nrm_prev) const {
+        return jacobian_reuse && nrm > reuse_max_rate * nrm_prev;
+    }
 };
 
 /// Euler explicit timestepper.
@@ -12,9 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -46,10 +48,12 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
         alpha = 0;
     gamma = (1.0 - 2.0 * alpha) / 2.0;
     beta = pow((1.0 - alpha), 2) / 4.0;
+    ForceJacobianUpdate();
 }
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE("ChTimestepperHHT::Advance");
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -107,8 +111,12 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
+    // If reusing the Newton matrix across steps, the update at the beginning of a step is skipped if the stepsize and
+    // the problem size did not change, and an update also occurs if the Newton convergence rate is too slow.
+    int n = mintegrable->GetNcoords_v();
+    int m = mintegrable->GetNconstr();
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = !CanReuseJacobian(h, n, m);
 
     // Loop until reaching final time
     while (true) {
@@ -117,6 +125,8 @@ void ChTimestepperHHT::Advance(const double dt) {
 
         // Newton-Raphson for state at T+h
         bool converged;
+        bool updated = false;  // was the Newton matrix updated during this step attempt?
+        double nrm_prev = 0;
         int it;
 
         for (it = 0; it < maxiters; it++) {
@@ -131,6 +141,8 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                updated = true;
+                JacobianUpdated(h, n, m);
             }
 
             // If using modified Newton, do not call Setup again
@@ -140,6 +152,12 @@ void ChTimestepperHHT::Advance(const double dt) {
             converged = CheckConvergence(scaling_factor);
             if (converged)
                 break;
+
+            // If reusing the Newton matrix, update it if the convergence rate is too slow.
+            // The second update still corrects the predictor, so the rate is measured starting with the third one.
+            if (it > 1 && JacobianRateExceeded(update_nrm, nrm_prev))
+                call_setup = true;
+            nrm_prev = update_nrm;
         }
 
         if (converged) {
@@ -184,6 +202,19 @@ void ChTimestepperHHT::Advance(const double dt) {
                 call_setup = true;
             */
 
+        } else if (jacobian_reuse && !updated) {
+            // ------ NR did not converge with a Newton matrix reused from a previous step
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            // re-attempt step with updated matrix
+            if (verbose) {
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
+            }
+
+            call_setup = true;
+
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
 
@@ -264,6 +295,7 @@ void ChTimestepperHHT::Prepare(ChIntegrableIIorder* integrable, double scaling_f
         case POSITION:
             Xnew = X;
             Xprev = X;
+            Dx.setZero(integrable->GetNcoords_v(), integrable);
             Vnew = V * (-(gamma / beta - 1.0)) - A * (h * (gamma / (2.0 * beta) - 1.0));
             Anew = V * (-1.0 / (beta * h)) - A * (1.0 / (2.0 * beta) - 1.0);
             integrable->LoadResidual_F(Rold, -(alpha / (1.0 + alpha)) * scaling_factor);  // -alpha/(1.0+alpha) * f_old
@@ -375,6 +407,7 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
             double Qc_nrm = Qc.norm();
             double Da_nrm = Da.wrmsNorm(ewtS);
             double Dl_nrm = Dl.wrmsNorm(ewtL);
+            update_nrm = std::max(Da_nrm, Dl_nrm);
 
             if (verbose) {
                 GetLog() << " HHT iteration=" << numiters << "  |R|=" << R_nrm << "  |Qc|=" << Qc_nrm
@@ -397,6 +430,7 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
 
             double Dl_nrm = Dl.wrmsNorm(ewtL);
             Dl_nrm /= scaling_factor;
+            update_nrm = std::max(Dx_nrm, Dl_nrm);
 
             if (verbose) {
                 GetLog() << " HHT iteration=" << numiters << "  |Dx|=" << Dx_nrm << "  |Dl|=" << Dl_nrm << "\n";
@@ -64,6 +64,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     bool modified_Newton;    ///< use modified Newton?
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
+    double update_nrm;       ///< WRMS norm of the last Newton update (max over states and multipliers)
 
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
@@ -83,10 +84,16 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double GetAlpha() { return alpha; }
 
     /// Set the HHT formulation.
-    void SetMode(HHT_Mode mmode) { mode = mmode; }
+    void SetMode(HHT_Mode mmode) {
+        mode = mmode;
+        ForceJacobianUpdate();
+    }
 
     /// Turn scaling on/off.
-    void SetScaling(bool mscaling) { scaling = mscaling; }
+    void SetScaling(bool mscaling) {
+        scaling = mscaling;
+        ForceJacobianUpdate();
+    }
 
     /// Turn step size control on/off.
     /// Step size control is enabled by default.
@@ -15,22 +15,205 @@
 // Utilities for performance benchmarking of Chrono simulations using the Google
 // benchmark framework.
 //
+// If the environment variable CHRONO_BENCHMARK_METRICS is set to an existing
+// directory, the benchmarks defined with CH_BM_SIMULATION_LOOP or
+// CH_BM_SIMULATION_ONCE also write per-step metrics to <dir>/<test>.csv and
+// <dir>/<test>.json. If CHRONO_BENCHMARK_PERF_COUNTERS is also set (Linux only),
+// hardware counters (cycles and cache misses) are included.
+//
 // =============================================================================
 
 #ifndef CH_BENCHMARK_H
 #define CH_BENCHMARK_H
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChIterativeSolver.h"
 
 namespace chrono {
 namespace utils {
 
+/// Metrics collected for one simulation step of a benchmark test.
+/// Quantities that are not available are set to -1.
+struct ChBenchmarkStepRecord {
+    int batch;                      ///< index of the simulation batch (call to ChBenchmarkTest::Simulate)
+    int step;                       ///< index of the step within the batch
+    double time;                    ///< simulation time at the end of the step
+    int num_contacts;               ///< number of contacts
+    int num_bodies_active;          ///< number of active (not fixed, not sleeping) bodies
+    int num_constraints;            ///< number of scalar constraints (including contacts)
+    int solver_iterations;          ///< number of iterations of the last solve (iterative solvers only)
+    double solver_residual;         ///< error reached by the last solve (iterative solvers only)
+    long long allocated_bytes;      ///< heap memory in use at the end of the step (glibc only)
+    double timer_step;              ///< time for performing the step
+    double timer_advance;           ///< time for integration
+    double timer_jacobian;          ///< time for evaluating/loading Jacobian data
+    double timer_ls_setup;          ///< time for solver setup
+    double timer_ls_solve;          ///< time for solver solve
+    double timer_collision;         ///< time for collision detection
+    double timer_collision_broad;   ///< time for broad-phase collision
+    double timer_collision_narrow;  ///< time for narrow-phase collision
+    double timer_setup;             ///< time for system setup
+    double timer_update;            ///< time for system update
+    long long cycles;               ///< CPU cycles (hardware counters only)
+    long long cache_misses;         ///< cache misses (hardware counters only)
+};
+
+/// Hardware performance counters (CPU cycles and cache misses), read with the Linux perf_event interface.
+/// The counters include the calling thread and the threads it creates after the counters are opened. Counters are
+/// not available on other platforms, or if the kernel does not allow it (see /proc/sys/kernel/perf_event_paranoid).
+class ChPerfCounters {
+  public:
+    ChPerfCounters() : m_fd_cycles(-1), m_fd_misses(-1) {}
+    ~ChPerfCounters() { Close(); }
+
+    /// Open the counters. Return false if they are not available.
+    bool Open() {
+        Close();
+        m_fd_cycles = OpenCounter(PERF_CYCLES);
+        m_fd_misses = OpenCounter(PERF_CACHE_MISSES);
+        return m_fd_cycles >= 0 || m_fd_misses >= 0;
+    }
+
+    /// Close the counters.
+    void Close() {
+        CloseCounter(m_fd_cycles);
+        CloseCounter(m_fd_misses);
+    }
+
+    /// Return the number of CPU cycles since the counters were opened (-1 if not available).
+    long long GetCycles() const { return ReadCounter(m_fd_cycles); }
+
+    /// Return the number of cache misses since the counters were opened (-1 if not available).
+    long long GetCacheMisses() const { return ReadCounter(m_fd_misses); }
+
+  private:
+    enum Counter { PERF_CYCLES, PERF_CACHE_MISSES };
+
+    static int OpenCounter(Counter counter) {
+#if defined(__linux__)
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = (counter == PERF_CYCLES) ? PERF_COUNT_HW_CPU_CYCLES : PERF_COUNT_HW_CACHE_MISSES;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+        return -1;
+#endif
+    }
+
+    static void CloseCounter(int& fd) {
+#if defined(__linux__)
+        if (fd >= 0)
+            close(fd);
+#endif
+        fd = -1;
+    }
+
+    static long long ReadCounter(int fd) {
+#if defined(__linux__)
+        long long value;
+        if (fd >= 0 && read(fd, &value, sizeof(value)) == sizeof(value))
+            return value;
+#endif
+        return -1;
+    }
+
+    int m_fd_cycles;
+    int m_fd_misses;
+};
+
+/// Return the heap memory currently in use (in bytes), or -1 if not available.
+inline long long GetAllocatedBytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return (long long)(info.uordblks + info.hblkhd);
+#elif defined(__GLIBC__)
+    struct mallinfo info = mallinfo();
+    return (long long)(unsigned int)info.uordblks + (long long)(unsigned int)info.hblkhd;
+#else
+    return -1;
+#endif
+}
+
+/// Write the given step records to a CSV file. Return false if the file cannot be written.
+inline bool WriteBenchmarkCSV(const std::string& filename, const std::vector<ChBenchmarkStepRecord>& records) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file)
+        return false;
+    fprintf(file,
+            "batch,step,time,num_contacts,num_bodies_active,num_constraints,solver_iterations,solver_residual,"
+            "allocated_bytes,timer_step,timer_advance,timer_jacobian,timer_ls_setup,timer_ls_solve,"
+            "timer_collision,timer_collision_broad,timer_collision_narrow,timer_setup,timer_update,"
+            "cycles,cache_misses\n");
+    for (const auto& r : records) {
+        fprintf(file, "%d,%d,%.9g,%d,%d,%d,%d,%.9g,%lld,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%lld,%lld\n",
+                r.batch, r.step, r.time, r.num_contacts, r.num_bodies_active, r.num_constraints, r.solver_iterations,
+                r.solver_residual, r.allocated_bytes, r.timer_step, r.timer_advance, r.timer_jacobian,
+                r.timer_ls_setup, r.timer_ls_solve, r.timer_collision, r.timer_collision_broad,
+                r.timer_collision_narrow, r.timer_setup, r.timer_update, r.cycles, r.cache_misses);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+/// Write the given step records to a JSON file. Return false if the file cannot be written.
+inline bool WriteBenchmarkJSON(const std::string& filename,
+                               const std::string& name,
+                               const std::vector<ChBenchmarkStepRecord>& records) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file)
+        return false;
+    fprintf(file, "{\"benchmark\":\"%s\",\"steps\":[", name.c_str());
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& r = records[i];
+        fprintf(file,
+                "%s\n{\"batch\":%d,\"step\":%d,\"time\":%.9g,\"num_contacts\":%d,\"num_bodies_active\":%d,"
+                "\"num_constraints\":%d,\"solver_iterations\":%d,\"solver_residual\":%.9g,\"allocated_bytes\":%lld,"
+                "\"timers\":{\"step\":%.9g,\"advance\":%.9g,\"jacobian\":%.9g,\"ls_setup\":%.9g,\"ls_solve\":%.9g,"
+                "\"collision\":%.9g,\"collision_broad\":%.9g,\"collision_narrow\":%.9g,\"setup\":%.9g,"
+                "\"update\":%.9g},\"cycles\":%lld,\"cache_misses\":%lld}",
+                i == 0 ? "" : ",", r.batch, r.step, r.time, r.num_contacts, r.num_bodies_active, r.num_constraints,
+                r.solver_iterations, r.solver_residual, r.allocated_bytes, r.timer_step, r.timer_advance,
+                r.timer_jacobian, r.timer_ls_setup, r.timer_ls_solve, r.timer_collision, r.timer_collision_broad,
+                r.timer_collision_narrow, r.timer_setup, r.timer_update, r.cycles, r.cache_misses);
+    }
+    fprintf(file, "\n]}\n");
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+// =============================================================================
+
 /// Base class for a Chrono benchmark test.
 /// A derived class should set up a complete Chrono model in its constructor and implement
 /// GetSystem (to return a pointer to the underlying Chrono system) and ExecuteStep (to perform
 /// all operations required to advance the system state by one time step).
 /// Timing information for various phases of the simulation is collected for a sequence of steps.
+/// Optionally, a ChBenchmarkStepRecord is also collected at each step (see EnableMetrics).
 class ChBenchmarkTest {
   public:
     ChBenchmarkTest();
@@ -42,6 +225,15 @@ class ChBenchmarkTest {
     void Simulate(int num_steps);
     void ResetTimers();
 
+    /// Enable collection of per-step metrics, optionally including hardware counters.
+    void EnableMetrics(bool val, bool hw_counters = false);
+
+    /// Return the per-step metrics collected so far.
+    const std::vector<ChBenchmarkStepRecord>& GetMetrics() const { return m_records; }
+
+    /// Discard the per-step metrics collected so far.
+    void ClearMetrics() { m_records.clear(); }
+
     double m_timer_step;              ///< time for performing simulation
     double m_timer_advance;           ///< time for integration
     double m_timer_jacobian;          ///< time for evaluating/loading Jacobian data
@@ -52,6 +244,14 @@ class ChBenchmarkTest {
     double m_timer_collision_narrow;  ///< time for narrow-phase collision
     double m_timer_setup;             ///< time for system update
     double m_timer_update;            ///< time for system update
+
+  private:
+    void RecordStep(int step, long long cycles, long long cache_misses);
+
+    bool m_metrics;
+    int m_batch;
+    ChPerfCounters m_counters;
+    std::vector<ChBenchmarkStepRecord> m_records;
 };
 
 inline ChBenchmarkTest::ChBenchmarkTest()
@@ -64,13 +264,27 @@ inline ChBenchmarkTest::ChBenchmarkTest()
       m_timer_collision_broad(0),
       m_timer_collision_narrow(0),
       m_timer_setup(0),
-      m_timer_update(0) {}
+      m_timer_update(0),
+      m_metrics(false),
+      m_batch(0) {}
+
+inline void ChBenchmarkTest::EnableMetrics(bool val, bool hw_counters) {
+    m_metrics = val;
+    if (val && hw_counters)
+        m_counters.Open();
+    else
+        m_counters.Close();
+}
 
 inline void ChBenchmarkTest::Simulate(int num_steps) {
     ////std::cout << "  simulate from t=" << GetSystem()->GetChTime() << " for steps=" << num_steps << std::endl;
     ResetTimers();
     for (int i = 0; i < num_steps; i++) {
+        long long cycles = m_metrics ? m_counters.GetCycles() : -1;
+        long long cache_misses = m_metrics ? m_counters.GetCacheMisses() : -1;
         ExecuteStep();
+        if (m_metrics)
+            RecordStep(i, cycles, cache_misses);
         m_timer_step += GetSystem()->GetTimerStep();
         m_timer_advance += GetSystem()->GetTimerAdvance();
         m_timer_jacobian += GetSystem()->GetTimerJacobian();
@@ -82,6 +296,38 @@ inline void ChBenchmarkTest::Simulate(int num_steps) {
         m_timer_setup += GetSystem()->GetTimerSetup();
         m_timer_update += GetSystem()->GetTimerUpdate();
     }
+    m_batch++;
+}
+
+inline void ChBenchmarkTest::RecordStep(int step, long long cycles, long long cache_misses) {
+    ChSystem* system = GetSystem();
+    ChBenchmarkStepRecord r;
+    r.batch = m_batch;
+    r.step = step;
+    r.time = system->GetChTime();
+    r.num_contacts = system->GetNcontacts();
+    r.num_bodies_active = system->GetNbodies();
+    r.num_constraints = system->GetNconstr();
+    r.solver_iterations = -1;
+    r.solver_residual = -1;
+    if (auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(system->GetSolver())) {
+        r.solver_iterations = solver->GetIterations();
+        r.solver_residual = solver->GetError();
+    }
+    r.allocated_bytes = GetAllocatedBytes();
+    r.timer_step = system->GetTimerStep();
+    r.timer_advance = system->GetTimerAdvance();
+    r.timer_jacobian = system->GetTimerJacobian();
+    r.timer_ls_setup = system->GetTimerLSsetup();
+    r.timer_ls_solve = system->GetTimerLSsolve();
+    r.timer_collision = system->GetTimerCollision();
+    r.timer_collision_broad = system->GetTimerCollisionBroad();
+    r.timer_collision_narrow = system->GetTimerCollisionNarrow();
+    r.timer_setup = system->GetTimerSetup();
+    r.timer_update = system->GetTimerUpdate();
+    r.cycles = cycles >= 0 ? m_counters.GetCycles() - cycles : -1;
+    r.cache_misses = cache_misses >= 0 ? m_counters.GetCacheMisses() - cache_misses : -1;
+    m_records.push_back(r);
 }
 
 inline void ChBenchmarkTest::ResetTimers() {
@@ -114,6 +360,7 @@ inline void ChBenchmarkTest::ResetTimers() {
             m_test->Simulate(SIM_STEPS);                                           \
         }                                                                          \
         Report(st);                                                                \
+        WriteMetrics(#TEST_NAME);                                                  \
     }                                                                              \
     BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(REPETITIONS);
 
@@ -133,6 +380,7 @@ inline void ChBenchmarkTest::ResetTimers() {
             m_test->Simulate(SIM_STEPS);                                           \
         }                                                                          \
         Report(st);                                                                \
+        WriteMetrics(#TEST_NAME);                                                  \
     }                                                                              \
     BENCHMARK_REGISTER_F(TEST_NAME, SimulateOnce)                                  \
         ->Unit(benchmark::kMillisecond)                                            \
@@ -144,14 +392,18 @@ inline void ChBenchmarkTest::ResetTimers() {
 /// Generic benchmark fixture for Chrono tests.
 /// The first template parameter is a ChBenchmarkTest.
 /// The second template parameter is the initial number of simulation steps (hot start).
+/// Per-step metrics are collected if the environment variable CHRONO_BENCHMARK_METRICS is set (see WriteMetrics).
 template <typename TEST, int SKIP>
 class ChBenchmarkFixture : public ::benchmark::Fixture {
   public:
     ChBenchmarkFixture() : m_test(nullptr) {
         ////std::cout << "CREATE TEST" << std::endl;
+        const char* dir = std::getenv("CHRONO_BENCHMARK_METRICS");
+        m_metrics_dir = dir ? dir : "";
         if (SKIP != 0) {
             m_test = new TEST();
             m_test->Simulate(SKIP);
+            EnableMetrics();
         }
     }
 
@@ -175,9 +427,31 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
         delete m_test;
         m_test = new TEST();
         m_test->Simulate(num_init_steps);
+        EnableMetrics();
+    }
+
+    /// Append the metrics of the steps simulated since the last call to those of previous repetitions and write
+    /// all of them to <dir>/<name>.csv and <dir>/<name>.json, where <dir> is the value of CHRONO_BENCHMARK_METRICS.
+    void WriteMetrics(const std::string& name) {
+        if (m_metrics_dir.empty())
+            return;
+        const auto& records = m_test->GetMetrics();
+        m_records.insert(m_records.end(), records.begin(), records.end());
+        m_test->ClearMetrics();
+        WriteBenchmarkCSV(m_metrics_dir + "/" + name + ".csv", m_records);
+        WriteBenchmarkJSON(m_metrics_dir + "/" + name + ".json", name, m_records);
     }
 
     TEST* m_test;
+
+  private:
+    void EnableMetrics() {
+        if (!m_metrics_dir.empty())
+            m_test->EnableMetrics(true, std::getenv("CHRONO_BENCHMARK_PERF_COUNTERS") != nullptr);
+    }
+
+    std::string m_metrics_dir;
+    std::vector<ChBenchmarkStepRecord> m_records;
 };
 
 }  // end namespace utils
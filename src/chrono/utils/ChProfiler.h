@@ -36,6 +36,8 @@ CODE MODIFIED FROM:
 //To disable built-in profiling, please comment out next line
 //#define CH_NO_PROFILE 1
 
+#include "chrono/utils/ChTracer.h"
+
 #ifndef CH_NO_PROFILE
 
 #include <cstdio>
@@ -177,11 +179,12 @@ public:
 }  // end namespace chrono
 
 
-#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name )
+// Profiled scopes are also recorded by the tracing profiler (see ChTracer)
+#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name ); CH_TRACE( name )
 
 #else
 
-#define	CH_PROFILE( name )
+#define	CH_PROFILE( name )			CH_TRACE( name )
 
 #endif //#ifndef CH_NO_PROFILE
 
@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Low-overhead tracing profiler, with export to the Chrome trace event format
+// (viewable in chrome://tracing or https://ui.perfetto.dev).
+//
+// =============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+namespace utils {
+
+std::atomic<bool> ChTracer::m_enabled(false);
+
+namespace {
+
+// Events recorded by one thread. Only the owner thread appends events; a deque is used so that appending never
+// moves the events already recorded.
+struct ThreadBuffer {
+    int id;
+    std::string name;
+    std::deque<ChTracer::Event> events;
+};
+
+// Buffers of all threads that recorded events. Buffers are never deleted, so that they outlive the threads (e.g.,
+// the OpenMP worker threads) and remain valid for the thread-local pointers.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::set<std::string> names;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.emplace_back(new ThreadBuffer);
+        buffer = registry.buffers.back().get();
+        buffer->id = (int)registry.buffers.size() - 1;
+        buffer->name = buffer->id == 0 ? "main" : "thread " + std::to_string(buffer->id);
+    }
+    return *buffer;
+}
+
+const std::chrono::steady_clock::time_point trace_epoch = std::chrono::steady_clock::now();
+
+// Write a string as a JSON string literal.
+void WriteJsonString(FILE* file, const char* str) {
+    fputc('"', file);
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', file);
+        if ((unsigned char)*c >= 0x20)
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+}  // end anonymous namespace
+
+int64_t ChTracer::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch)
+        .count();
+}
+
+void ChTracer::Record(const char* name, int64_t start, int64_t end) {
+    GetThreadBuffer().events.push_back({name, start, end});
+}
+
+const char* ChTracer::Intern(const std::string& name) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names.insert(name).first->c_str();
+}
+
+void ChTracer::SetThreadName(const std::string& name) {
+    GetThreadBuffer().name = name;
+}
+
+size_t ChTracer::GetNumEvents() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t num_events = 0;
+    for (auto& buffer : registry.buffers)
+        num_events += buffer->events.size();
+    return num_events;
+}
+
+void ChTracer::Clear() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers)
+        buffer->events.clear();
+}
+
+bool ChTracer::WriteChromeTrace(const std::string& filename) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file)
+        return false;
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    for (auto& buffer : registry.buffers) {
+        // Thread name metadata
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":",
+                first ? "" : ",\n", buffer->id);
+        WriteJsonString(file, buffer->name.c_str());
+        fprintf(file, "}}");
+        first = false;
+
+        // Complete events, with times in microseconds
+        for (auto& event : buffer->events) {
+            fprintf(file, ",\n{\"name\":");
+            WriteJsonString(file, event.name);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", buffer->id,
+                    event.start * 1e-3, (event.end - event.start) * 1e-3);
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
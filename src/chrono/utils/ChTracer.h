@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Low-overhead tracing profiler, with export to the Chrome trace event format
+// (viewable in chrome://tracing or https://ui.perfetto.dev).
+//
+// =============================================================================
+
+#ifndef CH_TRACER_H
+#define CH_TRACER_H
+
+// To compile out all tracing scopes, define CH_NO_TRACE
+//#define CH_NO_TRACE 1
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Tracing profiler.
+/// Each traced event is a named time interval, recorded in a buffer owned by the calling thread, so that recording
+/// requires no locking and can be done from within OpenMP parallel regions. Events are usually recorded with the
+/// CH_TRACE macro, which traces the enclosing scope; nested scopes show up as a hierarchy in the trace viewer.
+/// Tracing is disabled by default; when disabled, a traced scope only costs a test of a global flag.
+///
+/// Example:
+/// <pre>
+///   utils::ChTracer::Enable();
+///   for (int i = 0; i < 100; i++)
+///       system.DoStepDynamics(1e-3);
+///   utils::ChTracer::WriteChromeTrace("trace.json");
+/// </pre>
+class ChApi ChTracer {
+  public:
+    /// A traced event, with times in nanoseconds since the start of the program.
+    struct Event {
+        const char* name;  ///< event name (must remain valid until the trace is written)
+        int64_t start;     ///< start time
+        int64_t end;       ///< end time
+    };
+
+    /// Enable or disable tracing.
+    static void Enable(bool val = true) { m_enabled.store(val, std::memory_order_relaxed); }
+
+    /// Return true if tracing is enabled.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Return the current time (in nanoseconds), as used for event times.
+    static int64_t Now();
+
+    /// Record an event on the calling thread.
+    static void Record(const char* name, int64_t start, int64_t end);
+
+    /// Return a persistent copy of the given name, suitable for use as an event name.
+    /// Subsequent calls with the same name return the same pointer.
+    static const char* Intern(const std::string& name);
+
+    /// Set the name of the calling thread, as displayed in the trace viewer.
+    static void SetThreadName(const std::string& name);
+
+    /// Return the total number of recorded events, over all threads.
+    static size_t GetNumEvents();
+
+    /// Discard all recorded events.
+    /// Must not be called while other threads are recording events.
+    static void Clear();
+
+    /// Write all recorded events to the specified file in the Chrome trace event (JSON) format.
+    /// Must not be called while other threads are recording events. Return false if the file cannot be written.
+    static bool WriteChromeTrace(const std::string& filename);
+
+  private:
+    static std::atomic<bool> m_enabled;
+};
+
+/// Trace the lifetime of this object (typically, the enclosing scope).
+/// The tracing state is checked at construction, so that an event is recorded only if tracing was enabled then.
+class ChTraceScope {
+  public:
+    explicit ChTraceScope(const char* name) : m_name(ChTracer::IsEnabled() ? name : nullptr), m_start(0) {
+        if (m_name)
+            m_start = ChTracer::Now();
+    }
+
+    ~ChTraceScope() {
+        if (m_name)
+            ChTracer::Record(m_name, m_start, ChTracer::Now());
+    }
+
+  private:
+    const char* m_name;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#ifndef CH_NO_TRACE
+
+#define CH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+
+/// Trace the enclosing scope under the given name (a string literal).
+#define CH_TRACE(name) chrono::utils::ChTraceScope CH_TRACE_CONCAT(ch_trace_scope_, __LINE__)(name)
+
+#else
+
+#define CH_TRACE(name)
+
+#endif  // CH_NO_TRACE
+
+#endif
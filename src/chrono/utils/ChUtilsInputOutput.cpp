@@ -14,6 +14,10 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChCapsuleShape.h"
 #include "chrono/assets/ChColorAsset.h"
@@ -26,7 +30,9 @@
 #include "chrono/assets/ChRoundedCylinderShape.h"
 #include "chrono/assets/ChSphereShape.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/core/ChMappedFile.h"
 #include "chrono/geometry/ChLineBezier.h"
+#include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 namespace chrono {
@@ -295,6 +301,461 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteCheckpointBinary / ReadCheckpointBinary
+//
+// Binary checkpoint file layout (all records are 8-byte aligned, native byte
+// order, and stored contiguously so that they can be accessed in place from a
+// memory-mapped file):
+//    header
+//    body records      (num_bodies)
+//    shape records     (num_shapes, the shapes of each body stored contiguously)
+//    material records  (num_materials, shared materials are stored once)
+//    contact records   (num_contacts, NSC contact reactions between bodies)
+//    link reactions    (num_reactions doubles)
+// -----------------------------------------------------------------------------
+namespace {
+
+const char checkpoint_magic[8] = {'C', 'H', 'C', 'K', 'P', 'T', '\0', '\0'};
+const uint32_t checkpoint_version = 1;
+const uint32_t checkpoint_byte_order = 0x01020304;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    int32_t contact_method;  // 0: NSC, 1: SMC
+    int32_t padding;
+    double time;
+    uint64_t num_bodies;
+    uint64_t num_shapes;
+    uint64_t num_materials;
+    uint64_t num_contacts;
+    uint64_t num_reactions;
+    uint64_t offset_bodies;
+    uint64_t offset_shapes;
+    uint64_t offset_materials;
+    uint64_t offset_contacts;
+    uint64_t offset_reactions;
+};
+
+struct CheckpointBody {
+    int32_t identifier;
+    int32_t flags;  // bit 0: fixed, bit 1: collide
+    int16_t family_group;
+    int16_t family_mask;
+    int32_t num_shapes;
+    uint64_t first_shape;
+    double mass;
+    double inertiaXX[3];
+    double inertiaXY[3];
+    double pos[3];
+    double rot[4];
+    double pos_dt[3];
+    double rot_dt[4];
+};
+
+struct CheckpointShape {
+    double pos[3];
+    double rot[4];
+    double dims[4];
+    int32_t type;
+    uint32_t material;
+};
+
+struct CheckpointMaterial {
+    float values[16];
+};
+
+struct CheckpointContact {
+    uint64_t bodyA;
+    uint64_t bodyB;
+    double pointA[3];    // contact point on bodyA, in the collision model frame of bodyA
+    double reaction[3];  // contact reaction, in the absolute frame
+};
+
+static_assert(sizeof(CheckpointHeader) % 8 == 0, "misaligned checkpoint header");
+static_assert(sizeof(CheckpointBody) % 8 == 0, "misaligned checkpoint body record");
+static_assert(sizeof(CheckpointShape) % 8 == 0, "misaligned checkpoint shape record");
+static_assert(sizeof(CheckpointMaterial) % 8 == 0, "misaligned checkpoint material record");
+static_assert(sizeof(CheckpointContact) % 8 == 0, "misaligned checkpoint contact record");
+
+void PackVector(const ChVector<>& v, double* data) {
+    data[0] = v.x();
+    data[1] = v.y();
+    data[2] = v.z();
+}
+
+void PackQuaternion(const ChQuaternion<>& q, double* data) {
+    data[0] = q.e0();
+    data[1] = q.e1();
+    data[2] = q.e2();
+    data[3] = q.e3();
+}
+
+ChVector<> UnpackVector(const double* data) {
+    return ChVector<>(data[0], data[1], data[2]);
+}
+
+ChQuaternion<> UnpackQuaternion(const double* data) {
+    return ChQuaternion<>(data[0], data[1], data[2], data[3]);
+}
+
+CheckpointMaterial PackMaterial(int ctype, const std::shared_ptr<ChMaterialSurface>& material) {
+    CheckpointMaterial rec;
+    std::fill(std::begin(rec.values), std::end(rec.values), 0.0f);
+    if (ctype == 0) {
+        auto mat = std::static_pointer_cast<ChMaterialSurfaceNSC>(material);
+        float values[] = {mat->static_friction, mat->sliding_friction, mat->rolling_friction,
+                          mat->spinning_friction, mat->restitution, mat->cohesion,
+                          mat->dampingf, mat->compliance, mat->complianceT,
+                          mat->complianceRoll, mat->complianceSpin};
+        std::copy(std::begin(values), std::end(values), rec.values);
+    } else {
+        auto mat = std::static_pointer_cast<ChMaterialSurfaceSMC>(material);
+        float values[] = {mat->static_friction,   mat->sliding_friction,  mat->rolling_friction,
+                          mat->spinning_friction, mat->restitution,       mat->young_modulus,
+                          mat->poisson_ratio,     mat->constant_adhesion, mat->adhesionMultDMT,
+                          mat->adhesionSPerko,    mat->kn,                mat->kt,
+                          mat->gn,                mat->gt};
+        std::copy(std::begin(values), std::end(values), rec.values);
+    }
+    return rec;
+}
+
+std::shared_ptr<ChMaterialSurface> UnpackMaterial(int ctype, const CheckpointMaterial& rec) {
+    const float* v = rec.values;
+    if (ctype == 0) {
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        mat->static_friction = v[0];
+        mat->sliding_friction = v[1];
+        mat->rolling_friction = v[2];
+        mat->spinning_friction = v[3];
+        mat->restitution = v[4];
+        mat->cohesion = v[5];
+        mat->dampingf = v[6];
+        mat->compliance = v[7];
+        mat->complianceT = v[8];
+        mat->complianceRoll = v[9];
+        mat->complianceSpin = v[10];
+        return mat;
+    }
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->static_friction = v[0];
+    mat->sliding_friction = v[1];
+    mat->rolling_friction = v[2];
+    mat->spinning_friction = v[3];
+    mat->restitution = v[4];
+    mat->young_modulus = v[5];
+    mat->poisson_ratio = v[6];
+    mat->constant_adhesion = v[7];
+    mat->adhesionMultDMT = v[8];
+    mat->adhesionSPerko = v[9];
+    mat->kn = v[10];
+    mat->kt = v[11];
+    mat->gn = v[12];
+    mat->gt = v[13];
+    return mat;
+}
+
+// Add the collision and visualization geometry described by a shape record (see ReadCheckpoint for the meaning of
+// the shape dimensions).
+void AddCheckpointShape(ChBody* body, std::shared_ptr<ChMaterialSurface> mat, const CheckpointShape& rec) {
+    ChVector<> spos = UnpackVector(rec.pos);
+    ChQuaternion<> srot = UnpackQuaternion(rec.rot);
+    const double* d = rec.dims;
+
+    switch (collision::ChCollisionShape::Type(rec.type)) {
+        case collision::ChCollisionShape::Type::SPHERE:
+            AddSphereGeometry(body, mat, d[0], spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::ELLIPSOID:
+            AddEllipsoidGeometry(body, mat, ChVector<>(d[0], d[1], d[2]), spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::BOX:
+            AddBoxGeometry(body, mat, ChVector<>(d[0], d[1], d[2]), spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::CAPSULE:
+            AddCapsuleGeometry(body, mat, d[0], d[1], spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::CYLINDER:
+            AddCylinderGeometry(body, mat, d[0], d[2], spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::CONE:
+            AddConeGeometry(body, mat, d[0], d[2], spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::ROUNDEDBOX:
+            AddRoundedBoxGeometry(body, mat, ChVector<>(d[0], d[1], d[2]), d[3], spos, srot);
+            break;
+        case collision::ChCollisionShape::Type::ROUNDEDCYL:
+            AddRoundedCylinderGeometry(body, mat, d[0], d[2], d[3], spos, srot);
+            break;
+        default:
+            break;
+    }
+}
+
+}  // end anonymous namespace
+
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename) {
+    int ctype = (system->GetContactMethod() == ChContactMethod::NSC) ? 0 : 1;
+
+    std::vector<CheckpointBody> bodies;
+    std::vector<CheckpointShape> shapes;
+    std::vector<CheckpointMaterial> materials;
+    std::unordered_map<ChMaterialSurface*, uint32_t> material_index;
+    bodies.reserve(system->Get_bodylist().size());
+    shapes.reserve(system->Get_bodylist().size());
+
+    for (auto body : system->Get_bodylist()) {
+        auto model = body->GetCollisionModel();
+
+        CheckpointBody brec;
+        brec.identifier = body->GetIdentifier();
+        brec.flags = (body->GetBodyFixed() ? 1 : 0) | (body->GetCollide() ? 2 : 0);
+        brec.family_group = model->GetFamilyGroup();
+        brec.family_mask = model->GetFamilyMask();
+        brec.num_shapes = model->GetNumShapes();
+        brec.first_shape = shapes.size();
+        brec.mass = body->GetMass();
+        PackVector(body->GetInertiaXX(), brec.inertiaXX);
+        PackVector(body->GetInertiaXY(), brec.inertiaXY);
+        PackVector(body->GetPos(), brec.pos);
+        PackQuaternion(body->GetRot(), brec.rot);
+        PackVector(body->GetPos_dt(), brec.pos_dt);
+        PackQuaternion(body->GetRot_dt(), brec.rot_dt);
+        bodies.push_back(brec);
+
+        for (int index = 0; index < brec.num_shapes; index++) {
+            auto shape = model->GetShape(index);
+
+            std::vector<double> dims = model->GetShapeDimensions(index);
+            if (dims.empty() || dims.size() > 4) {
+                std::cout << "utils::WriteCheckpointBinary ERROR: unknown or not supported collision shape\n";
+                return false;
+            }
+
+            CheckpointShape srec;
+            ChCoordsys<> csys = model->GetShapePos(index);
+            PackVector(csys.pos, srec.pos);
+            PackQuaternion(csys.rot, srec.rot);
+            std::fill(std::begin(srec.dims), std::end(srec.dims), 0.0);
+            std::copy(dims.begin(), dims.end(), srec.dims);
+            srec.type = shape->GetType();
+
+            // Materials shared by several shapes are written only once
+            auto mat = shape->GetMaterial();
+            auto found = material_index.find(mat.get());
+            if (found == material_index.end()) {
+                found = material_index.insert({mat.get(), (uint32_t)materials.size()}).first;
+                materials.push_back(PackMaterial(ctype, mat));
+            }
+            srec.material = found->second;
+
+            shapes.push_back(srec);
+        }
+    }
+
+    // Reactions of the NSC contacts between bodies, used as warm start by the solver
+    std::vector<CheckpointContact> contacts;
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer())) {
+        std::unordered_map<ChContactable*, uint64_t> body_index;
+        for (size_t i = 0; i < system->Get_bodylist().size(); i++)
+            body_index[system->Get_bodylist()[i].get()] = i;
+
+        ChContactReactionCache cache;
+        container->CacheContactReactions(cache);
+        cache.ForEachEntry([&](ChContactable* objA, ChContactable* objB, const ChVector<>& pointA_loc,
+                               const ChVector<>& reaction_abs) {
+            auto bodyA = body_index.find(objA);
+            auto bodyB = body_index.find(objB);
+            if (bodyA == body_index.end() || bodyB == body_index.end())
+                return;
+            CheckpointContact crec;
+            crec.bodyA = bodyA->second;
+            crec.bodyB = bodyB->second;
+            PackVector(pointA_loc, crec.pointA);
+            PackVector(reaction_abs, crec.reaction);
+            contacts.push_back(crec);
+        });
+    }
+
+    // Reactions in the links, used as warm start by the solver
+    int num_reactions = 0;
+    for (auto& link : system->Get_linklist()) {
+        if (link->IsActive())
+            num_reactions += link->GetDOC();
+    }
+    ChVectorDynamic<> reactions(num_reactions);
+    unsigned int off_L = 0;
+    for (auto& link : system->Get_linklist()) {
+        if (link->IsActive()) {
+            link->IntStateGatherReactions(off_L, reactions);
+            off_L += link->GetDOC();
+        }
+    }
+
+    CheckpointHeader header;
+    std::copy(std::begin(checkpoint_magic), std::end(checkpoint_magic), header.magic);
+    header.version = checkpoint_version;
+    header.byte_order = checkpoint_byte_order;
+    header.contact_method = ctype;
+    header.padding = 0;
+    header.time = system->GetChTime();
+    header.num_bodies = bodies.size();
+    header.num_shapes = shapes.size();
+    header.num_materials = materials.size();
+    header.num_contacts = contacts.size();
+    header.num_reactions = num_reactions;
+    header.offset_bodies = sizeof(CheckpointHeader);
+    header.offset_shapes = header.offset_bodies + bodies.size() * sizeof(CheckpointBody);
+    header.offset_materials = header.offset_shapes + shapes.size() * sizeof(CheckpointShape);
+    header.offset_contacts = header.offset_materials + materials.size() * sizeof(CheckpointMaterial);
+    header.offset_reactions = header.offset_contacts + contacts.size() * sizeof(CheckpointContact);
+
+    std::ofstream ofile(filename, std::ios::binary);
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofile.write(reinterpret_cast<const char*>(bodies.data()), bodies.size() * sizeof(CheckpointBody));
+    ofile.write(reinterpret_cast<const char*>(shapes.data()), shapes.size() * sizeof(CheckpointShape));
+    ofile.write(reinterpret_cast<const char*>(materials.data()), materials.size() * sizeof(CheckpointMaterial));
+    ofile.write(reinterpret_cast<const char*>(contacts.data()), contacts.size() * sizeof(CheckpointContact));
+    ofile.write(reinterpret_cast<const char*>(reactions.data()), num_reactions * sizeof(double));
+
+    if (!ofile) {
+        std::cout << "utils::WriteCheckpointBinary ERROR: cannot write file " << filename << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename, bool create_bodies) {
+    ChMappedFile file(filename);
+
+    // Check the file header
+    const CheckpointHeader* header = file.Get<CheckpointHeader>(0, 1);
+    if (!header || !std::equal(std::begin(checkpoint_magic), std::end(checkpoint_magic), header->magic)) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: " << filename << " is not a binary checkpoint file\n";
+        return false;
+    }
+    if (header->version != checkpoint_version || header->byte_order != checkpoint_byte_order) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: unsupported checkpoint file version or byte order\n";
+        std::cout << "    Version in data file: " << header->version << "\n";
+        return false;
+    }
+
+    int ctype = header->contact_method;
+    auto contact_method = (ctype == 0) ? ChContactMethod::NSC : ChContactMethod::SMC;
+    if (contact_method != system->GetContactMethod()) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: checkpoint data file inconsistent with the Chrono system\n";
+        std::cout << "    Contact method in data file: " << (ctype == 0 ? "NSC" : "SMC") << "\n";
+        return false;
+    }
+
+    const CheckpointBody* bodies = file.Get<CheckpointBody>(header->offset_bodies, header->num_bodies);
+    const CheckpointShape* shapes = file.Get<CheckpointShape>(header->offset_shapes, header->num_shapes);
+    const CheckpointMaterial* materials =
+        file.Get<CheckpointMaterial>(header->offset_materials, header->num_materials);
+    const CheckpointContact* contacts = file.Get<CheckpointContact>(header->offset_contacts, header->num_contacts);
+    const double* reactions = file.Get<double>(header->offset_reactions, header->num_reactions);
+    if (!bodies || !shapes || !materials || !contacts || !reactions) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: truncated checkpoint file " << filename << "\n";
+        return false;
+    }
+
+    if (!create_bodies && system->Get_bodylist().size() != header->num_bodies) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: checkpoint data file inconsistent with the Chrono system\n";
+        std::cout << "    Number of bodies in data file: " << header->num_bodies << "\n";
+        return false;
+    }
+
+    // Create the materials, preserving material sharing between shapes
+    std::vector<std::shared_ptr<ChMaterialSurface>> mats;
+    if (create_bodies) {
+        mats.reserve(header->num_materials);
+        for (uint64_t i = 0; i < header->num_materials; i++)
+            mats.push_back(UnpackMaterial(ctype, materials[i]));
+    }
+
+    for (uint64_t i = 0; i < header->num_bodies; i++) {
+        const CheckpointBody& brec = bodies[i];
+
+        std::shared_ptr<ChBody> body;
+        if (create_bodies) {
+            body = std::shared_ptr<ChBody>(system->NewBody());
+            system->AddBody(body);
+        } else {
+            body = system->Get_bodylist()[i];
+        }
+
+        body->SetPos(UnpackVector(brec.pos));
+        body->SetRot(UnpackQuaternion(brec.rot));
+        body->SetPos_dt(UnpackVector(brec.pos_dt));
+        body->SetRot_dt(UnpackQuaternion(brec.rot_dt));
+
+        if (!create_bodies)
+            continue;
+
+        body->SetIdentifier(brec.identifier);
+        body->SetBodyFixed((brec.flags & 1) != 0);
+        body->SetCollide((brec.flags & 2) != 0);
+
+        body->SetMass(brec.mass);
+        body->SetInertiaXX(UnpackVector(brec.inertiaXX));
+        body->SetInertiaXY(UnpackVector(brec.inertiaXY));
+
+        body->GetCollisionModel()->ClearModel();
+        if (brec.first_shape + brec.num_shapes > header->num_shapes)
+            continue;
+        for (int j = 0; j < brec.num_shapes; j++) {
+            const CheckpointShape& srec = shapes[brec.first_shape + j];
+            if (srec.material < mats.size())
+                AddCheckpointShape(body.get(), mats[srec.material], srec);
+        }
+        body->GetCollisionModel()->SetFamilyGroup(brec.family_group);
+        body->GetCollisionModel()->SetFamilyMask(brec.family_mask);
+        body->GetCollisionModel()->BuildModel();
+    }
+
+    system->SetChTime(header->time);
+
+    // Preload the cache of contact reactions, used as warm start for the contacts found at the next step
+    auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer());
+    if (container && header->num_contacts > 0) {
+        const auto& bodylist = system->Get_bodylist();
+        size_t first_body = bodylist.size() - header->num_bodies;
+        auto& cache = container->GetReactionCache();
+        cache.Clear();
+        for (uint64_t i = 0; i < header->num_contacts; i++) {
+            const CheckpointContact& crec = contacts[i];
+            if (crec.bodyA >= header->num_bodies || crec.bodyB >= header->num_bodies)
+                continue;
+            cache.Add(bodylist[first_body + crec.bodyA].get(), bodylist[first_body + crec.bodyB].get(),
+                      UnpackVector(crec.pointA), UnpackVector(crec.reaction));
+        }
+        container->PreloadReactionCache();
+    }
+
+    // Restore the link reactions (solver warm start) if the links in the system match the checkpoint
+    int num_reactions = 0;
+    for (auto& link : system->Get_linklist()) {
+        if (link->IsActive())
+            num_reactions += link->GetDOC();
+    }
+    if (num_reactions > 0 && (uint64_t)num_reactions == header->num_reactions) {
+        ChVectorDynamic<> L = Eigen::Map<const ChVectorDynamic<>>(reactions, num_reactions);
+        unsigned int off_L = 0;
+        for (auto& link : system->Get_linklist()) {
+            if (link->IsActive()) {
+                link->IntStateScatterReactions(off_L, L);
+                off_L += link->GetDOC();
+            }
+        }
+    }
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // WriteShapesPovray
 //
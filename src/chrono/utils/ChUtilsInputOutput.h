@@ -25,6 +25,10 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteCheckpointBinary and ReadCheckpointBinary
+//  versioned binary variants of the above, with the same limitations. The
+//  checkpoint file is memory-mapped when read.
+//
 // WriteShapesPovray
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -144,6 +148,25 @@ bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 ChApi
 void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+/// Create a binary checkpoint file.
+/// In addition to the data in a CSV checkpoint (body states, collision shapes, and contact materials), the binary
+/// checkpoint includes the simulation time, as well as the reactions of the links and of the NSC contacts between
+/// bodies, which an iterative solver uses as warm start (see ChContactContainerNSC::PreloadReactionCache).
+/// Contact materials shared by several shapes are stored only once. Return false if a collision shape is not
+/// supported or if the file cannot be written.
+ChApi
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename);
+
+/// Read a binary checkpoint file.
+/// If create_bodies is true, new bodies (with their collision shapes and materials) are added to the system.
+/// Otherwise, the system must already contain the checkpointed bodies, in the same order, and only their states are
+/// restored. In both cases, the contact reactions are restored, and so are the link reactions if the links of the
+/// system match those in the checkpoint.
+/// The file is memory-mapped where supported, so that records are accessed in place without parsing.
+/// Return false if the file is not a valid checkpoint or is inconsistent with the system.
+ChApi
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename, bool create_bodies = true);
+
 /// Write CSV output file for PovRay.
 /// Each line contains information about one visualization asset shape, as follows:
 /// <pre>
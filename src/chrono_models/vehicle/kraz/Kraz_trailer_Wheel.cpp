@@ -48,8 +48,8 @@ Kraz_trailer_Wheel::Kraz_trailer_Wheel(const std::string& name) : ChWheel(name)
 void Kraz_trailer_Wheel::AddVisualizationAssets(VisualizationType vis) {
     if (vis == chrono::vehicle::VisualizationType::MESH) {
         chrono::ChQuaternion<> rot = (m_side == VehicleSide::LEFT) ? Q_from_AngZ(0) : Q_from_AngZ(chrono::CH_C_PI);
-        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        trimesh->LoadWavefrontMesh(GetDataFile(m_meshFile), false, false);
+        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(
+            *geometry::ChTriangleMeshConnected::LoadShared(GetDataFile(m_meshFile), false, false));
         trimesh->Transform(ChVector<>(0, m_offset, 0), ChMatrix33<>(rot));
         m_trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         m_trimesh_shape->Pos = ChVector<>(0, m_offset, 0);
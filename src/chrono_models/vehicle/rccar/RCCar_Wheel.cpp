@@ -61,8 +61,7 @@ RCCar_WheelRight::RCCar_WheelRight(const std::string& name) : RCCar_Wheel(name)
 // -----------------------------------------------------------------------------
 void RCCar_Wheel::AddVisualizationAssets(VisualizationType vis) {
     if (vis == VisualizationType::MESH) {
-        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        trimesh->LoadWavefrontMesh(GetMeshFile(), false, false);
+        auto trimesh = geometry::ChTriangleMeshConnected::LoadShared(GetMeshFile(), false, false);
         m_trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         m_trimesh_shape->SetMesh(trimesh);
         m_trimesh_shape->SetName(GetMeshName());
@@ -19,11 +19,14 @@
 //
 // =============================================================================
 
+#include <climits>
+
 #include "chrono_parallel/ChDataManager.h"
 #include "chrono_parallel/physics/Ch3DOFContainer.h"
 #include "chrono_parallel/collision/ChCollision.h"
 
 #include "chrono/core/ChStream.h"
+#include "chrono/physics/ChLink.h"
 
 using namespace chrono;
 using namespace chrono::collision;
@@ -49,6 +52,8 @@ ChParallelDataManager::ChParallelDataManager()
       num_rigid_tet_node_contacts(0),
       num_marker_tet_contacts(0),
       nnz_bilaterals(0),
+      num_islands(0),
+      num_sleeping_bodies(0),
       add_contact_callback(nullptr),
       composition_strategy(new ChMaterialCompositionStrategy) {
     node_container = chrono_types::make_shared<Ch3DOFContainer>();
@@ -161,3 +166,78 @@ void ChParallelDataManager::PrintMatrix(CompressedMatrix<real> src) {
         std::cout << "\n";
     }
 }
+
+// Representative body of the island containing body i (with path halving).
+static uint FindIsland(custom_vector<uint>& island, uint i) {
+    while (island[i] != i) {
+        island[i] = island[island[i]];
+        i = island[i];
+    }
+    return i;
+}
+
+// Merge the islands containing bodies a and b. The representative is the body with the smallest index.
+static void MergeIslands(custom_vector<uint>& island, uint a, uint b) {
+    a = FindIsland(island, a);
+    b = FindIsland(island, b);
+    if (a < b)
+        island[b] = a;
+    else if (b < a)
+        island[a] = b;
+}
+
+uint ChParallelDataManager::ComputeRigidIslands(const custom_vector<char>& fixed) {
+    custom_vector<uint>& island = host_data.island_rigid;
+    const custom_vector<char>& sleep = host_data.sleep_rigid;
+    const custom_vector<vec2>& bids = host_data.bids_rigid_rigid;
+    const uint num_bodies = num_rigid_bodies;
+
+    // Each awake body starts in its own island. A sleeping body starts in the island it fell asleep in, as the
+    // contacts between sleeping bodies are not generated.
+    island.resize(num_bodies, UINT_MAX);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        uint root = island[i];
+        if (fixed[i] || !sleep[i] || root >= num_bodies || fixed[root] || !sleep[root])
+            island[i] = i;
+    }
+
+    for (uint i = 0; i < num_rigid_contacts; i++) {
+        int a = bids[i].x;
+        int b = bids[i].y;
+        if (!fixed[a] && !fixed[b])
+            MergeIslands(island, a, b);
+    }
+
+    if (link_list) {
+        for (auto& item : *link_list) {
+            auto link = std::dynamic_pointer_cast<ChLink>(item);
+            if (!link)
+                continue;
+            ChBody* body1 = dynamic_cast<ChBody*>(link->GetBody1());
+            ChBody* body2 = dynamic_cast<ChBody*>(link->GetBody2());
+            if (!body1 || !body2)
+                continue;
+            uint a = body1->GetId();
+            uint b = body2->GetId();
+            if (a < num_bodies && b < num_bodies && !fixed[a] && !fixed[b])
+                MergeIslands(island, a, b);
+        }
+    }
+
+    // Point every body directly to the representative of its island
+    uint num_islands = 0;
+    for (uint i = 0; i < num_bodies; i++) {
+        if (fixed[i])
+            continue;
+        island[i] = FindIsland(island, i);
+        if (island[i] == i)
+            num_islands++;
+    }
+    for (uint i = 0; i < num_bodies; i++) {
+        if (fixed[i])
+            island[i] = UINT_MAX;
+    }
+
+    return num_islands;
+}
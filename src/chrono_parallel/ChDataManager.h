@@ -27,6 +27,7 @@
 
 // Chrono::Parallel headers
 #include "chrono_parallel/ChTimerParallel.h"
+#include "chrono_parallel/ChThreadTuner.h"
 #include "chrono_parallel/ChParallelDefines.h"
 #include "chrono_parallel/ChSettings.h"
 #include "chrono_parallel/ChMeasures.h"
@@ -198,9 +199,6 @@ typedef blaze::Subvector<const DynamicVector<real>> ConstSubVectorType;
 //// Viscosity
 //#define _GAMMAFFV_ submatrix(_gamma_,  _num_uni_ + _num_bil_ + 3 * _num_rf_c_ + _num_fluid_,  3 * _num_fluid_)
 
-// The maximum number of shear history contacts per smaller body (SMC)
-#define max_shear 20
-
 /// @addtogroup parallel_module
 /// @{
 
@@ -224,6 +222,18 @@ struct shape_container {
     custom_vector<real3> convex_rigid;     ///<
     custom_vector<int> tetrahedron_rigid;  ///<
 
+    // Instanced triangle meshes (TRIANGLEMESH shapes).
+    // The data of each mesh is stored once and shared by all shapes using it; the start index of such a shape is the
+    // index of its mesh. BVH node and triangle indices are relative to the first node and triangle of the mesh.
+    // Triangle IDs are unique over all mesh shapes; they identify the triangle contacts in the SMC contact history.
+    // Like all other shape data, the mesh data is never released (collision models cannot be removed).
+    custom_vector<vec2> mesh_rigid;        ///< first BVH node and first triangle of each mesh
+    custom_vector<real3> mesh_vertices;    ///< triangle vertices of all meshes (3 per triangle, in the mesh frame)
+    custom_vector<real3> mesh_bvh_min;     ///< lower corners of the BVH nodes of all meshes (in the mesh frame)
+    custom_vector<real3> mesh_bvh_max;     ///< upper corners of the BVH nodes of all meshes (in the mesh frame)
+    custom_vector<vec2> mesh_bvh_node;     ///< (right child, 0) for inner nodes, (first triangle, count) for leaves
+    custom_vector<int> mesh_triangle_id;   ///< ID of the first triangle of each shape (-1 if not an instanced mesh)
+
     custom_vector<real3> triangle_global;
     custom_vector<real3> obj_data_A_global;
     custom_vector<quaternion> obj_data_R_global;
@@ -241,6 +251,7 @@ struct host_container {
 
     custom_vector<long long> pair_shapeIDs;     ///< Shape IDs for each shape pair (encoded in a single long long)
     custom_vector<long long> contact_shapeIDs;  ///< Shape IDs for each contact (encoded in a single long long)
+    custom_vector<int> contact_triangle;        ///< Instanced mesh triangle for each contact (-1 if no mesh)
 
     // Contact data
     custom_vector<real3> norm_rigid_rigid;
@@ -291,8 +302,10 @@ struct host_container {
     custom_vector<real3> ct_body_torque;  ///< Total contact torque on these bodies
 
     // Contact shear history (SMC)
-    custom_vector<vec3> shear_neigh;          ///< Neighbor list of contacting bodies and shapes
-    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each neighbor
+    // Between steps, these hold the compacted history of the shape pairs in contact;
+    // during a step, they form an open-addressing hash table keyed by shape pair (or by shape and mesh triangle).
+    custom_vector<long long> shear_keys;      ///< Shape pair IDs for each history entry (encoded in a single long long)
+    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each history entry
     custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude per contact pair
     custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact pair
 
@@ -332,6 +345,13 @@ struct host_container {
     custom_vector<char> collide_rigid;
     custom_vector<real> mass_rigid;
 
+    /// Sleeping state of each body: 0 if awake, 1 if the body fell asleep at the end of the
+    /// last step, 2 if the body was already sleeping (its AABBs are then up to date).
+    custom_vector<char> sleep_rigid;
+    /// Island of each body, identified by the index of one of its bodies (UINT_MAX for fixed bodies).
+    /// Sleeping bodies keep the island in which they fell asleep, so that they are woken up together.
+    custom_vector<uint> island_rigid;
+
     // Information for 3dof nodes
     custom_vector<real3> pos_3dof;
     custom_vector<real3> sorted_pos_3dof;
@@ -457,11 +477,15 @@ class CH_PARALLEL_API ChParallelDataManager {
     uint num_marker_tet_contacts;      ///< The number of contacts between tetrahedron and fluid markers
     uint num_rigid_tet_node_contacts;  ///< The number of contacts between tetrahedron nodes and rigid bodies
     uint nnz_bilaterals;               ///< The number of non-zero entries in the bilateral Jacobian
+    uint num_islands;                  ///< The number of islands of (non-fixed) rigid bodies
+    uint num_sleeping_bodies;          ///< The number of sleeping rigid bodies
 
     /// Flag indicating whether or not the contact forces are current (NSC only).
     bool Fc_current;
     /// This object hold all of the timers for the system.
     ChTimerParallel system_timer;
+    /// Tuner for the number of threads used in each phase of a time step.
+    ChThreadTuner thread_tuner;
     /// Structure that contains all settings for the system, collision detection and the solver.
     settings_container settings;
     measures_container measures;
@@ -481,6 +505,12 @@ class CH_PARALLEL_API ChParallelDataManager {
     int ExportCurrentSystem(std::string output_dir);
 
     void PrintMatrix(CompressedMatrix<real> src);
+
+    /// Partition the rigid bodies into islands connected by rigid-rigid contacts and bilateral links.
+    /// Fixed bodies (as flagged in the given vector) do not connect islands. Sleeping bodies remain in the island
+    /// stored in host_data.island_rigid, which is overwritten with the new island of each body.
+    /// Return the number of islands.
+    uint ComputeRigidIslands(const custom_vector<char>& fixed);
 };
 
 /// @} parallel_module
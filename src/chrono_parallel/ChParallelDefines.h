@@ -80,6 +80,26 @@ static std::ostream null_stream(&null_buffer);
 /// @addtogroup parallel_module
 /// @{
 
+#if defined(CHRONO_PARALLEL_NATIVE_PRIMITIVES)
+
+// Native OpenMP implementations of the primitives on the collision detection hot paths
+#include "chrono_parallel/ChParallelPrimitives.h"
+
+#define Thrust_Inclusive_Scan_Sum(x, y) \
+    chrono::ParallelInclusiveScan(x);   \
+    y = x.back();
+#define Thrust_Sort_By_Key(x, y) chrono::ParallelSortByKey(x, y)
+#define Run_Length_Encode(y, z, w) chrono::ParallelRunLengthEncode(y, z, w)
+#define Thrust_Inclusive_Scan(x) chrono::ParallelInclusiveScan(x)
+#define Thrust_Exclusive_Scan(x) chrono::ParallelExclusiveScan(x)
+#define Thrust_Fill(x, y) std::fill(x.begin(), x.end(), y)
+#define Thrust_Count(x, y) chrono::ParallelCount(x, y)
+#define Thrust_Max(x) chrono::ParallelMax(x)
+#define Thrust_Min(x) chrono::ParallelMin(x)
+#define Thrust_Total(x) chrono::ParallelReduce(x)
+
+#else
+
 #define Thrust_Inclusive_Scan_Sum(x, y)                               \
     thrust::inclusive_scan(THRUST_PAR x.begin(), x.end(), x.begin()); \
     y = x.back();
@@ -93,13 +113,16 @@ static std::ostream null_stream(&null_buffer);
 #define Thrust_Inclusive_Scan(x) thrust::inclusive_scan(THRUST_PAR x.begin(), x.end(), x.begin())
 #define Thrust_Exclusive_Scan(x) thrust::exclusive_scan(THRUST_PAR x.begin(), x.end(), x.begin())
 #define Thrust_Fill(x, y) thrust::fill(x.begin(), x.end(), y)
-#define Thrust_Sort(x) thrust::sort(THRUST_PAR x.begin(), x.end())
 #define Thrust_Count(x, y) thrust::count(THRUST_PAR x.begin(), x.end(), y)
-#define Thrust_Sequence(x) thrust::sequence(x.begin(), x.end())
-#define Thrust_Equal(x, y) thrust::equal(THRUST_PAR x.begin(), x.end(), y.begin())
 #define Thrust_Max(x) x[thrust::max_element(THRUST_PAR x.begin(), x.end()) - x.begin()]
 #define Thrust_Min(x) x[thrust::min_element(THRUST_PAR x.begin(), x.end()) - x.begin()]
 #define Thrust_Total(x) thrust::reduce(THRUST_PAR x.begin(), x.end())
+
+#endif
+
+#define Thrust_Sort(x) thrust::sort(THRUST_PAR x.begin(), x.end())
+#define Thrust_Sequence(x) thrust::sequence(x.begin(), x.end())
+#define Thrust_Equal(x, y) thrust::equal(THRUST_PAR x.begin(), x.end(), y.begin())
 #define Thrust_Unique(x) thrust::unique(THRUST_PAR x.begin(), x.end()) - x.begin();
 #define DBG(x) printf(x);
 
@@ -126,7 +149,8 @@ enum class SolverType {
     GAUSS_SEIDEL,                ///< Gauss-Seidel
     PDIP,                        ///< Primal-Dual Interior Point
     BB,                          ///< Barzilai-Borwein
-    SPGQP                        ///< Spectral Projected Gradient (QP projection)
+    SPGQP,                       ///< Spectral Projected Gradient (QP projection)
+    ADMM                         ///< Alternating Direction Method of Multipliers
 };
 
 /// Enumeration for solver mode.
@@ -0,0 +1,452 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: native OpenMP implementations of the data-parallel primitives
+// (sort by key, scans, reductions) used by Chrono::Parallel. These are used in
+// place of Thrust if CHRONO_PARALLEL_NATIVE_PRIMITIVES is defined. The counting
+// sort has no Thrust counterpart and is always available.
+//
+// All functions reuse scratch buffers owned by the calling thread, so that no
+// memory is allocated once the buffers have grown to the problem size.
+//
+// =============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "chrono/utils/ChTracer.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace chrono {
+
+/// @addtogroup parallel_module
+/// @{
+
+namespace primitives {
+
+// Problems smaller than this are processed sequentially.
+static const size_t serial_threshold = 1 << 14;
+
+inline int NumThreads() {
+#ifdef _OPENMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int ThreadNum() {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// Range [begin, end) of the elements processed by the calling thread in a parallel region.
+inline void ThreadRange(size_t n, size_t& begin, size_t& end) {
+    size_t nt = (size_t)NumThreads();
+    size_t tid = (size_t)ThreadNum();
+    begin = (n * tid) / nt;
+    end = (n * (tid + 1)) / nt;
+}
+
+// Scratch buffer of the calling thread, persistent across calls.
+template <typename T, int ID = 0>
+std::vector<T>& Scratch() {
+    thread_local static std::vector<T> buffer;
+    return buffer;
+}
+
+// Map an integral key to an unsigned key with the same ordering.
+template <typename K>
+typename std::make_unsigned<K>::type RadixKey(K key) {
+    typedef typename std::make_unsigned<K>::type U;
+    return std::is_signed<K>::value ? U(key) ^ (U(1) << (8 * sizeof(K) - 1)) : U(key);
+}
+
+}  // end namespace primitives
+
+/// In-place exclusive prefix sum.
+template <typename T>
+void ParallelExclusiveScan(std::vector<T>& x) {
+    const size_t n = x.size();
+    if (n < primitives::serial_threshold) {
+        T sum = T(0);
+        for (size_t i = 0; i < n; i++) {
+            T v = x[i];
+            x[i] = sum;
+            sum += v;
+        }
+        return;
+    }
+
+    std::vector<T>& partial = primitives::Scratch<T>();
+#pragma omp parallel
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads() + 1, T(0));
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        T sum = T(0);
+        for (size_t i = begin; i < end; i++)
+            sum += x[i];
+        partial[primitives::ThreadNum() + 1] = sum;
+
+#pragma omp barrier
+#pragma omp single
+        for (size_t t = 1; t < partial.size(); t++)
+            partial[t] += partial[t - 1];
+
+        sum = partial[primitives::ThreadNum()];
+        for (size_t i = begin; i < end; i++) {
+            T v = x[i];
+            x[i] = sum;
+            sum += v;
+        }
+    }
+}
+
+/// In-place inclusive prefix sum.
+template <typename T>
+void ParallelInclusiveScan(std::vector<T>& x) {
+    const size_t n = x.size();
+    if (n < primitives::serial_threshold) {
+        for (size_t i = 1; i < n; i++)
+            x[i] += x[i - 1];
+        return;
+    }
+
+    std::vector<T>& partial = primitives::Scratch<T>();
+#pragma omp parallel
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads() + 1, T(0));
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        T sum = T(0);
+        for (size_t i = begin; i < end; i++)
+            sum += x[i];
+        partial[primitives::ThreadNum() + 1] = sum;
+
+#pragma omp barrier
+#pragma omp single
+        for (size_t t = 1; t < partial.size(); t++)
+            partial[t] += partial[t - 1];
+
+        sum = partial[primitives::ThreadNum()];
+        for (size_t i = begin; i < end; i++) {
+            sum += x[i];
+            x[i] = sum;
+        }
+    }
+}
+
+/// Sum of all elements.
+template <typename T>
+T ParallelReduce(const std::vector<T>& x) {
+    const size_t n = x.size();
+    if (n < primitives::serial_threshold) {
+        T sum = T(0);
+        for (size_t i = 0; i < n; i++)
+            sum += x[i];
+        return sum;
+    }
+
+    std::vector<T>& partial = primitives::Scratch<T>();
+#pragma omp parallel
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads(), T(0));
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        T sum = T(0);
+        for (size_t i = begin; i < end; i++)
+            sum += x[i];
+        partial[primitives::ThreadNum()] = sum;
+    }
+
+    T sum = T(0);
+    for (auto p : partial)
+        sum += p;
+    return sum;
+}
+
+/// Number of elements equal to the given value.
+template <typename T, typename V>
+size_t ParallelCount(const std::vector<T>& x, const V& value) {
+    const int n = (int)x.size();
+    size_t count = 0;
+#pragma omp parallel for reduction(+ : count) if (x.size() >= primitives::serial_threshold)
+    for (int i = 0; i < n; i++) {
+        if (x[i] == value)
+            count++;
+    }
+    return count;
+}
+
+/// Largest element (the vector must not be empty).
+template <typename T>
+T ParallelMax(const std::vector<T>& x) {
+    const size_t n = x.size();
+    if (n < primitives::serial_threshold)
+        return *std::max_element(x.begin(), x.end());
+
+    std::vector<T>& partial = primitives::Scratch<T>();
+#pragma omp parallel
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads(), x[0]);
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        if (begin < end)
+            partial[primitives::ThreadNum()] = *std::max_element(x.begin() + begin, x.begin() + end);
+    }
+
+    return *std::max_element(partial.begin(), partial.end());
+}
+
+/// Smallest element (the vector must not be empty).
+template <typename T>
+T ParallelMin(const std::vector<T>& x) {
+    const size_t n = x.size();
+    if (n < primitives::serial_threshold)
+        return *std::min_element(x.begin(), x.end());
+
+    std::vector<T>& partial = primitives::Scratch<T>();
+#pragma omp parallel
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads(), x[0]);
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        if (begin < end)
+            partial[primitives::ThreadNum()] = *std::min_element(x.begin() + begin, x.begin() + end);
+    }
+
+    return *std::min_element(partial.begin(), partial.end());
+}
+
+/// Stable sort of (integral) keys, with the values reordered accordingly.
+/// This is a least-significant-digit radix sort on 8-bit digits. Only the digits in which the smallest and largest
+/// keys differ are processed, so that a typical sort of bin indices only requires two or three passes.
+template <typename K, typename V>
+void ParallelSortByKey(std::vector<K>& keys, std::vector<V>& values) {
+    static_assert(std::is_integral<K>::value, "ParallelSortByKey requires integral keys");
+    typedef typename std::make_unsigned<K>::type U;
+
+    const size_t n = keys.size();
+    if (n < 2)
+        return;
+
+    // Find the number of digits to process
+    U kmin = primitives::RadixKey(keys[0]);
+    U kmax = kmin;
+#pragma omp parallel if (n >= primitives::serial_threshold)
+    {
+        // Local extrema start from the first key, not from kmin/kmax which other threads may be updating
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        U my_min = primitives::RadixKey(keys[0]);
+        U my_max = my_min;
+        for (size_t i = begin; i < end; i++) {
+            U k = primitives::RadixKey(keys[i]);
+            my_min = std::min(my_min, k);
+            my_max = std::max(my_max, k);
+        }
+#pragma omp critical
+        {
+            kmin = std::min(kmin, my_min);
+            kmax = std::max(kmax, my_max);
+        }
+    }
+    int num_passes = 0;
+    for (U diff = kmin ^ kmax; diff != 0; diff >>= 8)
+        num_passes++;
+    if (num_passes == 0)
+        return;
+
+    std::vector<K>& key_buffer = primitives::Scratch<K, 1>();
+    std::vector<V>& value_buffer = primitives::Scratch<V, 2>();
+    std::vector<size_t>& hist = primitives::Scratch<size_t, 3>();
+    key_buffer.resize(n);
+    value_buffer.resize(n);
+
+    K* src_k = keys.data();
+    V* src_v = values.data();
+    K* dst_k = key_buffer.data();
+    V* dst_v = value_buffer.data();
+
+    for (int pass = 0; pass < num_passes; pass++) {
+        const int shift = 8 * pass;
+#pragma omp parallel if (n >= primitives::serial_threshold)
+        {
+            CH_TRACE("ParallelSortByKey");
+            const int nt = primitives::NumThreads();
+            const int tid = primitives::ThreadNum();
+#pragma omp single
+            hist.assign(256 * nt, 0);
+
+            size_t begin, end;
+            primitives::ThreadRange(n, begin, end);
+            size_t* my_hist = &hist[256 * tid];
+            for (size_t i = begin; i < end; i++)
+                my_hist[(primitives::RadixKey(src_k[i]) >> shift) & 0xff]++;
+
+#pragma omp barrier
+#pragma omp single
+            {
+                // Offsets ordered by digit first, then by thread, to keep the sort stable
+                size_t sum = 0;
+                for (int d = 0; d < 256; d++) {
+                    for (int t = 0; t < nt; t++) {
+                        size_t count = hist[256 * t + d];
+                        hist[256 * t + d] = sum;
+                        sum += count;
+                    }
+                }
+            }
+
+            for (size_t i = begin; i < end; i++) {
+                size_t j = my_hist[(primitives::RadixKey(src_k[i]) >> shift) & 0xff]++;
+                dst_k[j] = src_k[i];
+                dst_v[j] = src_v[i];
+            }
+        }
+        std::swap(src_k, dst_k);
+        std::swap(src_v, dst_v);
+    }
+
+    // After an odd number of passes the sorted data is in the scratch buffers
+    if (num_passes % 2 == 1) {
+        keys.swap(key_buffer);
+        if (values.size() == n)
+            values.swap(value_buffer);
+        else
+            std::copy(value_buffer.begin(), value_buffer.end(), values.begin());
+    }
+}
+
+/// Stable counting sort of a sequence of small integral keys in [0, num_buckets).
+/// The keys are not moved; instead, 'order' receives the indices of the keys in sorted order and 'starts' (of size
+/// num_buckets + 1) the start of each bucket in 'order'.
+template <typename K, typename I>
+void ParallelCountingSort(const std::vector<K>& keys,
+                          size_t num_buckets,
+                          std::vector<I>& order,
+                          std::vector<size_t>& starts) {
+    const size_t n = keys.size();
+    order.resize(n);
+    starts.assign(num_buckets + 1, 0);
+
+    std::vector<size_t>& hist = primitives::Scratch<size_t, 5>();
+#pragma omp parallel if (n >= primitives::serial_threshold)
+    {
+        const int nt = primitives::NumThreads();
+        const int tid = primitives::ThreadNum();
+#pragma omp single
+        hist.assign(num_buckets * nt, 0);
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        size_t* my_hist = &hist[num_buckets * tid];
+        for (size_t i = begin; i < end; i++)
+            my_hist[keys[i]]++;
+
+#pragma omp barrier
+#pragma omp single
+        {
+            // Offsets ordered by bucket first, then by thread, to keep the sort stable
+            size_t sum = 0;
+            for (size_t b = 0; b < num_buckets; b++) {
+                starts[b] = sum;
+                for (int t = 0; t < nt; t++) {
+                    size_t count = hist[num_buckets * t + b];
+                    hist[num_buckets * t + b] = sum;
+                    sum += count;
+                }
+            }
+            starts[num_buckets] = sum;
+        }
+
+        for (size_t i = begin; i < end; i++)
+            order[my_hist[keys[i]]++] = I(i);
+    }
+}
+
+/// Run-length encoding of a sorted sequence.
+/// The distinct keys are written to 'unique' and the length of each run to 'counts' (both must be large enough).
+/// Return the number of runs.
+template <typename K, typename C>
+size_t ParallelRunLengthEncode(const std::vector<K>& keys, std::vector<K>& unique, std::vector<C>& counts) {
+    const size_t n = keys.size();
+    if (n == 0)
+        return 0;
+
+    // A run starts at index i if i == 0 or keys[i] != keys[i - 1].
+    // The run starts are counted per thread, then each thread writes its runs at the proper offset.
+    std::vector<size_t>& partial = primitives::Scratch<size_t, 4>();
+    size_t num_runs = 0;
+#pragma omp parallel if (n >= primitives::serial_threshold)
+    {
+#pragma omp single
+        partial.assign(primitives::NumThreads() + 1, 0);
+
+        size_t begin, end;
+        primitives::ThreadRange(n, begin, end);
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+            if (i == 0 || keys[i] != keys[i - 1])
+                count++;
+        }
+        partial[primitives::ThreadNum() + 1] = count;
+
+#pragma omp barrier
+#pragma omp single
+        {
+            for (size_t t = 1; t < partial.size(); t++)
+                partial[t] += partial[t - 1];
+            num_runs = partial.back();
+        }
+
+        size_t run = partial[primitives::ThreadNum()];
+        for (size_t i = begin; i < end; i++) {
+            if (i == 0 || keys[i] != keys[i - 1]) {
+                unique[run] = keys[i];
+                // find the end of this run (it may extend into the range of the next thread)
+                size_t j = i + 1;
+                while (j < n && keys[j] == keys[i])
+                    j++;
+                counts[run] = C(j - i);
+                run++;
+            }
+        }
+    }
+
+    return num_runs;
+}
+
+/// @} parallel_module
+
+}  // end namespace chrono
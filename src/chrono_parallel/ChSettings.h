@@ -55,6 +55,10 @@ class collision_settings {
         narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
         grid_density = 5;
         fixed_bins = true;
+        use_incremental_broadphase = false;
+        incremental_margin = 0;
+        use_sorted_narrowphase = false;
+        use_mesh_instancing = false;
     }
 
     real3 min_bounding_point, max_bounding_point;
@@ -85,6 +89,27 @@ class collision_settings {
     real grid_density;
     /// Use fixed number of bins instead of tuning them.
     bool fixed_bins;
+    /// Use the incremental broadphase. The grid, bin assignments, and candidate pairs of the previous step are kept
+    /// and only the shapes whose AABB moved outside of an enlarged AABB (inflated by incremental_margin) are re-binned.
+    /// A full broadphase is performed if too many shapes moved, if a shape left the grid, or if the number of shapes
+    /// changed. This is most effective for quasi-static granular beds.
+    /// Not used if the system contains fluid or FEA collision objects.
+    bool use_incremental_broadphase;
+    /// Margin used to enlarge the shape AABBs in the incremental broadphase.
+    /// A larger margin results in fewer re-binned shapes, but more candidate pairs for the narrowphase.
+    /// If zero, the collision envelope is used.
+    real incremental_margin;
+    /// Sort the candidate pairs by shape types before the narrowphase (NARROWPHASE_R and NARROWPHASE_HYBRID_MPR only).
+    /// Sphere-sphere, sphere-box, sphere-capsule and sphere-triangle pairs are then each processed in a separate loop
+    /// calling a single collision function, while all other pairs go through the generic dispatch. This is most
+    /// effective for sphere-dominated systems.
+    bool use_sorted_narrowphase;
+    /// Add each triangle mesh as a single collision shape, with its triangles and bounding volume hierarchy stored
+    /// once per mesh object and shared by all collision models using it. The broadphase then sees one AABB per mesh
+    /// and the mesh triangles overlapping a shape are found with the BVH. If false, each mesh triangle is added as a
+    /// separate shape. Instanced meshes do not collide with other triangle meshes, fluid, or FEA collision objects.
+    /// This setting applies to the collision models added after it is changed.
+    bool use_mesh_instancing;
 };
 
 /// Chrono::Parallel solver_settings.
@@ -128,6 +153,10 @@ class solver_settings {
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        max_iteration_inner = 50;
+        admm_rho = 0;
+        admm_adaptive_rho = true;
+        pdip_barrier_factor = 10;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -216,6 +245,18 @@ class solver_settings {
     real tolerance_objective;
     /// Compute residual every x iterations.
     int skip_residual;
+
+    /// Maximum number of conjugate gradient iterations for the linear systems solved
+    /// at each outer iteration of the PDIP and ADMM solvers.
+    uint max_iteration_inner;
+    /// ADMM penalty parameter. If zero, it is estimated from the diagonal of the
+    /// Schur complement at the start of each solve.
+    real admm_rho;
+    /// If true, the ADMM penalty parameter is increased or decreased during the solve
+    /// to keep the primal and dual residuals balanced.
+    bool admm_adaptive_rho;
+    /// Factor by which PDIP reduces the duality gap targeted at each iteration.
+    real pdip_barrier_factor;
 };
 
 /// Aggregate of all settings for Chrono::Parallel.
@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: adaptive tuning of the number of OpenMP threads used in each
+// phase of a Chrono::Parallel time step.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "chrono_parallel/ChParallelDefines.h"
+#include "chrono_parallel/ChThreadTuner.h"
+
+namespace chrono {
+
+// Inverse of the golden ratio
+static const double inv_phi = 0.5 * (std::sqrt(5.0) - 1);
+
+// A phase is tuned again if its time changes by more than this factor
+static const double retune_ratio = 2.0;
+
+ChThreadTuner::ChThreadTuner()
+    : m_enabled(false), m_min_threads(1), m_max_threads(1), m_sample_steps(10), m_retune_interval(500) {
+    for (auto& search : m_phases)
+        Restart(search);
+}
+
+void ChThreadTuner::Enable(int min_threads, int max_threads) {
+    m_enabled = true;
+    m_min_threads = std::max(min_threads, 1);
+    m_max_threads = std::max(max_threads, m_min_threads);
+    for (auto& search : m_phases)
+        Restart(search);
+}
+
+void ChThreadTuner::Apply(Phase phase) const {
+#ifdef _OPENMP
+    if (m_enabled)
+        omp_set_num_threads(m_phases[phase].candidate);
+#endif
+}
+
+void ChThreadTuner::ProcessStep(const PhaseTimes& times) {
+    if (!m_enabled)
+        return;
+
+    for (int ip = 0; ip < NUM_PHASES; ip++) {
+        PhaseSearch& search = m_phases[ip];
+        search.time += times[ip];
+        search.steps++;
+
+        if (search.converged) {
+            search.held_steps++;
+            if (search.held_steps >= m_retune_interval) {
+                Restart(search);
+                continue;
+            }
+            // Check whether the phase time drifted away from the one measured during the search
+            if (search.steps == m_sample_steps) {
+                double time = search.time / search.steps;
+                double cost = search.costs[search.candidate - m_min_threads];
+                search.steps = 0;
+                search.time = 0;
+                if (time > retune_ratio * cost || time * retune_ratio < cost)
+                    Restart(search);
+            }
+            continue;
+        }
+
+        if (search.steps < m_sample_steps)
+            continue;
+
+        search.costs[search.candidate - m_min_threads] = search.time / search.steps;
+        search.steps = 0;
+        search.time = 0;
+        Advance(search);
+
+        if (search.converged) {
+            LOG(TRACE) << "ChThreadTuner: " << GetPhaseName(Phase(ip)) << " threads set to " << search.candidate;
+        }
+    }
+}
+
+double ChThreadTuner::GetPhaseTime(Phase phase) const {
+    const PhaseSearch& search = m_phases[phase];
+    if (!search.converged)
+        return -1;
+    return search.costs[search.candidate - m_min_threads];
+}
+
+const char* ChThreadTuner::GetPhaseName(Phase phase) {
+    switch (phase) {
+        case UPDATE:
+            return "update";
+        case BROADPHASE:
+            return "broadphase";
+        case NARROWPHASE:
+            return "narrowphase";
+        case SOLVER:
+            return "solver";
+        default:
+            return "unknown";
+    }
+}
+
+void ChThreadTuner::PrintReport() const {
+    std::cout << "Thread Tuner Report:" << std::endl;
+    std::cout << "------------" << std::endl;
+    for (int ip = 0; ip < NUM_PHASES; ip++) {
+        std::cout << "Phase:\t" << GetPhaseName(Phase(ip)) << "\t" << GetNumThreads(Phase(ip));
+        if (IsConverged(Phase(ip)))
+            std::cout << "\t" << GetPhaseTime(Phase(ip)) << "\n";
+        else
+            std::cout << "\tsearching\n";
+    }
+    std::cout << "------------" << std::endl;
+}
+
+void ChThreadTuner::Restart(PhaseSearch& search) {
+    search.lo = m_min_threads;
+    search.hi = m_max_threads;
+    search.converged = false;
+    search.steps = 0;
+    search.held_steps = 0;
+    search.time = 0;
+    search.costs.assign(m_max_threads - m_min_threads + 1, -1.0);
+    Advance(search);
+}
+
+// Golden-section search over the integer bracket [lo, hi].
+// Measured costs are cached, so that the interior point carried over from the previous iteration is not measured
+// again. The search stops as soon as it needs a cost that was not measured yet (the candidate is set to that number
+// of threads) or when the bracket is small enough for an exhaustive search.
+void ChThreadTuner::Advance(PhaseSearch& search) {
+    auto cost = [&](int n) { return search.costs[n - m_min_threads]; };
+
+    while (search.hi - search.lo >= 3) {
+        int width = search.hi - search.lo;
+        int offset = (int)std::lround(width * inv_phi);
+        int c = search.hi - offset;
+        int d = search.lo + offset;
+        if (c >= d)
+            d = c + 1;
+
+        if (cost(c) < 0) {
+            search.candidate = c;
+            return;
+        }
+        if (cost(d) < 0) {
+            search.candidate = d;
+            return;
+        }
+
+        if (cost(c) <= cost(d))
+            search.hi = d;
+        else
+            search.lo = c;
+    }
+
+    // Small bracket: pick the best of all thread counts in the bracket
+    int best = search.lo;
+    for (int n = search.lo; n <= search.hi; n++) {
+        if (cost(n) < 0) {
+            search.candidate = n;
+            return;
+        }
+        if (cost(n) < cost(best))
+            best = n;
+    }
+
+    search.candidate = best;
+    search.converged = true;
+}
+
+}  // end namespace chrono
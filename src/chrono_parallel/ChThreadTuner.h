@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: adaptive tuning of the number of OpenMP threads used in each
+// phase of a Chrono::Parallel time step.
+//
+// =============================================================================
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "chrono_parallel/ChApiParallel.h"
+
+namespace chrono {
+
+/// @addtogroup parallel_module
+/// @{
+
+/// Adaptive tuner for the number of OpenMP threads used in the phases of a time step.
+/// A separate thread count is selected for each phase (update, broadphase, narrowphase, solver), since these phases
+/// have very different parallel scalability. For each phase, a golden-section search over the allowed range of
+/// thread counts is performed, each candidate being evaluated by averaging the phase time over a number of steps.
+/// Once the search has converged, the selected thread count is kept until a given number of steps has elapsed or
+/// until the phase time changes significantly (e.g., because the number of contacts changed), at which point a new
+/// search is started.
+class CH_PARALLEL_API ChThreadTuner {
+  public:
+    /// Phases of a time step with separately tuned number of threads.
+    enum Phase { UPDATE, BROADPHASE, NARROWPHASE, SOLVER, NUM_PHASES };
+
+    /// Times (in seconds) spent in each phase during one step.
+    typedef std::array<double, NUM_PHASES> PhaseTimes;
+
+    ChThreadTuner();
+
+    /// Enable thread tuning between the specified limits.
+    /// Any ongoing search is restarted.
+    void Enable(int min_threads, int max_threads);
+
+    /// Disable thread tuning.
+    void Disable() { m_enabled = false; }
+
+    /// Return true if thread tuning is enabled.
+    bool IsEnabled() const { return m_enabled; }
+
+    /// Set the number of steps over which the time of a candidate thread count is averaged (default: 10).
+    void SetSampleSteps(int num_steps) { m_sample_steps = num_steps > 0 ? num_steps : 1; }
+
+    /// Set the number of steps after which the thread counts are tuned again (default: 500).
+    void SetRetuneInterval(int num_steps) { m_retune_interval = num_steps; }
+
+    /// Set the number of OpenMP threads for the specified phase.
+    /// This function does nothing if thread tuning is not enabled.
+    void Apply(Phase phase) const;
+
+    /// Record the phase times of the last step and advance the search.
+    void ProcessStep(const PhaseTimes& times);
+
+    /// Return the number of threads currently used for the specified phase.
+    int GetNumThreads(Phase phase) const { return m_phases[phase].candidate; }
+
+    /// Return true if the search for the specified phase has converged.
+    bool IsConverged(Phase phase) const { return m_phases[phase].converged; }
+
+    /// Return the average phase time (in seconds) measured for the selected number of threads.
+    /// Return a negative value if the search for the specified phase has not converged.
+    double GetPhaseTime(Phase phase) const;
+
+    /// Return the name of the specified phase.
+    static const char* GetPhaseName(Phase phase);
+
+    /// Print the currently selected number of threads for all phases.
+    void PrintReport() const;
+
+  private:
+    struct PhaseSearch {
+        int lo;                     ///< lower end of search bracket
+        int hi;                     ///< upper end of search bracket
+        int candidate;              ///< number of threads currently used
+        bool converged;             ///< true if the search has converged
+        int steps;                  ///< number of steps recorded for the current candidate (or window)
+        int held_steps;             ///< number of steps since convergence
+        double time;                ///< accumulated phase time for the current candidate (or window)
+        std::vector<double> costs;  ///< average phase time for each number of threads (negative if not measured)
+    };
+
+    void Restart(PhaseSearch& search);
+    void Advance(PhaseSearch& search);
+
+    bool m_enabled;
+    int m_min_threads;
+    int m_max_threads;
+    int m_sample_steps;
+    int m_retune_interval;
+    std::array<PhaseSearch, NUM_PHASES> m_phases;
+};
+
+/// @} parallel_module
+
+}  // end namespace chrono
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChTracer.h"
 
 #include "chrono_parallel/ChParallelDefines.h"
 #include "chrono_parallel/math/ChParallelMath.h"
@@ -33,7 +34,7 @@ namespace chrono {
 /// @{
 
 struct TimerData {
-    TimerData() : runs(0) {}
+    TimerData() : runs(0), trace_name(nullptr), trace_start(-1) {}
 
     void Reset() {
         runs = 0;
@@ -46,11 +47,21 @@ struct TimerData {
     void start() {
         runs++;
         timer.start();
+        if (trace_name && utils::ChTracer::IsEnabled())
+            trace_start = utils::ChTracer::Now();
+    }
+    void stop() {
+        timer.stop();
+        if (trace_start >= 0) {
+            utils::ChTracer::Record(trace_name, trace_start, utils::ChTracer::Now());
+            trace_start = -1;
+        }
     }
-    void stop() { timer.stop(); }
 
     ChTimer<double> timer;
     int runs;
+    const char* trace_name;  ///< name of the traced events (see ChTracer)
+    int64_t trace_start;     ///< start time of the traced event (negative if not traced)
 };
 
 class CH_PARALLEL_API ChTimerParallel {
@@ -60,6 +71,7 @@ class CH_PARALLEL_API ChTimerParallel {
 
     void AddTimer(const std::string& name) {
         TimerData temp;
+        temp.trace_name = utils::ChTracer::Intern(name);
         timer_list[name] = temp;
         total_timers++;
     }
@@ -123,6 +123,14 @@ void ChCAABBGenerator::GenerateAABB() {
         custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
         custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
 
+        // The AABBs of bodies that were already sleeping at the previous step are unchanged. They are only shifted
+        // back to absolute coordinates (they were offset in the broadphase).
+        const custom_vector<char>& sleep_rigid = data_manager->host_data.sleep_rigid;
+        const real3 global_origin = data_manager->measures.collision.global_origin;
+        const bool reuse_sleeping = aabb_min.size() == num_rigid_shapes &&
+                                    sleep_rigid.size() == data_manager->num_rigid_bodies &&
+                                    data_manager->num_sleeping_bodies != 0;
+
         aabb_min.resize(num_rigid_shapes);
         aabb_max.resize(num_rigid_shapes);
 
@@ -139,6 +147,12 @@ void ChCAABBGenerator::GenerateAABB() {
             if (id == UINT_MAX)
                 continue;
 
+            if (reuse_sleeping && sleep_rigid[id] == 2) {
+                aabb_min[index] += global_origin;
+                aabb_max[index] += global_origin;
+                continue;
+            }
+
             real3 position = pos_rigid[id];
             quaternion rotation = Mult(body_rot[id], local_rot);
             real3 temp_min;
@@ -184,6 +198,15 @@ void ChCAABBGenerator::GenerateAABB() {
 
                 ComputeAABBTriangle(A, B, C, temp_min, temp_max);
 
+            } else if (type == ChCollisionShape::Type::TRIANGLEMESH) {
+                // Box bounding the root of the mesh BVH, expressed in the shape frame
+                int root = data_manager->shape_data.mesh_rigid[start].x;
+                real3 bmin = data_manager->shape_data.mesh_bvh_min[root];
+                real3 bmax = data_manager->shape_data.mesh_bvh_max[root];
+                real3 center = local_pos + Rotate((bmin + bmax) * 0.5, local_rot);
+                real3 B = (bmax - bmin) * 0.5 + collision_envelope;
+                ComputeAABBBox(B, center, position, rotation, body_rot[id], temp_min, temp_max);
+
             } else {
                 continue;
             }
@@ -80,6 +80,34 @@ void ChCBroadphase::RigidBoundingBox() {
     // Vectors of length = number of rigid bodies
     const custom_vector<char>& collide_rigid = data_manager->host_data.collide_rigid;
 
+#if defined(CHRONO_PARALLEL_NATIVE_PRIMITIVES)
+    // Calculate union of all AABBs, skipping excluded AABBs.
+    // Each thread reduces a contiguous range of shapes, the partial results are then combined.
+    real3 min_point(+C_LARGE_REAL, +C_LARGE_REAL, +C_LARGE_REAL);
+    real3 max_point(-C_LARGE_REAL, -C_LARGE_REAL, -C_LARGE_REAL);
+    const int num_shapes = (int)aabb_min.size();
+#pragma omp parallel
+    {
+        real3 thread_min(+C_LARGE_REAL, +C_LARGE_REAL, +C_LARGE_REAL);
+        real3 thread_max(-C_LARGE_REAL, -C_LARGE_REAL, -C_LARGE_REAL);
+#pragma omp for nowait
+        for (int i = 0; i < num_shapes; i++) {
+            uint id = id_rigid[i];
+            if (id == UINT_MAX || collide_rigid[id] == 0)
+                continue;
+            thread_min = Min(thread_min, aabb_min[i]);
+            thread_max = Max(thread_max, aabb_max[i]);
+        }
+#pragma omp critical
+        {
+            min_point = Min(min_point, thread_min);
+            max_point = Max(max_point, thread_max);
+        }
+    }
+
+    data_manager->measures.collision.rigid_min_bounding_point = min_point;
+    data_manager->measures.collision.rigid_max_bounding_point = max_point;
+#else
     // Calculate union of all AABBs.  
     // Excluded AABBs are inverted through the transform operation, prior to the reduction.
     auto begin = thrust::make_zip_iterator(thrust::make_tuple(aabb_min.begin(), aabb_max.begin(), id_rigid.begin()));
@@ -88,6 +116,7 @@ void ChCBroadphase::RigidBoundingBox() {
 
     data_manager->measures.collision.rigid_min_bounding_point = thrust::get<0>(result);
     data_manager->measures.collision.rigid_max_bounding_point = thrust::get<1>(result);
+#endif
 }
 
 // AABB as the pair of its min and max corners.
@@ -149,6 +178,33 @@ void ChCBroadphase::TetBoundingBox() {
     data_manager->measures.collision.tet_max_bounding_point = res.second;
 }
 
+// Incremental broadphase helpers ==========================================================================
+
+// Fall back on a full broadphase if more than this fraction of the shapes must be re-binned.
+static const real max_moved_fraction = 0.1;
+
+// Margin used to enlarge the AABBs in the incremental broadphase.
+static inline real IncrementalMargin(const collision_settings& settings) {
+    return settings.incremental_margin > 0 ? settings.incremental_margin : settings.collision_envelope;
+}
+
+// Check if the AABB (Bmin, Bmax) is contained in the AABB (Amin, Amax).
+static inline bool contains(const real3& Amin, const real3& Amax, const real3& Bmin, const real3& Bmax) {
+    return (Amin.x <= Bmin.x && Bmax.x <= Amax.x) && (Amin.y <= Bmin.y && Bmax.y <= Amax.y) &&
+           (Amin.z <= Bmin.z && Bmax.z <= Amax.z);
+}
+
+// Encode the active and collide flags of a shape's body.
+static inline char ShapeState(uint body,
+                              const custom_vector<char>& body_active,
+                              const custom_vector<char>& body_collide) {
+    if (body == UINT_MAX)
+        return 0;
+    return (body_active[body] != 0 ? 1 : 0) | (body_collide[body] != 0 ? 2 : 0);
+}
+
+// =========================================================================================================
+
 void ChCBroadphase::DetermineBoundingBox() {
     RigidBoundingBox();
 
@@ -175,6 +231,26 @@ void ChCBroadphase::DetermineBoundingBox() {
     min_point = min_point - fraction * size;
     max_point = max_point + fraction * size;
 
+    // The incremental broadphase keeps the grid of the previous step as long as all (enlarged) AABBs fit in it.
+    // When a new grid is built, it is inflated so that shapes can move by the margin before it must be rebuilt.
+    incremental = data_manager->settings.collision.use_incremental_broadphase && data_manager->num_fluid_bodies == 0 &&
+                  data_manager->num_fea_tets == 0;
+    reuse_grid = false;
+    if (incremental) {
+        real margin = IncrementalMargin(data_manager->settings.collision);
+        if (grid_num_shapes == data_manager->num_rigid_shapes &&
+            contains(grid_min_point, grid_max_point, min_point - margin, max_point + margin)) {
+            reuse_grid = true;
+            min_point = grid_min_point;
+            max_point = grid_max_point;
+        } else {
+            min_point = min_point - 2 * margin;
+            max_point = max_point + 2 * margin;
+        }
+    } else {
+        grid_num_shapes = 0;
+    }
+
     data_manager->measures.collision.min_bounding_point = min_point;
     data_manager->measures.collision.max_bounding_point = max_point;
     data_manager->measures.collision.global_origin = min_point;
@@ -186,16 +262,32 @@ void ChCBroadphase::DetermineBoundingBox() {
 void ChCBroadphase::OffsetAABB() {
     custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
     custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    custom_vector<real3>& aabb_min_tet = data_manager->host_data.aabb_min_tet;
+    custom_vector<real3>& aabb_max_tet = data_manager->host_data.aabb_max_tet;
+
+#if defined(CHRONO_PARALLEL_NATIVE_PRIMITIVES)
+    const real3 offset = data_manager->measures.collision.global_origin;
 
+#pragma omp parallel for
+    for (int i = 0; i < (signed)aabb_min.size(); i++) {
+        aabb_min[i] -= offset;
+        aabb_max[i] -= offset;
+    }
+    // Offset tet aabb
+#pragma omp parallel for
+    for (int i = 0; i < (signed)aabb_min_tet.size(); i++) {
+        aabb_min_tet[i] -= offset;
+        aabb_max_tet[i] -= offset;
+    }
+#else
     thrust::constant_iterator<real3> offset(data_manager->measures.collision.global_origin);
 
     thrust::transform(aabb_min.begin(), aabb_min.end(), offset, aabb_min.begin(), thrust::minus<real3>());
     thrust::transform(aabb_max.begin(), aabb_max.end(), offset, aabb_max.begin(), thrust::minus<real3>());
     // Offset tet aabb
-    custom_vector<real3>& aabb_min_tet = data_manager->host_data.aabb_min_tet;
-    custom_vector<real3>& aabb_max_tet = data_manager->host_data.aabb_max_tet;
     thrust::transform(aabb_min_tet.begin(), aabb_min_tet.end(), offset, aabb_min_tet.begin(), thrust::minus<real3>());
     thrust::transform(aabb_max_tet.begin(), aabb_max_tet.end(), offset, aabb_max_tet.begin(), thrust::minus<real3>());
+#endif
 }
 
 // Determine resolution of the top level grid
@@ -226,7 +318,8 @@ void ChCBroadphase::ComputeTopLevelResolution() {
 }
 
 // =========================================================================================================
-ChCBroadphase::ChCBroadphase() {
+ChCBroadphase::ChCBroadphase()
+    : incremental(false), reuse_grid(false), grid_num_shapes(0), grid_bins_per_axis(0, 0, 0) {
     data_manager = 0;
 }
 // =========================================================================================================
@@ -234,7 +327,16 @@ ChCBroadphase::ChCBroadphase() {
 // let user define their own narrow-phase collision detection
 void ChCBroadphase::DispatchRigid() {
     if (data_manager->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        // The bins of the previous step are only valid if the grid resolution did not change
+        const vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+        if (bins_per_axis.x != grid_bins_per_axis.x || bins_per_axis.y != grid_bins_per_axis.y ||
+            bins_per_axis.z != grid_bins_per_axis.z)
+            reuse_grid = false;
+        if (!reuse_grid || !IncrementalBroadphase()) {
+            if (incremental)
+                InitializeIncremental();
+            OneLevelBroadphase();
+        }
         data_manager->num_rigid_contacts = data_manager->measures.collision.number_of_contacts_possible;
     }
     return;
@@ -242,8 +344,9 @@ void ChCBroadphase::DispatchRigid() {
 
 void ChCBroadphase::OneLevelBroadphase() {
     LOG(TRACE) << "ChCBroadphase::OneLevelBroadphase()";
-    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
-    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    // In incremental mode, candidate pairs are generated from the enlarged AABBs
+    const custom_vector<real3>& aabb_min = incremental ? fat_min : data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = incremental ? fat_max : data_manager->host_data.aabb_max;
     const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
     const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
     const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
@@ -319,7 +422,7 @@ void ChCBroadphase::OneLevelBroadphase() {
                                        bin_num_contact);
     }
 
-    thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
+    Thrust_Exclusive_Scan(bin_num_contact);
     number_of_contacts_possible = bin_num_contact.back();
     pair_shapeIDs.resize(number_of_contacts_possible);
     LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
@@ -333,6 +436,239 @@ void ChCBroadphase::OneLevelBroadphase() {
 
     pair_shapeIDs.resize(number_of_contacts_possible);
     LOG(TRACE) << "Number of unique collisions: " << number_of_contacts_possible;
+
+    // In incremental mode, keep the candidate pairs sorted so that the pairs of moved shapes can be merged in
+    if (incremental)
+        Thrust_Sort(pair_shapeIDs);
+}
+
+// =========================================================================================================
+// Incremental broadphase
+
+void ChCBroadphase::InitializeIncremental() {
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    const int num_shapes = data_manager->num_rigid_shapes;
+    const real margin = IncrementalMargin(data_manager->settings.collision);
+
+    fat_min.resize(num_shapes);
+    fat_max.resize(num_shapes);
+    shape_state.resize(num_shapes);
+    shape_family.resize(num_shapes);
+    rebinned.assign(num_shapes, 0);
+    overflow.clear();
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        fat_min[i] = aabb_min[i] - margin;
+        fat_max[i] = aabb_max[i] + margin;
+        shape_state[i] = ShapeState(obj_data_id[i], obj_active, obj_collide);
+        shape_family[i] = fam_data[i];
+    }
+
+    grid_num_shapes = num_shapes;
+    grid_min_point = data_manager->measures.collision.min_bounding_point;
+    grid_max_point = data_manager->measures.collision.max_bounding_point;
+    grid_bins_per_axis = data_manager->settings.collision.bins_per_axis;
+}
+
+bool ChCBroadphase::IncrementalBroadphase() {
+    LOG(TRACE) << "ChCBroadphase::IncrementalBroadphase()";
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<long long>& pair_shapeIDs = data_manager->host_data.pair_shapeIDs;
+
+    const custom_vector<uint>& bin_number_out = data_manager->host_data.bin_number_out;
+    const custom_vector<uint>& bin_aabb_number = data_manager->host_data.bin_aabb_number;
+    const custom_vector<uint>& bin_start_index = data_manager->host_data.bin_start_index;
+
+    const vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+    const real3& inv_bin_size = data_manager->measures.collision.inv_bin_size;
+    const uint number_of_bins_active = data_manager->measures.collision.number_of_bins_active;
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+
+    const int num_shapes = data_manager->num_rigid_shapes;
+    const real margin = IncrementalMargin(data_manager->settings.collision);
+
+    // Flag the shapes that moved outside of their enlarged AABB or whose body state or family changed
+    moved.resize(num_shapes + 1);
+    moved[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        moved[i] = 0;
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        bool inside = contains(fat_min[i], fat_max[i], aabb_min[i], aabb_max[i]);
+        bool same_family = fam_data[i].x == shape_family[i].x && fam_data[i].y == shape_family[i].y;
+        if (!inside || !same_family || ShapeState(obj_data_id[i], obj_active, obj_collide) != shape_state[i])
+            moved[i] = 1;
+    }
+
+    Thrust_Exclusive_Scan(moved);
+    const uint num_moved = moved[num_shapes];
+
+    LOG(TRACE) << "Number of moved shapes: " << num_moved;
+
+    if (num_moved == 0) {
+        number_of_contacts_possible = (uint)pair_shapeIDs.size();
+        return true;
+    }
+
+    // Fall back on a full broadphase if too many shapes moved
+    if (num_moved > max_moved_fraction * num_shapes || overflow.size() > max_moved_fraction * bin_aabb_number.size())
+        return false;
+
+    moved_shapes.resize(num_moved);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (moved[i] != moved[i + 1])
+            moved_shapes[moved[i]] = i;
+    }
+
+    // Update the enlarged AABBs and the state of the moved shapes.
+    // From now on, moved[i] == 1 flags a moved shape.
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_moved; i++) {
+        uint s = moved_shapes[i];
+        fat_min[s] = aabb_min[s] - margin;
+        fat_max[s] = aabb_max[s] + margin;
+        shape_state[s] = ShapeState(obj_data_id[s], obj_active, obj_collide);
+        shape_family[s] = fam_data[s];
+    }
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        moved[i] = (moved[i] != moved[i + 1]);
+    }
+
+    // Move the moved shapes from their bins in the grid (or overflow) to the overflow
+    overflow.erase(std::remove_if(overflow.begin(), overflow.end(),
+                                  [&](const std::pair<uint, uint>& entry) { return moved[entry.second] != 0; }),
+                   overflow.end());
+    for (uint i = 0; i < num_moved; i++) {
+        uint s = moved_shapes[i];
+        rebinned[s] = 1;
+        if ((shape_state[s] & 2) == 0)
+            continue;
+        vec3 gmin = HashMin(fat_min[s], inv_bin_size);
+        vec3 gmax = HashMax(fat_max[s], inv_bin_size);
+        for (int a = gmin.x; a <= gmax.x; a++) {
+            for (int b = gmin.y; b <= gmax.y; b++) {
+                for (int c = gmin.z; c <= gmax.z; c++) {
+                    overflow.push_back(std::make_pair(Hash_Index(vec3(a, b, c), bins_per_axis), s));
+                }
+            }
+        }
+    }
+    std::sort(overflow.begin(), overflow.end());
+
+    // Remove all candidate pairs involving a moved shape
+    const int num_pairs = (int)pair_shapeIDs.size();
+    pair_keep.resize(num_pairs + 1);
+    pair_keep[num_pairs] = 0;
+#pragma omp parallel for
+    for (int i = 0; i < num_pairs; i++) {
+        uint shapeA = uint(pair_shapeIDs[i] >> 32);
+        uint shapeB = uint(pair_shapeIDs[i] & 0xffffffff);
+        pair_keep[i] = !moved[shapeA] && !moved[shapeB];
+    }
+    Thrust_Exclusive_Scan(pair_keep);
+    pair_buffer.resize(pair_keep[num_pairs]);
+#pragma omp parallel for
+    for (int i = 0; i < num_pairs; i++) {
+        if (pair_keep[i] != pair_keep[i + 1])
+            pair_buffer[pair_keep[i]] = pair_shapeIDs[i];
+    }
+
+    // Find the candidate pairs of the moved shapes, using the grid bins (skipping re-binned shapes) and the overflow.
+    // A pair of moved shapes is only generated by the shape with the smaller index, and a pair is only generated in
+    // the bin containing the lower corner of the intersection of the two AABBs.
+    std::vector<long long> new_pairs;
+    auto bin_less = [](const std::pair<uint, uint>& e1, const std::pair<uint, uint>& e2) {
+        return e1.first < e2.first;
+    };
+#pragma omp parallel
+    {
+        std::vector<long long> thread_pairs;
+
+        auto test = [&](uint shapeA, uint shapeB, uint bin) {
+            if (shapeA == shapeB || (moved[shapeB] && shapeB < shapeA))
+                return;
+            uint bodyA = obj_data_id[shapeA];
+            uint bodyB = obj_data_id[shapeB];
+            if (bodyB == UINT_MAX || bodyA == bodyB)
+                return;
+            if (obj_collide[bodyB] == 0)
+                return;
+            if (!obj_active[bodyA] && !obj_active[bodyB])
+                return;
+            if (!collide(fam_data[shapeA], fam_data[shapeB]))
+                return;
+            if (!overlap(fat_min[shapeA], fat_max[shapeA], fat_min[shapeB], fat_max[shapeB]))
+                return;
+            if (!current_bin(fat_min[shapeA], fat_max[shapeA], fat_min[shapeB], fat_max[shapeB], inv_bin_size,
+                             bins_per_axis, bin))
+                return;
+            uint s1 = std::min(shapeA, shapeB);
+            uint s2 = std::max(shapeA, shapeB);
+            thread_pairs.push_back((long long)s1 << 32 | (long long)s2);
+        };
+
+#pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < (signed)num_moved; i++) {
+            uint shapeA = moved_shapes[i];
+            uint bodyA = obj_data_id[shapeA];
+            if (bodyA == UINT_MAX || obj_collide[bodyA] == 0)
+                continue;
+            vec3 gmin = HashMin(fat_min[shapeA], inv_bin_size);
+            vec3 gmax = HashMax(fat_max[shapeA], inv_bin_size);
+            for (int a = gmin.x; a <= gmax.x; a++) {
+                for (int b = gmin.y; b <= gmax.y; b++) {
+                    for (int c = gmin.z; c <= gmax.z; c++) {
+                        uint bin = Hash_Index(vec3(a, b, c), bins_per_axis);
+                        // shapes binned in the grid
+                        auto it = std::lower_bound(bin_number_out.begin(),
+                                                   bin_number_out.begin() + number_of_bins_active, bin);
+                        if (it != bin_number_out.begin() + number_of_bins_active && *it == bin) {
+                            size_t index = it - bin_number_out.begin();
+                            for (uint j = bin_start_index[index]; j < bin_start_index[index + 1]; j++) {
+                                uint shapeB = bin_aabb_number[j];
+                                if (!rebinned[shapeB])
+                                    test(shapeA, shapeB, bin);
+                            }
+                        }
+                        // re-binned shapes
+                        auto range = std::equal_range(overflow.begin(), overflow.end(), std::make_pair(bin, 0u),
+                                                      bin_less);
+                        for (auto e = range.first; e != range.second; ++e)
+                            test(shapeA, e->second, bin);
+                    }
+                }
+            }
+        }
+
+#pragma omp critical
+        new_pairs.insert(new_pairs.end(), thread_pairs.begin(), thread_pairs.end());
+    }
+
+    // Sort the new pairs and merge them with the kept pairs (still sorted), so that the candidate pairs are in the
+    // same order as after a full broadphase, independent of the number of threads
+    std::sort(new_pairs.begin(), new_pairs.end());
+    pair_shapeIDs.resize(pair_buffer.size() + new_pairs.size());
+    std::merge(pair_buffer.begin(), pair_buffer.end(), new_pairs.begin(), new_pairs.end(), pair_shapeIDs.begin());
+
+    number_of_contacts_possible = (uint)pair_shapeIDs.size();
+    LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+
+    return true;
 }
 
 } // end namespace collision
@@ -28,7 +28,9 @@
 namespace chrono {
 namespace collision {
 
+class ConvexBase;
 class ConvexShape;
+class ConvexShapeTriangle;
 
 /// @addtogroup parallel_collision
 /// @{
@@ -56,12 +58,34 @@ class CH_PARALLEL_API ChCBroadphase {
     ChParallelDataManager* data_manager;
 
   private:
+    /// Update the candidate pairs of the previous step, re-binning only the shapes that moved outside of their
+    /// enlarged AABB. Return false if a full broadphase is required instead.
+    bool IncrementalBroadphase();
+    /// Compute the enlarged AABBs of all shapes and store the shape state used by the incremental broadphase.
+    void InitializeIncremental();
+
+    bool incremental;                             ///< incremental broadphase used in the current step
+    bool reuse_grid;                              ///< grid from previous step reused in the current step
+    uint grid_num_shapes;                         ///< number of shapes when the grid was built (0 if invalid)
+    real3 grid_min_point;                         ///< lower corner of the persistent grid
+    real3 grid_max_point;                         ///< upper corner of the persistent grid
+    vec3 grid_bins_per_axis;                      ///< resolution of the persistent grid
+    custom_vector<real3> fat_min;                 ///< lower corners of the enlarged shape AABBs
+    custom_vector<real3> fat_max;                 ///< upper corners of the enlarged shape AABBs
+    custom_vector<char> shape_state;              ///< active/collide flags of the shape body at last binning
+    custom_vector<short2> shape_family;           ///< collision family of the shape at last binning
+    custom_vector<char> rebinned;                 ///< shape moved out of the grid bins (and into overflow)
+    custom_vector<uint> moved;                    ///< flags (then offsets) of shapes moved in current step
+    custom_vector<uint> moved_shapes;             ///< list of shapes moved in current step
+    std::vector<std::pair<uint, uint>> overflow;  ///< (bin, shape) for re-binned shapes, sorted by bin
+    custom_vector<uint> pair_keep;                ///< flags (then offsets) of candidate pairs kept
+    custom_vector<long long> pair_buffer;         ///< scratch buffer for candidate pairs
 };
 
 /// Class for performing narrow-phase collision detection.
 class CH_PARALLEL_API ChCNarrowphaseDispatch {
   public:
-    ChCNarrowphaseDispatch() {}
+    ChCNarrowphaseDispatch() : has_mesh_pairs(false) {}
     ~ChCNarrowphaseDispatch() {}
     /// Clear contact data structures.
     void ClearContacts();
@@ -137,15 +161,38 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     void DispatchMPR();
     void DispatchR();
     void DispatchHybridMPR();
+    /// Bucket the candidate pairs by shape types and process each bucket separately.
+    void DispatchSorted();
+    /// Process the specified candidate pairs with the R (or hybrid R/MPR) algorithm.
+    void DispatchGeneric(const uint* pairs, int num_pairs);
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
+    /// If the candidate pair involves a triangle of an instanced mesh, load that triangle (in the global frame) and
+    /// substitute it for the mesh shape.
+    void Dispatch_Mesh(uint index, ConvexShapeTriangle* triangle, const ConvexBase*& shapeA, const ConvexBase*& shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
     ChParallelDataManager* data_manager;
 
   private:
+    /// Mid-phase for instanced meshes: replace each candidate pair of a mesh and another shape by pairs of the mesh
+    /// triangles (found with the mesh BVH) overlapping the AABB of the other shape.
+    void ExpandMeshPairs();
+    /// Number of mesh triangles to be tested for the given candidate pair: 1 if no mesh is involved, 0 for two meshes.
+    /// If 'triangles' is not null, the triangle indices (relative to the mesh, -1 if no mesh) are also written there.
+    int MeshPairTriangles(long long pair, int* triangles);
+    /// Candidate pairs processed by the narrowphase.
+    const custom_vector<long long>& CandidatePairs() const;
+
     custom_vector<char> contact_rigid_active;
     custom_vector<char> contact_rigid_fluid_active;
     custom_vector<char> contact_fluid_active;
     custom_vector<uint> contact_index;
+    custom_vector<uint> pair_bucket;              ///< shape type bucket of each candidate pair (sorted dispatch)
+    custom_vector<uint> pair_order;               ///< candidate pairs sorted by bucket (sorted dispatch)
+    custom_vector<size_t> bucket_start;           ///< start of each bucket in pair_order (sorted dispatch)
+    bool has_mesh_pairs;                          ///< candidate pairs were expanded for instanced meshes
+    custom_vector<uint> mesh_pair_count;          ///< triangles per broadphase pair (then offsets)
+    custom_vector<long long> mesh_pair_shapeIDs;  ///< expanded candidate pairs
+    custom_vector<int> pair_triangle;             ///< mesh triangle of each expanded pair (-1 if no mesh)
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
@@ -325,15 +325,16 @@ bool ChCollisionModelParallel::AddTriangleMesh(std::shared_ptr<ChMaterialSurface
     const ChVector<>& position = frame.GetPos();
     const ChQuaternion<>& rotation = frame.GetRot();
 
-    for (int i = 0; i < trimesh->getNumTriangles(); i++) {
-        auto shape = new ChCollisionShapeParallel(ChCollisionShape::Type::TRIANGLE, material);
-        geometry::ChTriangle temptri = trimesh->getTriangle(i);
-        shape->A = real3(temptri.p1.x() + position.x(), temptri.p1.y() + position.y(), temptri.p1.z() + position.z());
-        shape->B = real3(temptri.p2.x() + position.x(), temptri.p2.y() + position.y(), temptri.p2.z() + position.z());
-        shape->C = real3(temptri.p3.x() + position.x(), temptri.p3.y() + position.y(), temptri.p3.z() + position.z());
-        shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
-        m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape));
-    }
+    if (trimesh->getNumTriangles() == 0)
+        return false;
+
+    auto shape = new ChCollisionShapeParallel(ChCollisionShape::Type::TRIANGLEMESH, material);
+    shape->A = real3(position.x(), position.y(), position.z());
+    shape->B = real3(0);
+    shape->C = real3(0);
+    shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+    shape->mesh = trimesh;
+    m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape));
 
     return true;
 }
@@ -42,6 +42,7 @@ class ChCollisionShapeParallel : public ChCollisionShape {
     real3 C;          ///< extra
     quaternion R;     ///< rotation
     real3* convex;    ///< pointer to convex data;
+    std::shared_ptr<geometry::ChTriangleMesh> mesh;  ///< triangle mesh (TRIANGLEMESH shapes only)
 };
 
 /// Class for geometric model for collision detection.
@@ -185,6 +186,11 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
         ) override;
 
     /// Add a triangle mesh to this collision model.
+    /// The mesh is added as a single shape of this collision model. If mesh instancing is enabled in the collision
+    /// settings of the system, its data (triangles and bounding volume hierarchy) is stored once per mesh object and
+    /// shared by all collision models using the same mesh, and the BVH is used to find the mesh triangles overlapping
+    /// a shape once the broadphase reports the shape in contact with the mesh. Otherwise, each mesh triangle is a
+    /// separate collision shape. The 'is_static', 'is_convex' and 'sphereswept_thickness' arguments are ignored.
     /// Note: if possible, for better performance, avoid triangle meshes and prefer simplified
     /// representations as compounds of primitive convex shapes (boxes, sphers, etc).
     virtual bool AddTriangleMesh(                           //
@@ -17,13 +17,19 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
 #include "chrono_parallel/collision/ChCollision.h"
 
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemParallel::ChCollisionSystemParallel(ChParallelDataManager* dm) : data_manager(dm) {}
+// Maximum number of triangles in a leaf of a mesh BVH.
+static const int mesh_bvh_leaf_size = 4;
+
+ChCollisionSystemParallel::ChCollisionSystemParallel(ChParallelDataManager* dm)
+    : data_manager(dm), num_mesh_triangles(0) {}
 
 ChCollisionSystemParallel::~ChCollisionSystemParallel() {}
 
@@ -43,13 +49,50 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
         // Shape index in the collision model
         int local_shape_index = 0;
 
+        // Append a collision shape for the current shape of the collision model
+        auto add_shape = [&](int type, const real3& obA, const quaternion& obR, int start, int length,
+                             int mesh_triangle) {
+            data_manager->shape_data.ObA_rigid.push_back(obA);
+            data_manager->shape_data.ObR_rigid.push_back(obR);
+            data_manager->shape_data.start_rigid.push_back(start);
+            data_manager->shape_data.length_rigid.push_back(length);
+            data_manager->shape_data.mesh_triangle_id.push_back(mesh_triangle);
+
+            data_manager->shape_data.fam_rigid.push_back(fam);
+            data_manager->shape_data.typ_rigid.push_back(type);
+            data_manager->shape_data.id_rigid.push_back(body_id);
+            data_manager->shape_data.local_rigid.push_back(local_shape_index);
+            data_manager->num_rigid_shapes++;
+        };
+
         for (auto s : pmodel->GetShapes()) {
             auto shape = std::static_pointer_cast<ChCollisionShapeParallel>(s);
+
+            // Without mesh instancing, each mesh triangle is a separate TRIANGLE shape (all associated with the mesh
+            // shape of the collision model)
+            if (shape->GetType() == ChCollisionShape::Type::TRIANGLEMESH &&
+                !data_manager->settings.collision.use_mesh_instancing) {
+                for (int i = 0; i < shape->mesh->getNumTriangles(); i++) {
+                    geometry::ChTriangle tri = shape->mesh->getTriangle(i);
+                    real3 A = TransformLocalToParent(shape->A, shape->R, real3(tri.p1.x(), tri.p1.y(), tri.p1.z()));
+                    real3 B = TransformLocalToParent(shape->A, shape->R, real3(tri.p2.x(), tri.p2.y(), tri.p2.z()));
+                    real3 C = TransformLocalToParent(shape->A, shape->R, real3(tri.p3.x(), tri.p3.y(), tri.p3.z()));
+                    int start = (int)data_manager->shape_data.triangle_rigid.size();
+                    data_manager->shape_data.triangle_rigid.push_back(A);
+                    data_manager->shape_data.triangle_rigid.push_back(B);
+                    data_manager->shape_data.triangle_rigid.push_back(C);
+                    add_shape(ChCollisionShape::Type::TRIANGLE, A, shape->R, start, 1, -1);
+                }
+                local_shape_index++;
+                continue;
+            }
+
             real3 obA = shape->A;
             real3 obB = shape->B;
             real3 obC = shape->C;
             int length = 1;
             int start;
+            int mesh_triangle = -1;
             // Compute the global offset of the convex data structure based on the number of points
             // already present
 
@@ -100,26 +143,107 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
                     data_manager->shape_data.triangle_rigid.push_back(obB);
                     data_manager->shape_data.triangle_rigid.push_back(obC);
                     break;
+                case ChCollisionShape::Type::TRIANGLEMESH:
+                    start = AddMeshData(shape->mesh);
+                    mesh_triangle = num_mesh_triangles;
+                    num_mesh_triangles += shape->mesh->getNumTriangles();
+                    break;
                 default:
                     start = -1;
                     break;
             }
 
-            data_manager->shape_data.ObA_rigid.push_back(obA);
-            data_manager->shape_data.ObR_rigid.push_back(shape->R);
-            data_manager->shape_data.start_rigid.push_back(start);
-            data_manager->shape_data.length_rigid.push_back(length);
-
-            data_manager->shape_data.fam_rigid.push_back(fam);
-            data_manager->shape_data.typ_rigid.push_back(shape->GetType());
-            data_manager->shape_data.id_rigid.push_back(body_id);
-            data_manager->shape_data.local_rigid.push_back(local_shape_index);
-            data_manager->num_rigid_shapes++;
+            add_shape(shape->GetType(), obA, shape->R, start, length, mesh_triangle);
             local_shape_index++;
         }
     }
 }
 
+// Build the BVH node for the triangles order[begin, end) and, recursively, its children.
+// Nodes are stored depth-first (the left child of a node immediately follows it). The triangle order is
+// modified so that the triangles of each leaf are contiguous.
+static void BuildMeshBVH(const std::vector<real3>& tri_min,
+                         const std::vector<real3>& tri_max,
+                         const std::vector<real3>& centroid,
+                         std::vector<int>& order,
+                         int begin,
+                         int end,
+                         int first_node,
+                         shape_container& data) {
+    real3 bmin(C_LARGE_REAL);
+    real3 bmax(-C_LARGE_REAL);
+    real3 cmin(C_LARGE_REAL);
+    real3 cmax(-C_LARGE_REAL);
+    for (int i = begin; i < end; i++) {
+        bmin = Min(bmin, tri_min[order[i]]);
+        bmax = Max(bmax, tri_max[order[i]]);
+        cmin = Min(cmin, centroid[order[i]]);
+        cmax = Max(cmax, centroid[order[i]]);
+    }
+
+    int node = (int)data.mesh_bvh_node.size();
+    data.mesh_bvh_min.push_back(bmin);
+    data.mesh_bvh_max.push_back(bmax);
+    data.mesh_bvh_node.push_back(I2(begin, end - begin));
+
+    if (end - begin <= mesh_bvh_leaf_size)
+        return;
+
+    // Split at the median triangle along the largest dimension of the centroid bounds
+    real3 extent = cmax - cmin;
+    int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    int mid = (begin + end) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                     [&centroid, axis](int a, int b) { return centroid[a][axis] < centroid[b][axis]; });
+
+    BuildMeshBVH(tri_min, tri_max, centroid, order, begin, mid, first_node, data);
+    int right = (int)data.mesh_bvh_node.size() - first_node;
+    BuildMeshBVH(tri_min, tri_max, centroid, order, mid, end, first_node, data);
+    data.mesh_bvh_node[node] = I2(right, 0);
+}
+
+int ChCollisionSystemParallel::AddMeshData(std::shared_ptr<geometry::ChTriangleMesh> trimesh) {
+    auto found = mesh_index.find(trimesh);
+    if (found != mesh_index.end())
+        return found->second;
+
+    shape_container& data = data_manager->shape_data;
+    int num_triangles = trimesh->getNumTriangles();
+
+    std::vector<real3> tri_min(num_triangles);
+    std::vector<real3> tri_max(num_triangles);
+    std::vector<real3> centroid(num_triangles);
+    std::vector<int> order(num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        geometry::ChTriangle tri = trimesh->getTriangle(i);
+        real3 A(tri.p1.x(), tri.p1.y(), tri.p1.z());
+        real3 B(tri.p2.x(), tri.p2.y(), tri.p2.z());
+        real3 C(tri.p3.x(), tri.p3.y(), tri.p3.z());
+        tri_min[i] = Min(A, Min(B, C));
+        tri_max[i] = Max(A, Max(B, C));
+        centroid[i] = (A + B + C) / 3;
+        order[i] = i;
+    }
+
+    int first_node = (int)data.mesh_bvh_node.size();
+    int first_triangle = (int)data.mesh_vertices.size() / 3;
+    BuildMeshBVH(tri_min, tri_max, centroid, order, 0, num_triangles, first_node, data);
+
+    // Store the triangles in BVH leaf order
+    for (int i = 0; i < num_triangles; i++) {
+        geometry::ChTriangle tri = trimesh->getTriangle(order[i]);
+        data.mesh_vertices.push_back(real3(tri.p1.x(), tri.p1.y(), tri.p1.z()));
+        data.mesh_vertices.push_back(real3(tri.p2.x(), tri.p2.y(), tri.p2.z()));
+        data.mesh_vertices.push_back(real3(tri.p3.x(), tri.p3.y(), tri.p3.z()));
+    }
+
+    int index = (int)data.mesh_rigid.size();
+    data.mesh_rigid.push_back(I2(first_node, first_triangle));
+    mesh_index[trimesh] = index;
+
+    return index;
+}
+
 #define ERASE_MACRO(x, y) x.erase(x.begin() + y);
 #define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
 
@@ -229,6 +353,7 @@ void ChCollisionSystemParallel::Run() {
             }
         }
     }
+    data_manager->thread_tuner.Apply(ChThreadTuner::BROADPHASE);
     data_manager->system_timer.start("collision_broad");
     data_manager->aabb_generator->GenerateAABB();
 
@@ -241,6 +366,7 @@ void ChCollisionSystemParallel::Run() {
 
     data_manager->system_timer.stop("collision_broad");
 
+    data_manager->thread_tuner.Apply(ChThreadTuner::NARROWPHASE);
     data_manager->system_timer.start("collision_narrow");
     if (data_manager->num_fluid_bodies != 0) {
         data_manager->narrowphase->DispatchFluid();
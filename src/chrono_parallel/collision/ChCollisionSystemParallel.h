@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChBody.h"
 
@@ -54,7 +56,8 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     virtual void Add(ChCollisionModel* model) override;
 
     /// Remove a collision model from the collision engine.
-    /// Currently not implemented.
+    /// Currently not implemented. In particular, the data of instanced triangle meshes (triangles and BVH) is kept
+    /// until the collision system is destroyed, even if no collision model uses the mesh anymore.
     virtual void Remove(ChCollisionModel* model) override;
 
     /// Set the number of OpenMP threads for collision detection.
@@ -110,8 +113,16 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     virtual std::vector<vec2> GetOverlappingPairs();
 
   private:
+    /// Return the index of the instanced mesh data for the given triangle mesh.
+    /// The mesh data (triangles and BVH) is created the first time a mesh is encountered. Since collision models are
+    /// never removed, the mesh data is never released; holding a reference to the mesh in mesh_index ensures that a
+    /// different mesh later allocated at the same address is not mistaken for it.
+    int AddMeshData(std::shared_ptr<geometry::ChTriangleMesh> trimesh);
+
     ChParallelDataManager* data_manager;
     custom_vector<char> body_active;
+    std::unordered_map<std::shared_ptr<geometry::ChTriangleMesh>, int> mesh_index;  ///< mesh data index of each mesh
+    int num_mesh_triangles;  ///< number of triangles over all instanced mesh shapes
 
     friend class ChSystemParallel;
 };
@@ -116,6 +116,7 @@ class ConvexShapeTetrahedron : public ConvexBase {
 /// Triangle contact shape.
 class ConvexShapeTriangle : public ConvexBase {
   public:
+    ConvexShapeTriangle() {}
     ConvexShapeTriangle(real3& t1, real3& t2, real3 t3) {
         tri[0] = t1;
         tri[1] = t2;
@@ -18,6 +18,7 @@
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 
+#include "chrono_parallel/ChParallelPrimitives.h"
 #include "chrono_parallel/math/ChParallelMath.h"
 #include "chrono_parallel/collision/ChCollision.h"
 #include "chrono_parallel/collision/ChNarrowphaseUtils.h"
@@ -88,7 +89,7 @@ int ChCNarrowphaseDispatch::PreprocessCount() {
         // shape type (per shape)
         const shape_type* obj_data_T = data_manager->shape_data.typ_rigid.data();
         // encoded shape IDs (per collision pair)
-        const long long* pair_shapeIDs = data_manager->host_data.pair_shapeIDs.data();
+        const long long* pair_shapeIDs = CandidatePairs().data();
 
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
@@ -111,14 +112,23 @@ int ChCNarrowphaseDispatch::PreprocessCount() {
     }
 
     // Calculate total number of potential contacts
-    int num_potentialContacts = thrust::reduce(THRUST_PAR contact_index.begin(), contact_index.end());
+    int num_potentialContacts = Thrust_Total(contact_index);
 
     // Expand vector of shape IDs into contact_shapeIDs:
     // Replicate pair_shapeIDs[i] contact_index[i] times, for each potential contact for the collision pair 'i'
     data_manager->host_data.contact_shapeIDs.resize(num_potentialContacts);
-    Thrust_Expand(contact_index.begin(), contact_index.end() - 1, data_manager->host_data.pair_shapeIDs.begin(),
+    Thrust_Expand(contact_index.begin(), contact_index.end() - 1, CandidatePairs().begin(),
                   data_manager->host_data.contact_shapeIDs.begin());
 
+    // Similarly, expand the mesh triangles of the candidate pairs into contact_triangle
+    data_manager->host_data.contact_triangle.resize(num_potentialContacts);
+    if (has_mesh_pairs) {
+        Thrust_Expand(contact_index.begin(), contact_index.end() - 1, pair_triangle.begin(),
+                      data_manager->host_data.contact_triangle.begin());
+    } else {
+        Thrust_Fill(data_manager->host_data.contact_triangle, -1);
+    }
+
     // Set start index for the potential contacts for each collision pair
     Thrust_Exclusive_Scan(contact_index);
     assert(num_potentialContacts == contact_index.back());
@@ -177,7 +187,7 @@ void ChCNarrowphaseDispatch::Dispatch_Init(uint index,
                                            ConvexShape* shapeA,
                                            ConvexShape* shapeB) {
     const custom_vector<uint>& obj_data_ID = data_manager->shape_data.id_rigid;
-    const custom_vector<long long>& pair_shapeIDs = data_manager->host_data.pair_shapeIDs;
+    const custom_vector<long long>& pair_shapeIDs = CandidatePairs();
     real3* convex_data = data_manager->shape_data.convex_rigid.data();
 
     // Unpack the identifiers for the two shapes involved in this collision
@@ -207,6 +217,158 @@ void ChCNarrowphaseDispatch::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Instanced triangle meshes.
+// The broadphase only reports the pairs of a mesh shape (as a whole) and other
+// shapes. Before the narrowphase, the BVH of the mesh is traversed with the AABB
+// of the other shape, and each such pair is replaced by one candidate pair per
+// mesh triangle found. These expanded pairs are kept separately, so that the
+// broadphase pairs are not modified.
+// -----------------------------------------------------------------------------
+
+static inline bool BoxesOverlap(const real3& amin, const real3& amax, const real3& bmin, const real3& bmax) {
+    return (amin.x <= bmax.x && bmin.x <= amax.x) && (amin.y <= bmax.y && bmin.y <= amax.y) &&
+           (amin.z <= bmax.z && bmin.z <= amax.z);
+}
+
+// Find the triangles of a mesh overlapping the box [qmin, qmax] (in the mesh frame).
+// Return the number of triangles found and, if 'triangles' is not null, write their indices there.
+static int QueryMeshBVH(const shape_container& shapes,
+                        const vec2& mesh,
+                        const real3& qmin,
+                        const real3& qmax,
+                        int* triangles) {
+    const real3* bvh_min = &shapes.mesh_bvh_min[mesh.x];
+    const real3* bvh_max = &shapes.mesh_bvh_max[mesh.x];
+    const vec2* bvh_node = &shapes.mesh_bvh_node[mesh.x];
+    const real3* vertices = &shapes.mesh_vertices[3 * mesh.y];
+
+    // The BVH is balanced (median splits), so its depth is logarithmic in the number of triangles
+    int stack[64];
+    int top = 0;
+    int count = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        int node = stack[--top];
+        if (!BoxesOverlap(qmin, qmax, bvh_min[node], bvh_max[node]))
+            continue;
+        vec2 info = bvh_node[node];
+        if (info.y == 0) {
+            stack[top++] = info.x;
+            stack[top++] = node + 1;
+            continue;
+        }
+        for (int t = info.x; t < info.x + info.y; t++) {
+            const real3* tri = &vertices[3 * t];
+            if (BoxesOverlap(qmin, qmax, Min(tri[0], Min(tri[1], tri[2])), Max(tri[0], Max(tri[1], tri[2])))) {
+                if (triangles)
+                    triangles[count] = t;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+const custom_vector<long long>& ChCNarrowphaseDispatch::CandidatePairs() const {
+    return has_mesh_pairs ? mesh_pair_shapeIDs : data_manager->host_data.pair_shapeIDs;
+}
+
+int ChCNarrowphaseDispatch::MeshPairTriangles(long long pair, int* triangles) {
+    const shape_container& shapes = data_manager->shape_data;
+    int a = int(pair >> 32);
+    int b = int(pair & 0xffffffff);
+    bool meshA = shapes.typ_rigid[a] == ChCollisionShape::Type::TRIANGLEMESH;
+    bool meshB = shapes.typ_rigid[b] == ChCollisionShape::Type::TRIANGLEMESH;
+
+    if (!meshA && !meshB) {
+        if (triangles)
+            triangles[0] = -1;
+        return 1;
+    }
+    if (meshA && meshB)
+        return 0;
+
+    int mesh = meshA ? a : b;
+    int other = meshA ? b : a;
+
+    // AABB of the other shape (offset by the broadphase), expressed in the mesh frame. It already includes the
+    // collision envelope of the other shape; it is enlarged by the envelope of the mesh.
+    real3 global_origin = data_manager->measures.collision.global_origin;
+    real3 center = (data_manager->host_data.aabb_min[other] + data_manager->host_data.aabb_max[other]) * 0.5;
+    real3 half = (data_manager->host_data.aabb_max[other] - data_manager->host_data.aabb_min[other]) * 0.5;
+    quaternion rot = shapes.obj_data_R_global[mesh];
+    real3 local_center = RotateT(center + global_origin - shapes.obj_data_A_global[mesh], rot);
+    real3 local_half = AbsRotate(Inv(rot), half) + collision_envelope;
+
+    return QueryMeshBVH(shapes, shapes.mesh_rigid[shapes.start_rigid[mesh]], local_center - local_half,
+                        local_center + local_half, triangles);
+}
+
+void ChCNarrowphaseDispatch::ExpandMeshPairs() {
+    has_mesh_pairs = false;
+    if (data_manager->shape_data.mesh_rigid.size() == 0)
+        return;
+
+    const custom_vector<long long>& pair_shapeIDs = data_manager->host_data.pair_shapeIDs;
+    uint num_pairs = num_potential_rigid_contacts;
+
+    // Count the triangles to be tested for each broadphase pair
+    mesh_pair_count.resize(num_pairs + 1);
+    mesh_pair_count[num_pairs] = 0;
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_pairs; index++) {
+        mesh_pair_count[index] = MeshPairTriangles(pair_shapeIDs[index], nullptr);
+    }
+    Thrust_Exclusive_Scan(mesh_pair_count);
+    uint num_expanded = mesh_pair_count[num_pairs];
+
+    // Generate the expanded pairs
+    mesh_pair_shapeIDs.resize(num_expanded);
+    pair_triangle.resize(num_expanded);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_pairs; index++) {
+        uint start = mesh_pair_count[index];
+        uint end = mesh_pair_count[index + 1];
+        if (start == end)
+            continue;
+        for (uint i = start; i < end; i++)
+            mesh_pair_shapeIDs[i] = pair_shapeIDs[index];
+        MeshPairTriangles(pair_shapeIDs[index], &pair_triangle[start]);
+    }
+
+    num_potential_rigid_contacts = num_expanded;
+    has_mesh_pairs = true;
+}
+
+void ChCNarrowphaseDispatch::Dispatch_Mesh(uint index,
+                                           ConvexShapeTriangle* triangle,
+                                           const ConvexBase*& shapeA,
+                                           const ConvexBase*& shapeB) {
+    if (!has_mesh_pairs || pair_triangle[index] < 0)
+        return;
+
+    const shape_container& shapes = data_manager->shape_data;
+    long long p = mesh_pair_shapeIDs[index];
+    int a = int(p >> 32);
+    bool meshA = shapes.typ_rigid[a] == ChCollisionShape::Type::TRIANGLEMESH;
+    int mesh = meshA ? a : int(p & 0xffffffff);
+
+    // Transform the triangle vertices to the global frame
+    vec2 mesh_data = shapes.mesh_rigid[shapes.start_rigid[mesh]];
+    const real3* tri = &shapes.mesh_vertices[3 * (mesh_data.y + pair_triangle[index])];
+    const real3& pos = shapes.obj_data_A_global[mesh];
+    const quaternion& rot = shapes.obj_data_R_global[mesh];
+    triangle->tri[0] = TransformLocalToParent(pos, rot, tri[0]);
+    triangle->tri[1] = TransformLocalToParent(pos, rot, tri[1]);
+    triangle->tri[2] = TransformLocalToParent(pos, rot, tri[2]);
+
+    if (meshA)
+        shapeA = triangle;
+    else
+        shapeB = triangle;
+}
+
 void ChCNarrowphaseDispatch::DispatchMPR() {
     custom_vector<real3>& norm = data_manager->host_data.norm_rigid_rigid;
     custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
@@ -216,16 +378,20 @@ void ChCNarrowphaseDispatch::DispatchMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* convexA = &shapeA;
+        const ConvexBase* convexB = &shapeB;
+        Dispatch_Mesh(index, &triangle, convexA, convexB);
 
-        if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
+        if (MPRCollision(convexA, convexB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
                          contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
@@ -243,16 +409,20 @@ void ChCNarrowphaseDispatch::DispatchR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* convexA = &shapeA;
+        const ConvexBase* convexB = &shapeB;
+        Dispatch_Mesh(index, &triangle, convexA, convexB);
 
-        if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+        if (RCollision(convexA, convexB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
                        &contactDepth[icoll], &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
         }
@@ -268,21 +438,25 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* convexA = &shapeA;
+        const ConvexBase* convexB = &shapeB;
+        Dispatch_Mesh(index, &triangle, convexA, convexB);
 
-        if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+        if (RCollision(convexA, convexB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
                        &contactDepth[icoll], &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
+        } else if (MPRCollision(convexA, convexB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
                                 contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -292,6 +466,258 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Sorted dispatch.
+// The candidate pairs are bucketed by the types of their two shapes with a
+// counting sort. The pairs of each supported bucket are then processed in a
+// separate loop that calls a single collision function directly on the shape
+// data (no virtual shape accessors, no type dispatch), while all other pairs go
+// through the generic R (or hybrid R/MPR) dispatch. Results are written at the
+// contact index of each pair, so the contact order is the same as with the
+// unsorted dispatch.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Shape type buckets of candidate pairs. Each bucket is ordered, e.g. SPHERE_BOX
+// holds the pairs where shape A is a sphere and shape B a box.
+enum PairBucket : uint {
+    SPHERE_SPHERE,
+    BOX_SPHERE,
+    SPHERE_BOX,
+    CAPSULE_SPHERE,
+    SPHERE_CAPSULE,
+    TRIANGLE_SPHERE,
+    SPHERE_TRIANGLE,
+    GENERIC_PAIR,
+    NUM_PAIR_BUCKETS
+};
+
+inline uint GetPairBucket(int typeA, int typeB) {
+    if (typeB == ChCollisionShape::Type::SPHERE) {
+        switch (typeA) {
+            case ChCollisionShape::Type::SPHERE:
+                return SPHERE_SPHERE;
+            case ChCollisionShape::Type::BOX:
+                return BOX_SPHERE;
+            case ChCollisionShape::Type::CAPSULE:
+                return CAPSULE_SPHERE;
+            case ChCollisionShape::Type::TRIANGLE:
+                return TRIANGLE_SPHERE;
+        }
+    } else if (typeA == ChCollisionShape::Type::SPHERE) {
+        switch (typeB) {
+            case ChCollisionShape::Type::BOX:
+                return SPHERE_BOX;
+            case ChCollisionShape::Type::CAPSULE:
+                return SPHERE_CAPSULE;
+            case ChCollisionShape::Type::TRIANGLE:
+                return SPHERE_TRIANGLE;
+        }
+    }
+    return GENERIC_PAIR;
+}
+
+// Shape data and contact output arrays used by the bucket kernels.
+struct SortedDispatchData {
+    const long long* pair_shapeIDs;
+    const uint* contact_index;
+    const uint* obj_data_ID;
+    const int* start;
+    const real3* pos;
+    const quaternion* rot;
+    const real* radius;
+    const real3* box;
+    const real2* capsule;
+    const real3* triangle;
+    real separation;
+
+    real3* norm;
+    real3* ptA;
+    real3* ptB;
+    real* depth;
+    real* eff_radius;
+    vec2* body_ids;
+    char* active;
+};
+
+// Run the specified kernel on all pairs of a bucket. The kernel is called with
+// the two shape indices and the contact index and returns true for a contact.
+template <typename Kernel>
+void RunBucket(const SortedDispatchData& d, const uint* pairs, int num_pairs, Kernel kernel) {
+#pragma omp parallel for
+    for (int i = 0; i < num_pairs; i++) {
+        uint index = pairs[i];
+        long long p = d.pair_shapeIDs[index];
+        int a = int(p >> 32);
+        int b = int(p & 0xffffffff);
+        uint icoll = d.contact_index[index];
+        if (kernel(a, b, icoll)) {
+            d.active[icoll] = true;
+            d.body_ids[icoll] = I2(d.obj_data_ID[a], d.obj_data_ID[b]);
+        }
+    }
+}
+
+}  // end anonymous namespace
+
+void ChCNarrowphaseDispatch::DispatchSorted() {
+    const shape_container& shapes = data_manager->shape_data;
+    const int* obj_data_T = shapes.typ_rigid.data();
+
+    SortedDispatchData d;
+    d.pair_shapeIDs = CandidatePairs().data();
+    d.contact_index = contact_index.data();
+    d.obj_data_ID = shapes.id_rigid.data();
+    d.start = shapes.start_rigid.data();
+    d.pos = shapes.obj_data_A_global.data();
+    d.rot = shapes.obj_data_R_global.data();
+    d.radius = shapes.sphere_rigid.data();
+    d.box = shapes.box_like_rigid.data();
+    d.capsule = shapes.capsule_rigid.data();
+    d.triangle = shapes.triangle_global.data();
+    d.separation = 2 * collision_envelope;
+    d.norm = data_manager->host_data.norm_rigid_rigid.data();
+    d.ptA = data_manager->host_data.cpta_rigid_rigid.data();
+    d.ptB = data_manager->host_data.cptb_rigid_rigid.data();
+    d.depth = data_manager->host_data.dpth_rigid_rigid.data();
+    d.eff_radius = data_manager->host_data.erad_rigid_rigid.data();
+    d.body_ids = data_manager->host_data.bids_rigid_rigid.data();
+    d.active = contact_rigid_active.data();
+
+    // Bucket the candidate pairs by the types of their two shapes
+    pair_bucket.resize(num_potential_rigid_contacts);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        long long p = d.pair_shapeIDs[index];
+        pair_bucket[index] = GetPairBucket(obj_data_T[int(p >> 32)], obj_data_T[int(p & 0xffffffff)]);
+    }
+    ParallelCountingSort(pair_bucket, NUM_PAIR_BUCKETS, pair_order, bucket_start);
+
+    for (uint bucket = 0; bucket < NUM_PAIR_BUCKETS; bucket++) {
+        const uint* pairs = pair_order.data() + bucket_start[bucket];
+        int num_pairs = (int)(bucket_start[bucket + 1] - bucket_start[bucket]);
+        if (num_pairs == 0)
+            continue;
+
+        switch (bucket) {
+            case SPHERE_SPHERE:
+                // Inlined version of sphere_sphere()
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    real radius1 = d.radius[d.start[a]];
+                    real radius2 = d.radius[d.start[b]];
+                    real3 delta = d.pos[b] - d.pos[a];
+                    real dist2 = Dot(delta, delta);
+                    real radSum = radius1 + radius2;
+                    real radSum_s = radSum + d.separation;
+                    if (dist2 >= radSum_s * radSum_s || dist2 < 1e-12)
+                        return false;
+                    real dist = Sqrt(dist2);
+                    real3 norm = delta / dist;
+                    d.norm[icoll] = norm;
+                    d.ptA[icoll] = d.pos[a] + norm * radius1;
+                    d.ptB[icoll] = d.pos[b] - norm * radius2;
+                    d.depth[icoll] = dist - radSum;
+                    d.eff_radius[icoll] = radius1 * radius2 / radSum;
+                    return true;
+                });
+                break;
+            case BOX_SPHERE:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    return box_sphere(d.pos[a], d.rot[a], d.box[d.start[a]], d.pos[b], d.radius[d.start[b]],
+                                      d.separation, d.norm[icoll], d.depth[icoll], d.ptA[icoll], d.ptB[icoll],
+                                      d.eff_radius[icoll]);
+                });
+                break;
+            case SPHERE_BOX:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    if (!box_sphere(d.pos[b], d.rot[b], d.box[d.start[b]], d.pos[a], d.radius[d.start[a]],
+                                    d.separation, d.norm[icoll], d.depth[icoll], d.ptB[icoll], d.ptA[icoll],
+                                    d.eff_radius[icoll]))
+                        return false;
+                    d.norm[icoll] = -d.norm[icoll];
+                    return true;
+                });
+                break;
+            case CAPSULE_SPHERE:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    real2 capsule = d.capsule[d.start[a]];
+                    return capsule_sphere(d.pos[a], d.rot[a], capsule.x, capsule.y, d.pos[b], d.radius[d.start[b]],
+                                          d.separation, d.norm[icoll], d.depth[icoll], d.ptA[icoll], d.ptB[icoll],
+                                          d.eff_radius[icoll]);
+                });
+                break;
+            case SPHERE_CAPSULE:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    real2 capsule = d.capsule[d.start[b]];
+                    if (!capsule_sphere(d.pos[b], d.rot[b], capsule.x, capsule.y, d.pos[a], d.radius[d.start[a]],
+                                        d.separation, d.norm[icoll], d.depth[icoll], d.ptB[icoll], d.ptA[icoll],
+                                        d.eff_radius[icoll]))
+                        return false;
+                    d.norm[icoll] = -d.norm[icoll];
+                    return true;
+                });
+                break;
+            case TRIANGLE_SPHERE:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    const real3* tri = &d.triangle[d.start[a]];
+                    return face_sphere(tri[0], tri[1], tri[2], d.pos[b], d.radius[d.start[b]], d.separation,
+                                       d.norm[icoll], d.depth[icoll], d.ptA[icoll], d.ptB[icoll], d.eff_radius[icoll]);
+                });
+                break;
+            case SPHERE_TRIANGLE:
+                RunBucket(d, pairs, num_pairs, [&d](int a, int b, uint icoll) {
+                    const real3* tri = &d.triangle[d.start[b]];
+                    if (!face_sphere(tri[0], tri[1], tri[2], d.pos[a], d.radius[d.start[a]], d.separation,
+                                     d.norm[icoll], d.depth[icoll], d.ptB[icoll], d.ptA[icoll], d.eff_radius[icoll]))
+                        return false;
+                    d.norm[icoll] = -d.norm[icoll];
+                    return true;
+                });
+                break;
+            default:
+                DispatchGeneric(pairs, num_pairs);
+                break;
+        }
+    }
+}
+
+void ChCNarrowphaseDispatch::DispatchGeneric(const uint* pairs, int num_pairs) {
+    real3* norm = data_manager->host_data.norm_rigid_rigid.data();
+    real3* ptA = data_manager->host_data.cpta_rigid_rigid.data();
+    real3* ptB = data_manager->host_data.cptb_rigid_rigid.data();
+    real* contactDepth = data_manager->host_data.dpth_rigid_rigid.data();
+    real* effective_radius = data_manager->host_data.erad_rigid_rigid.data();
+
+    ConvexShape shapeA;
+    ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
+
+    bool use_mpr = (narrowphase_algorithm == NarrowPhaseType::NARROWPHASE_HYBRID_MPR);
+    double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+
+#pragma omp parallel for private(shapeA, shapeB, triangle)
+    for (int i = 0; i < num_pairs; i++) {
+        uint ID_A, ID_B, icoll;
+
+        int nC;
+
+        Dispatch_Init(pairs[i], icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* convexA = &shapeA;
+        const ConvexBase* convexB = &shapeB;
+        Dispatch_Mesh(pairs[i], &triangle, convexA, convexB);
+
+        if (RCollision(convexA, convexB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                       &contactDepth[icoll], &effective_radius[icoll], nC)) {
+            Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+        } else if (use_mpr && MPRCollision(convexA, convexB, collision_envelope, norm[icoll], ptA[icoll],
+                                           ptB[icoll], contactDepth[icoll])) {
+            effective_radius[icoll] = default_eff_radius;
+            Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+        }
+    }
+}
+
 void ChCNarrowphaseDispatch::DispatchRigid() {
     LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() S";
     custom_vector<real3>& norm_data = data_manager->host_data.norm_rigid_rigid;
@@ -301,8 +727,12 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     custom_vector<real>& erad_data = data_manager->host_data.erad_rigid_rigid;
     custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
     custom_vector<long long>& contact_shapeIDs = data_manager->host_data.contact_shapeIDs;
+    custom_vector<int>& contact_triangle = data_manager->host_data.contact_triangle;
     uint& num_rigid_contacts = data_manager->num_rigid_contacts;
 
+    // Replace the candidate pairs involving instanced meshes by pairs with the mesh triangles.
+    ExpandMeshPairs();
+
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
     // potential collision) and calculate the total number of potential contacts.
@@ -319,17 +749,23 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     // These flags will keep track of which potential contacts are actually active
     // (as decided by the narrowphase algorithm).
     contact_rigid_active.resize(num_potentialContacts);
-    thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
+    Thrust_Fill(contact_rigid_active, false);
 
     switch (narrowphase_algorithm) {
         case NarrowPhaseType::NARROWPHASE_MPR:
             DispatchMPR();
             break;
         case NarrowPhaseType::NARROWPHASE_R:
-            DispatchR();
+            if (data_manager->settings.collision.use_sorted_narrowphase)
+                DispatchSorted();
+            else
+                DispatchR();
             break;
         case NarrowPhaseType::NARROWPHASE_HYBRID_MPR:
-            DispatchHybridMPR();
+            if (data_manager->settings.collision.use_sorted_narrowphase)
+                DispatchSorted();
+            else
+                DispatchHybridMPR();
             break;
     }
 
@@ -341,9 +777,10 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     thrust::remove_if(THRUST_PAR
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
                                                      dpth_data.begin(), erad_data.begin(), bids_data.begin(),
-                                                     contact_shapeIDs.begin())),
+                                                     contact_shapeIDs.begin(), contact_triangle.begin())),
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.end(), cpta_data.end(), cptb_data.end(), dpth_data.end(),
-                                                     erad_data.end(), bids_data.end(), contact_shapeIDs.end())),
+                                                     erad_data.end(), bids_data.end(), contact_shapeIDs.end(),
+                                                     contact_triangle.end())),
         contact_rigid_active.begin(), thrust::logical_not<bool>());
 
     // Resize all lists so that we don't access invalid contacts
@@ -354,6 +791,7 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+    contact_triangle.resize(num_rigid_contacts);
     LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
 }
 
@@ -675,7 +1113,10 @@ void ChCNarrowphaseDispatch::RigidSphereContact(const real sphere_radius,
                         real3 Amax = data_manager->host_data.aabb_max[shape_id_a];
                         // if the sphere and the rigid body appear in the same bin more than once, dont count
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
-                            if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
+                            // Instanced meshes are not supported for rigid-fluid contacts
+                            if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a]) &&
+                                data_manager->shape_data.typ_rigid[shape_id_a] !=
+                                    ChCollisionShape::Type::TRIANGLEMESH) {
                                 ConvexShape* shapeA = new ConvexShape(shape_id_a, &data_manager->shape_data);
                                 real3 ptA, ptB, norm;
                                 real depth, erad = 0;
@@ -827,6 +1268,9 @@ void ChCNarrowphaseDispatch::RigidTetContact(custom_vector<real3>& norm_rigid_te
                     }
                     if (!collide(family, fam_data[shape_id_a]))
                         continue;
+                    // Instanced meshes are not supported for rigid-FEA contacts
+                    if (data_manager->shape_data.typ_rigid[shape_id_a] == ChCollisionShape::Type::TRIANGLEMESH)
+                        continue;
                     ConvexShape* shapeA = new ConvexShape(shape_id_a, &data_manager->shape_data);
 
                     real3 ptA, ptB, norm;
@@ -37,8 +37,6 @@
 #include "chrono_parallel/solver/ChSolverParallel.h"
 #include "chrono_parallel/solver/ChSystemDescriptorParallel.h"
 
-#include <numeric>
-
 using namespace chrono::collision;
 
 #ifdef LOGGINGENABLED
@@ -55,15 +53,11 @@ ChSystemParallel::ChSystemParallel() : ChSystem() {
 
     collision_system_type = CollisionSystemType::COLLSYS_PARALLEL;
     counter = 0;
-    timer_accumulator.resize(10, 0);
     cd_accumulator.resize(10, 0);
-    frame_threads = 0;
     frame_bins = 0;
-    old_timer = 0;
     old_timer_cd = 0;
-    detect_optimal_threads = false;
     detect_optimal_bins = false;
-    current_threads = 2;
+    current_threads = nthreads_chrono;
 
     data_manager->system_timer.AddTimer("step");
     data_manager->system_timer.AddTimer("update");
@@ -120,6 +114,11 @@ bool ChSystemParallel::Integrate_Y() {
 
     Setup();
 
+    // Thread tuning turned off in the settings: go back to the configured number of threads
+    if (!data_manager->settings.perform_thread_tuning && data_manager->thread_tuner.IsEnabled())
+        DisableThreadTuning();
+
+    data_manager->thread_tuner.Apply(ChThreadTuner::UPDATE);
     data_manager->system_timer.start("update");
     Update();
     data_manager->system_timer.stop("update");
@@ -132,10 +131,12 @@ bool ChSystemParallel::Integrate_Y() {
     }
     data_manager->system_timer.stop("collision");
 
+    data_manager->thread_tuner.Apply(ChThreadTuner::SOLVER);
     data_manager->system_timer.start("advance");
     std::static_pointer_cast<ChIterativeSolverParallel>(solver)->RunTimeStep();
     data_manager->system_timer.stop("advance");
 
+    data_manager->thread_tuner.Apply(ChThreadTuner::UPDATE);
     data_manager->system_timer.start("update");
 
     // Iterate over the active bilateral constraints and store their Lagrange
@@ -219,13 +220,21 @@ bool ChSystemParallel::Integrate_Y() {
 
     data_manager->node_container->UpdatePosition(ch_time);
     data_manager->fea_container->UpdatePosition(ch_time);
+
+    ManageSleepingIslands();
     data_manager->system_timer.stop("update");
 
     //=============================================================================================
     ch_time += GetStep();
     data_manager->system_timer.stop("step");
     if (data_manager->settings.perform_thread_tuning) {
-        RecomputeThreads();
+        ChThreadTuner::PhaseTimes times;
+        times[ChThreadTuner::UPDATE] = data_manager->system_timer.GetTime("update");
+        times[ChThreadTuner::BROADPHASE] = data_manager->system_timer.GetTime("collision_broad");
+        times[ChThreadTuner::NARROWPHASE] = data_manager->system_timer.GetTime("collision_narrow");
+        times[ChThreadTuner::SOLVER] = data_manager->system_timer.GetTime("advance");
+        data_manager->thread_tuner.ProcessStep(times);
+        current_threads = data_manager->thread_tuner.GetNumThreads(ChThreadTuner::SOLVER);
     }
 
     return true;
@@ -392,6 +401,84 @@ void ChSystemParallel::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
     container->AddElements(elements);
 }
 
+//
+// Manage sleeping bodies, at the level of islands of bodies connected through contacts or links.
+// Contacts between two sleeping bodies (or a sleeping and a fixed body) are not generated, so sleeping bodies keep the
+// island they fell asleep in (see ChParallelDataManager::ComputeRigidIslands). An island goes to sleep if all its
+// bodies are at rest. A sleeping island is woken up as a whole as soon as an awake body touches one of its bodies.
+//
+void ChSystemParallel::ManageSleepingIslands() {
+    const uint num_bodies = data_manager->num_rigid_bodies;
+    custom_vector<char>& sleep = data_manager->host_data.sleep_rigid;
+    custom_vector<uint>& island = data_manager->host_data.island_rigid;
+
+    sleep.resize(num_bodies, 0);
+
+    if (!GetUseSleeping() || data_manager->num_fluid_bodies != 0 || data_manager->num_fea_nodes != 0) {
+        // Wake up any body still sleeping (e.g., if sleeping was just disabled)
+        if (data_manager->num_sleeping_bodies != 0) {
+#pragma omp parallel for
+            for (int i = 0; i < (signed)num_bodies; i++) {
+                if (sleep[i]) {
+                    assembly.bodylist[i]->SetSleeping(false);
+                    sleep[i] = 0;
+                }
+            }
+            data_manager->num_sleeping_bodies = 0;
+        }
+        return;
+    }
+
+    // Flag fixed bodies and bodies at rest (below their sleeping thresholds for long enough)
+    body_fixed.resize(num_bodies);
+    body_at_rest.resize(num_bodies);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        auto& body = assembly.bodylist[i];
+        body_fixed[i] = body->GetBodyFixed();
+        body_at_rest[i] = body->GetSleeping() || body->TrySleeping();
+    }
+
+    data_manager->num_islands = data_manager->ComputeRigidIslands(body_fixed);
+
+    // An island must stay awake if any of its bodies is not at rest
+    island_awake.assign(num_bodies, 0);
+    for (uint i = 0; i < num_bodies; i++) {
+        if (!body_fixed[i] && !body_at_rest[i])
+            island_awake[island[i]] = 1;
+    }
+
+    uint num_sleeping = 0;
+#pragma omp parallel for reduction(+ : num_sleeping)
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        if (body_fixed[i]) {
+            sleep[i] = 0;
+            continue;
+        }
+        auto& body = assembly.bodylist[i];
+        if (island_awake[island[i]]) {
+            if (sleep[i]) {
+                body->SetSleeping(false);
+                sleep[i] = 0;
+            }
+        } else {
+            if (sleep[i]) {
+                sleep[i] = 2;
+            } else {
+                body->SetSleeping(true);
+                body->SetPos_dt(VNULL);
+                body->SetWvel_loc(VNULL);
+                sleep[i] = 1;
+            }
+            num_sleeping++;
+        }
+    }
+    data_manager->num_sleeping_bodies = num_sleeping;
+
+    LOG(TRACE) << "ChSystemParallel::ManageSleepingIslands() islands: " << data_manager->num_islands
+               << " sleeping bodies: " << num_sleeping;
+}
+
 //
 // Reset forces for all variables
 //
@@ -719,48 +806,6 @@ void ChSystemParallel::Setup() {
     assembly.nbodies_fixed = 0;
 }
 
-void ChSystemParallel::RecomputeThreads() {
-#ifdef _OPENMP
-    timer_accumulator.insert(timer_accumulator.begin(), data_manager->system_timer.GetTime("step"));
-    timer_accumulator.pop_back();
-
-    double sum_of_elems = std::accumulate(timer_accumulator.begin(), timer_accumulator.end(), 0.0);
-
-    if (frame_threads == 50 && detect_optimal_threads == false) {
-        frame_threads = 0;
-        if (current_threads + 2 < data_manager->settings.max_threads) {
-            detect_optimal_threads = true;
-            old_timer = sum_of_elems / 10.0;
-            current_threads += 2;
-            omp_set_num_threads(current_threads);
-
-            LOG(TRACE) << "current threads increased to " << current_threads;
-
-        } else {
-            current_threads = data_manager->settings.max_threads;
-            omp_set_num_threads(data_manager->settings.max_threads);
-
-            LOG(TRACE) << "current threads increased to " << current_threads;
-        }
-    } else if (frame_threads == 10 && detect_optimal_threads) {
-        double current_timer = sum_of_elems / 10.0;
-        detect_optimal_threads = false;
-        frame_threads = 0;
-        if (old_timer < current_timer) {
-            current_threads -= 2;
-            omp_set_num_threads(current_threads);
-            LOG(TRACE) << "current threads reduced back to " << current_threads;
-        }
-    }
-
-    if (current_threads < data_manager->settings.min_threads) {
-        current_threads = data_manager->settings.min_threads;
-        omp_set_num_threads(data_manager->settings.min_threads);
-    }
-    frame_threads++;
-#endif
-}
-
 void ChSystemParallel::ChangeCollisionSystem(CollisionSystemType type) {
     assert(assembly.GetNbodies() == 0);
 
@@ -872,6 +917,10 @@ unsigned int ChSystemParallel::GetNumBilaterals() {
     return data_manager->num_bilaterals;
 }
 
+unsigned int ChSystemParallel::GetNumSleepingBodies() {
+    return data_manager->num_sleeping_bodies;
+}
+
 // -------------------------------------------------------------
 
 double ChSystemParallel::GetTimerStep() const {
@@ -919,6 +968,7 @@ void ChSystemParallel::SetNumThreads(int num_threads_chrono, int num_threads_col
         std::cout << "larger than maximum available (" << max_avail_threads << ")" << std::endl;
     }
     omp_set_num_threads(num_threads_chrono);
+    current_threads = num_threads_chrono;
 #else
     std::cout << "WARNING! OpenMP not enabled" << std::endl;
 #endif
@@ -929,12 +979,26 @@ void ChSystemParallel::EnableThreadTuning(int min_threads, int max_threads) {
     data_manager->settings.perform_thread_tuning = true;
     data_manager->settings.min_threads = min_threads;
     data_manager->settings.max_threads = max_threads;
-    omp_set_num_threads(min_threads);
+    data_manager->thread_tuner.Enable(min_threads, max_threads);
+    current_threads = data_manager->thread_tuner.GetNumThreads(ChThreadTuner::SOLVER);
 #else
     std::cout << "WARNING! OpenMP not enabled" << std::endl;
 #endif
 }
 
+void ChSystemParallel::DisableThreadTuning() {
+    data_manager->settings.perform_thread_tuning = false;
+    data_manager->thread_tuner.Disable();
+    current_threads = nthreads_chrono;
+#ifdef _OPENMP
+    omp_set_num_threads(nthreads_chrono);
+#endif
+}
+
+const ChThreadTuner& ChSystemParallel::GetThreadTuner() const {
+    return data_manager->thread_tuner;
+}
+
 // -------------------------------------------------------------
 
 void ChSystemParallel::SetMaterialCompositionStrategy(std::unique_ptr<ChMaterialCompositionStrategy>&& strategy) {
@@ -74,7 +74,6 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     virtual void UpdateShafts();
     virtual void UpdateMotorLinks();
     virtual void Update3DOFBodies();
-    void RecomputeThreads();
 
     virtual ChBody* NewBody() override;
     virtual ChBodyAuxRef* NewBodyAuxRef() override;
@@ -94,6 +93,10 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     unsigned int GetNumContacts();
     unsigned int GetNumBilaterals();
 
+    /// Return the number of rigid bodies currently sleeping.
+    /// Sleeping is enabled with SetUseSleeping(true); see ManageSleepingIslands.
+    unsigned int GetNumSleepingBodies();
+
     /// Return the time (in seconds) spent for computing the time step.
     virtual double GetTimerStep() const override;
 
@@ -176,9 +179,18 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
                                int num_threads_eigen = 0) override;
 
     /// Enable dynamic adjustment of number of threads between the specified limits.
-    /// The initial number of threads is set to min_threads.
+    /// A separate number of threads is tuned for each phase of the time step (update, broadphase, narrowphase, and
+    /// solver), based on the phase times measured over successive steps. See ChThreadTuner.
     void EnableThreadTuning(int min_threads, int max_threads);
 
+    /// Disable dynamic adjustment of number of threads.
+    /// The number of OpenMP threads is reset to the value specified through SetNumThreads. This is also done at the
+    /// next step if thread tuning is turned off directly in the settings (perform_thread_tuning).
+    void DisableThreadTuning();
+
+    /// Return the thread tuner, which reports the number of threads selected for each phase of the time step.
+    const ChThreadTuner& GetThreadTuner() const;
+
     // Based on the specified logging level and the state of that level, enable or disable logging level.
     void SetLoggingLevel(LoggingLevel level, bool state = true);
 
@@ -188,25 +200,37 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
 
     ChParallelDataManager* data_manager;
 
+    /// Number of threads currently used in the solver phase.
+    /// \deprecated Use GetThreadTuner to query the number of threads selected for each phase of the time step.
     int current_threads;
 
   protected:
-    double old_timer, old_timer_cd;
-    bool detect_optimal_threads;
+    double old_timer_cd;
 
     int detect_optimal_bins;
-    std::vector<double> timer_accumulator, cd_accumulator;
-    uint frame_threads, frame_bins, counter;
+    std::vector<double> cd_accumulator;
+    uint frame_bins, counter;
     std::vector<ChLink*>::iterator it;
 
     CollisionSystemType collision_system_type;
 
+    /// Put to sleep the islands (sets of bodies connected through contacts and links) in which all bodies are at
+    /// rest, and wake up the sleeping islands touched by an awake body.
+    /// Sleeping bodies are excluded from the solver and from the broadphase pairs with other sleeping or fixed
+    /// bodies. The rest thresholds are those of ChBody (see ChBody::SetSleepMinSpeed and ChBody::SetSleepTime).
+    /// Sleeping is not supported for systems with fluid or FEA containers.
+    virtual void ManageSleepingIslands();
+
   private:
     void AddShaft(std::shared_ptr<ChShaft> shaft);
 
     std::vector<ChShaft*> shaftlist;
     std::vector<ChLinkMotorLinearSpeed*> linmotorlist;
     std::vector<ChLinkMotorRotationSpeed*> rotmotorlist;
+
+    custom_vector<char> body_fixed;    ///< flags for fixed bodies (island detection)
+    custom_vector<char> body_at_rest;  ///< flags for bodies that could go to sleep
+    std::vector<char> island_awake;    ///< flags for islands with at least one body not at rest
 };
 
 //====================================================================================================
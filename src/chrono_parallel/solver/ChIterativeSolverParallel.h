@@ -117,9 +117,14 @@ class CH_PARALLEL_API ChIterativeSolverParallelSMC : public ChIterativeSolverPar
     void host_CalcContactForces(custom_vector<int>& ext_body_id,
                                 custom_vector<real3>& ext_body_force,
                                 custom_vector<real3>& ext_body_torque,
-                                custom_vector<vec2>& shape_pairs,
+                                custom_vector<long long>& history_keys,
                                 custom_vector<char>& shear_touch);
 
+    /// Rebuild the contact history hash table with a capacity sufficient for the current contacts.
+    void host_RebuildContactHistory();
+    /// Keep only the contact history entries touched during the current step.
+    void host_CompactContactHistory(const custom_vector<char>& shear_touch);
+
     void host_AddContactForces(uint ct_body_count, const custom_vector<int>& ct_body_id);
 
     void host_SetContactForcesMap(uint ct_body_count, const custom_vector<int>& ct_body_id);
@@ -450,6 +450,12 @@ void ChIterativeSolverParallelNSC::ChangeSolverType(SolverType type) {
         case SolverType::GAUSS_SEIDEL:
             solver = new ChSolverParallelGS();
             break;
+        case SolverType::PDIP:
+            solver = new ChSolverParallelPDIP();
+            break;
+        case SolverType::ADMM:
+            solver = new ChSolverParallelADMM();
+            break;
         default:
                 break;
     }
@@ -38,10 +38,75 @@
 
 #if defined _WIN32
 #include <cstdint>
+#include <intrin.h>
 #endif
 
 using namespace chrono;
 
+// -----------------------------------------------------------------------------
+// Contact history table (MultiStep tangential displacement mode).
+// The history is stored in an open-addressing hash table keyed by the pair of
+// global shape IDs (for a contact with a triangle of an instanced mesh, by the
+// other shape and the triangle, so that each triangle has its own history).
+// During a time step, the table has a power-of-two capacity of at least twice
+// the number of entries it may hold (history carried over from the previous
+// step plus the current contacts), so that linear probing always finds either
+// the key or an empty slot. Empty slots have key -1 and zero history.
+// Between time steps, the table is compacted to the entries touched in the step.
+// -----------------------------------------------------------------------------
+
+// Atomically replace the value at 'address' with 'val' if it is equal to 'compare'.
+// Return the value found at 'address'.
+static inline long long AtomicCAS(long long* address, long long compare, long long val) {
+#if defined _WIN32
+    return _InterlockedCompareExchange64(address, val, compare);
+#else
+    return __sync_val_compare_and_swap(address, compare, val);
+#endif
+}
+
+// Encode the (unordered) pair of shape IDs in a single key.
+static inline long long ShapePairKey(int s1, int s2) {
+    return ((long long)std::max(s1, s2) << 32) | (long long)std::min(s1, s2);
+}
+
+// Encode a shape and a mesh triangle (by its ID over all instanced meshes) in a single key. The high bit of the
+// triangle ID is set, so that the key cannot be equal to the key of a shape pair.
+static inline long long ShapeTriangleKey(int s, int triangle) {
+    return ((long long)s << 32) | (long long)(0x80000000u | (unsigned int)triangle);
+}
+
+// Initial probe position for the specified key (64-bit finalizer from MurmurHash3).
+static inline uint ShapePairHash(long long key, uint mask) {
+    unsigned long long h = (unsigned long long)key;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (uint)(h & mask);
+}
+
+// Find the slot holding the specified key or, if not present, claim an empty slot
+// for it. Safe to call concurrently: slots are claimed with a compare-and-swap.
+static inline uint FindOrInsertHistory(long long* keys, uint mask, long long key, bool& newcontact) {
+    uint slot = ShapePairHash(key, mask);
+    while (true) {
+        long long current = ((volatile long long*)keys)[slot];
+        if (current == -1)
+            current = AtomicCAS(&keys[slot], -1, key);
+        if (current == -1) {
+            newcontact = true;
+            return slot;
+        }
+        if (current == key) {
+            newcontact = false;
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Main worker function for calculating contact forces. Calculates the contact
 // force and torque for the contact pair identified by 'index' and stores them
@@ -52,7 +117,7 @@ using namespace chrono;
 void function_CalcContactForces(
     int index,                                            // index of this contact pair
     vec2* body_pairs,                                     // indices of the body pair in contact
-    vec2* shape_pairs,                                    // indices of the shape pair in contact
+    long long* history_keys,                              // contact history key (per contact)
     ChSystemSMC::ContactForceModel contact_model,         // contact force model
     ChSystemSMC::AdhesionForceModel adhesion_model,       // adhesion force model
     ChSystemSMC::TangentialDisplacementModel displ_mode,  // type of tangential displacement history
@@ -76,9 +141,10 @@ void function_CalcContactForces(
     real3* normal,                                        // contact normal (per contact)
     real* depth,                                          // penetration depth (per contact)
     real* eff_radius,                                     // effective contact radius (per contact)
-    vec3* shear_neigh,                                    // neighbor list of contacting bodies and shapes (per body)
-    char* shear_touch,                                    // flag if contact in neighbor list is persistent (per body)
-    real3* shear_disp,                                    // accumulated shear displacement for each neighbor (per body)
+    long long* shear_keys,                                // shape pair keys of the contact history table
+    uint shear_mask,                                      // contact history table capacity minus one
+    char* shear_touch,                                    // flag if contact history entry is persistent (per entry)
+    real3* shear_disp,                                    // accumulated shear displacement (per entry)
     real* contact_relvel_init,                            // initial relative normal velocity per contact pair
     real* contact_duration,                               // duration of persistent contact between contact pairs
     int* ext_body_id,                                     // [output] body IDs (two per contact)
@@ -171,61 +237,28 @@ void function_CalcContactForces(
     real delta_n = -depth[index];
     real3 delta_t = real3(0);
 
-    int i;
-    int contact_id;
-    int shear_body1;
-    int shear_body2;
-    int shear_shape1;
-    int shear_shape2;
-    bool newcontact = true;
+    uint ctSaveId = 0;
+    int shear_body1 = 0;
 
     if (displ_mode == ChSystemSMC::TangentialDisplacementModel::OneStep) {
         delta_t = relvel_t * dT;
     } else if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
         delta_t = relvel_t * dT;
 
-        // Identify the two shapes in contact (global shape IDs).
-        int s1 = shape_pairs[index].x;
-        int s2 = shape_pairs[index].y;
-
-        // Contact history information stored on the body with the smaller shape or else the body with larger index.
-        // Currently, it is assumed that the smaller shape is on the body with larger ID. We call this body shear_body1.
+        // The contact history is expressed relative to the body with larger index. We call this body shear_body1.
         shear_body1 = std::max(b1, b2);
-        shear_body2 = std::min(b1, b2);
-        shear_shape1 = std::max(s1, s2);
-        shear_shape2 = std::min(s1, s2);
-
-        // Check if contact history already exists. If not, initialize new contact history.
-        for (i = 0; i < max_shear; i++) {
-            int ctIdUnrolled = max_shear * shear_body1 + i;
-            if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
-                contact_duration[ctIdUnrolled] += dT;
-                contact_id = i;
-                newcontact = false;
-                break;
-            }
-        }
-        if (newcontact == true) {
-            for (i = 0; i < max_shear; i++) {
-                int ctIdUnrolled = max_shear * shear_body1 + i;
-                if (shear_neigh[ctIdUnrolled].x == -1) {
-                    contact_id = i;
-                    shear_neigh[ctIdUnrolled].x = shear_body2;
-                    shear_neigh[ctIdUnrolled].y = shear_shape1;
-                    shear_neigh[ctIdUnrolled].z = shear_shape2;
-                    shear_disp[ctIdUnrolled].x = 0;
-                    shear_disp[ctIdUnrolled].y = 0;
-                    shear_disp[ctIdUnrolled].z = 0;
-                    contact_relvel_init[ctIdUnrolled] = relvel_init;
-                    contact_duration[ctIdUnrolled] = 0;
-                    break;
-                }
-            }
+
+        // Check if contact history already exists. If not, initialize new contact history (empty slots in the
+        // history table already have zero shear displacement and contact duration).
+        bool newcontact;
+        ctSaveId = FindOrInsertHistory(shear_keys, shear_mask, history_keys[index], newcontact);
+        if (newcontact) {
+            contact_relvel_init[ctSaveId] = relvel_init;
+        } else {
+            contact_duration[ctSaveId] += dT;
         }
 
-        // Record that these two bodies are really in contact at this time.
-        int ctSaveId = max_shear * shear_body1 + contact_id;
+        // Record that these two shapes are really in contact at this time.
         shear_touch[ctSaveId] = true;
 
         // Increment stored contact history tangential (shear) displacement vector and project it onto the current
@@ -458,9 +491,9 @@ void function_CalcContactForces(
             if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
                 delta_t = (forceT - forceT_damp) / kt;
                 if (shear_body1 == b1) {
-                    shear_disp[max_shear * shear_body1 + contact_id] = delta_t;
+                    shear_disp[ctSaveId] = delta_t;
                 } else {
-                    shear_disp[max_shear * shear_body1 + contact_id] = -delta_t;
+                    shear_disp[ctSaveId] = -delta_t;
                 }
             }
         } else {
@@ -555,14 +588,14 @@ void function_CalcContactForces(
 void ChIterativeSolverParallelSMC::host_CalcContactForces(custom_vector<int>& ext_body_id,
                                                           custom_vector<real3>& ext_body_force,
                                                           custom_vector<real3>& ext_body_torque,
-                                                          custom_vector<vec2>& shape_pairs,
+                                                          custom_vector<long long>& history_keys,
                                                           custom_vector<char>& shear_touch) {
 #pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->num_rigid_contacts; index++) {
         function_CalcContactForces(
             index,                                                  // index of this contact pair
             data_manager->host_data.bids_rigid_rigid.data(),        // indices of the body pair in contact
-            shape_pairs.data(),                                     // indices of the shape pair in contact
+            history_keys.data(),                                    // contact history key (per contact)
             data_manager->settings.solver.contact_force_model,      // contact force model
             data_manager->settings.solver.adhesion_force_model,     // adhesion force model
             data_manager->settings.solver.tangential_displ_mode,    // type of tangential displacement history
@@ -586,9 +619,10 @@ void ChIterativeSolverParallelSMC::host_CalcContactForces(custom_vector<int>& ex
             data_manager->host_data.norm_rigid_rigid.data(),        // contact normal (per contact)
             data_manager->host_data.dpth_rigid_rigid.data(),        // penetration depth (per contact)
             data_manager->host_data.erad_rigid_rigid.data(),        // effective contact radius (per contact)
-            data_manager->host_data.shear_neigh.data(),  // neighbor list of contacting bodies and shapes (per body)
-            shear_touch.data(),                          // flag if contact in neighbor list is persistent (per body)
-            data_manager->host_data.shear_disp.data(),   // accumulated shear displacement for each neighbor (per body)
+            data_manager->host_data.shear_keys.data(),   // shape pair keys of the contact history table
+            (uint)data_manager->host_data.shear_keys.size() - 1,  // contact history table capacity minus one
+            shear_touch.data(),                          // flag if contact history entry is persistent (per entry)
+            data_manager->host_data.shear_disp.data(),   // accumulated shear displacement (per entry)
             data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity per contact pair
             data_manager->host_data.contact_duration.data(),     // duration of persistent contact between contact pairs
             ext_body_id.data(),                                  // [output] body IDs (two per contact)
@@ -598,6 +632,68 @@ void ChIterativeSolverParallelSMC::host_CalcContactForces(custom_vector<int>& ex
     }
 }
 
+// -----------------------------------------------------------------------------
+// Rebuild the contact history hash table from the compacted history of the
+// previous step, with a capacity sufficient for all current contacts.
+// -----------------------------------------------------------------------------
+void ChIterativeSolverParallelSMC::host_RebuildContactHistory() {
+    custom_vector<long long>& shear_keys = data_manager->host_data.shear_keys;
+    custom_vector<real3>& shear_disp = data_manager->host_data.shear_disp;
+    custom_vector<real>& contact_relvel_init = data_manager->host_data.contact_relvel_init;
+    custom_vector<real>& contact_duration = data_manager->host_data.contact_duration;
+
+    uint num_history = (uint)shear_keys.size();
+    uint capacity = 64;
+    while (capacity < 2 * (num_history + data_manager->num_rigid_contacts))
+        capacity *= 2;
+
+    custom_vector<long long> old_keys(capacity, -1);
+    custom_vector<real3> old_disp(capacity, real3(0));
+    custom_vector<real> old_relvel_init(capacity, 0);
+    custom_vector<real> old_duration(capacity, 0);
+    old_keys.swap(shear_keys);
+    old_disp.swap(shear_disp);
+    old_relvel_init.swap(contact_relvel_init);
+    old_duration.swap(contact_duration);
+
+    uint mask = capacity - 1;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_history; i++) {
+        bool newcontact;
+        uint slot = FindOrInsertHistory(shear_keys.data(), mask, old_keys[i], newcontact);
+        shear_disp[slot] = old_disp[i];
+        contact_relvel_init[slot] = old_relvel_init[i];
+        contact_duration[slot] = old_duration[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Compact the contact history hash table, keeping only the entries for shape
+// pairs in contact during the current step.
+// -----------------------------------------------------------------------------
+void ChIterativeSolverParallelSMC::host_CompactContactHistory(const custom_vector<char>& shear_touch) {
+    custom_vector<long long>& shear_keys = data_manager->host_data.shear_keys;
+    custom_vector<real3>& shear_disp = data_manager->host_data.shear_disp;
+    custom_vector<real>& contact_relvel_init = data_manager->host_data.contact_relvel_init;
+    custom_vector<real>& contact_duration = data_manager->host_data.contact_duration;
+
+    uint num_history = 0;
+    for (uint i = 0; i < (uint)shear_keys.size(); i++) {
+        if (shear_touch[i]) {
+            shear_keys[num_history] = shear_keys[i];
+            shear_disp[num_history] = shear_disp[i];
+            contact_relvel_init[num_history] = contact_relvel_init[i];
+            contact_duration[num_history] = contact_duration[i];
+            num_history++;
+        }
+    }
+
+    shear_keys.resize(num_history);
+    shear_disp.resize(num_history);
+    contact_relvel_init.resize(num_history);
+    contact_duration.resize(num_history);
+}
+
 // -----------------------------------------------------------------------------
 // Include contact impulses (linear and rotational) for all bodies that are
 // involved in at least one contact. For each such body, the corresponding
@@ -655,31 +751,38 @@ void ChIterativeSolverParallelSMC::ProcessContacts() {
     custom_vector<int> ext_body_id(2 * data_manager->num_rigid_contacts);
     custom_vector<real3> ext_body_force(2 * data_manager->num_rigid_contacts);
     custom_vector<real3> ext_body_torque(2 * data_manager->num_rigid_contacts);
-    custom_vector<vec2> shape_pairs;
+    custom_vector<long long> history_keys;
     custom_vector<char> shear_touch;
 
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-        shape_pairs.resize(data_manager->num_rigid_contacts);
-        shear_touch.resize(max_shear * data_manager->num_rigid_bodies);
+        host_RebuildContactHistory();
+        history_keys.resize(data_manager->num_rigid_contacts);
+        shear_touch.resize(data_manager->host_data.shear_keys.size());
         Thrust_Fill(shear_touch, false);
+
+        const custom_vector<long long>& contact_shapeIDs = data_manager->host_data.contact_shapeIDs;
+        const custom_vector<int>& contact_triangle = data_manager->host_data.contact_triangle;
+        const shape_container& shapes = data_manager->shape_data;
 #pragma omp parallel for
         for (int i = 0; i < (signed)data_manager->num_rigid_contacts; i++) {
-            vec2 pair = I2(int(data_manager->host_data.contact_shapeIDs[i] >> 32),
-                           int(data_manager->host_data.contact_shapeIDs[i] & 0xffffffff));
-            shape_pairs[i] = pair;
+            int s1 = int(contact_shapeIDs[i] >> 32);
+            int s2 = int(contact_shapeIDs[i] & 0xffffffff);
+            if (contact_triangle[i] < 0) {
+                history_keys[i] = ShapePairKey(s1, s2);
+            } else {
+                // Contact with a triangle of an instanced mesh
+                bool mesh1 = shapes.typ_rigid[s1] == collision::ChCollisionShape::Type::TRIANGLEMESH;
+                int mesh = mesh1 ? s1 : s2;
+                int other = mesh1 ? s2 : s1;
+                history_keys[i] = ShapeTriangleKey(other, shapes.mesh_triangle_id[mesh] + contact_triangle[i]);
+            }
         }
     }
 
-    host_CalcContactForces(ext_body_id, ext_body_force, ext_body_torque, shape_pairs, shear_touch);
+    host_CalcContactForces(ext_body_id, ext_body_force, ext_body_torque, history_keys, shear_touch);
 
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-#pragma omp parallel for
-        for (int index = 0; index < (signed)data_manager->num_rigid_bodies; index++) {
-            for (int i = 0; i < max_shear; i++) {
-                if (shear_touch[max_shear * index + i] == false)
-                    data_manager->host_data.shear_neigh[max_shear * index + i].x = -1;
-            }
-        }
+        host_CompactContactHistory(shear_touch);
     }
 
     // 2. Calculate contact forces and torques - per body basis
@@ -80,3 +80,69 @@ real ChSolverParallel::LargestEigenValue(ChShurProduct& ShurProduct, DynamicVect
     }
     return lambda;
 }
+
+real ChSolverParallel::ComputeShurEntry(const uint a, const uint b) {
+    const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+    const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+
+    // d_a^T * M_inv * d_b, with d_a and d_b the rows a and b of D_T
+    real sum = 0;
+    for (CompressedMatrix<real>::ConstIterator it = D_T.begin(a); it != D_T.end(a); ++it) {
+        for (CompressedMatrix<real>::ConstIterator jt = M_inv.begin(it->index()); jt != M_inv.end(it->index()); ++jt) {
+            CompressedMatrix<real>::ConstIterator dt = D_T.find(b, jt->index());
+            if (dt != D_T.end(b)) {
+                sum += it->value() * jt->value() * dt->value();
+            }
+        }
+    }
+    return sum;
+}
+
+void ChSolverParallel::ComputeShurDiagonal(const uint size, DynamicVector<real>& diag) {
+    const DynamicVector<real>& E = data_manager->host_data.E;
+
+    diag.resize(size);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)size; i++) {
+        diag[i] = ComputeShurEntry(i, i) + (i < (signed)E.size() ? E[i] : 0);
+    }
+}
+
+uint ChSolverParallel::SolveInnerCG(const std::function<void(const DynamicVector<real>&, DynamicVector<real>&)>& A,
+                                    const std::function<void(const DynamicVector<real>&, DynamicVector<real>&)>& P,
+                                    const DynamicVector<real>& b,
+                                    DynamicVector<real>& x,
+                                    const uint max_iter,
+                                    const real tolerance) {
+    cg_r.resize(b.size());
+    cg_z.resize(b.size());
+    cg_p.resize(b.size());
+    cg_Ap.resize(b.size());
+
+    A(x, cg_Ap);
+    cg_r = b - cg_Ap;
+    P(cg_r, cg_z);
+    cg_p = cg_z;
+    real rz = (cg_r, cg_z);
+
+    uint iter;
+    for (iter = 0; iter < max_iter; iter++) {
+        if (Sqrt((real)(cg_r, cg_r)) < tolerance) {
+            break;
+        }
+        A(cg_p, cg_Ap);
+        real pAp = (cg_p, cg_Ap);
+        if (pAp <= 0) {
+            break;
+        }
+        real alpha = rz / pAp;
+        x += alpha * cg_p;
+        cg_r -= alpha * cg_Ap;
+        P(cg_r, cg_z);
+        real rz_new = (cg_r, cg_z);
+        cg_p = cg_z + (rz_new / rz) * cg_p;
+        rz = rz_new;
+    }
+    return iter;
+}
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "chrono_parallel/ChDataManager.h"
 #include "chrono_parallel/math/ChParallelMath.h"
 #include "chrono_parallel/constraints/ChConstraintRigidRigid.h"
@@ -128,6 +130,22 @@ class CH_PARALLEL_API ChSolverParallel {
 
     real LargestEigenValue(ChShurProduct& ShurProduct, DynamicVector<real>& temp, real lambda = 0);
 
+    /// Compute the entry (a, b) of D^T * M^-1 * D, i.e. the Schur complement matrix without compliance.
+    real ComputeShurEntry(const uint a, const uint b);
+
+    /// Compute the diagonal of the Schur complement matrix (D^T * M^-1 * D + E) for the first size constraints.
+    void ComputeShurDiagonal(const uint size, DynamicVector<real>& diag);
+
+    /// Solve A*x = b with the preconditioned conjugate gradient method, using x as initial guess.
+    /// The products A*p and P*r (P approximating the inverse of A) are evaluated by the given functions.
+    /// Iterations stop when the residual norm is below tolerance. Return the number of iterations performed.
+    uint SolveInnerCG(const std::function<void(const DynamicVector<real>&, DynamicVector<real>&)>& A,
+                      const std::function<void(const DynamicVector<real>&, DynamicVector<real>&)>& P,
+                      const DynamicVector<real>& b,
+                      DynamicVector<real>& x,
+                      const uint max_iter,
+                      const real tolerance);
+
     int current_iteration;  ///< The current iteration number of the solver
 
     ChConstraintRigidRigid* rigid_rigid;
@@ -139,6 +157,9 @@ class CH_PARALLEL_API ChSolverParallel {
     ChParallelDataManager* data_manager;  ///< Pointer to the system's data manager
 
     DynamicVector<real> eigen_vec;
+
+    /// Conjugate gradient work vectors.
+    DynamicVector<real> cg_r, cg_z, cg_p, cg_Ap;
 };
 
 //========================================================================================================
@@ -261,6 +282,93 @@ class CH_PARALLEL_API ChSolverParallelSPGQP : public ChSolverParallel {
     std::vector<real> f_hist;
 };
 
+/// Primal-Dual Interior Point solver.
+/// Each contact cone (sliding, spinning and rolling friction, or the normal bound for frictionless contacts) is
+/// written as a smooth convex inequality, and the Newton system of the perturbed KKT conditions is solved matrix-free
+/// with a conjugate gradient method, preconditioned with the inverse of the diagonal block of each contact.
+/// Problems with 3DOF or FEA constraints, which are not expressed as cones, are solved with APGD instead.
+class CH_PARALLEL_API ChSolverParallelPDIP : public ChSolverParallel {
+  public:
+    ChSolverParallelPDIP();
+    ~ChSolverParallelPDIP() {}
+
+    /// Solve using the primal-dual interior point method.
+    uint Solve(ChShurProduct& ShurProduct,    ///< Schur product
+               ChProjectConstraints& Project, ///< Constraints
+               const uint max_iter,           ///< Maximum number of iterations
+               const uint size,               ///< Number of unknowns
+               const DynamicVector<real>& b,  ///< Rhs vector
+               DynamicVector<real>& x         ///< The vector of unknowns
+               );
+
+    /// Setup the cone data and the diagonal blocks of the Schur complement for each contact.
+    void SetupCones();
+
+    /// Evaluate the cone inequalities at x (fc), and the dual residual for the multipliers lam (rd).
+    /// Return false if x is not strictly inside all cones.
+    bool EvaluateCones(const DynamicVector<real>& x,
+                       const DynamicVector<real>& Nx,
+                       const DynamicVector<real>& b,
+                       const DynamicVector<real>& lam,
+                       DynamicVector<real>& fc,
+                       DynamicVector<real>& rd);
+
+    /// Compute the norm of the residual of the perturbed KKT conditions.
+    real ResidualNorm(const DynamicVector<real>& rd,
+                      const DynamicVector<real>& fc,
+                      const DynamicVector<real>& lam,
+                      real t);
+
+    /// Multiply p by the Hessian of the barrier terms at x and add the result to out.
+    void BarrierProduct(const DynamicVector<real>& x, const DynamicVector<real>& p, DynamicVector<real>& out);
+
+    /// Factorize the diagonal block of each contact in the Newton matrix at x.
+    void FactorizeBlocks(const DynamicVector<real>& x);
+
+    /// Apply the block preconditioner to r.
+    void ApplyPreconditioner(const DynamicVector<real>& r, DynamicVector<real>& out);
+
+    // Cone data for three cones (sliding, spinning, rolling) per contact: friction coefficient (0 if the cone is not
+    // used) and tangential entries (-1 if unused)
+    DynamicVector<real> cone_mu;
+    custom_vector<int> cone_t;
+    DynamicVector<real> mask;
+    real cone_eps;
+
+    // Diagonal blocks (up to 6x6) of each contact: entries (-1 if unused), Schur complement block, Cholesky factor
+    custom_vector<int> block_idx;
+    DynamicVector<real> block_N, block_L;
+
+    // PDIP specific vectors
+    DynamicVector<real> fc, lam, dlam, rd, Nx, dx, Ndx, rhs, diag, inv_diag, temp, x_new, Nx_new, lam_new, fc_new,
+        rd_new;
+
+    ChSolverParallelAPGD fallback;
+};
+
+/// Alternating Direction Method of Multipliers solver.
+/// The unknowns are split into an unconstrained copy, updated by solving (N + rho*I) x = b + rho*(z - u) with a
+/// preconditioned conjugate gradient method, and a copy z projected onto the constraint cones.
+class CH_PARALLEL_API ChSolverParallelADMM : public ChSolverParallel {
+  public:
+    ChSolverParallelADMM();
+    ~ChSolverParallelADMM() {}
+
+    /// Solve using the ADMM method.
+    uint Solve(ChShurProduct& ShurProduct,    ///< Schur product
+               ChProjectConstraints& Project, ///< Constraints
+               const uint max_iter,           ///< Maximum number of iterations
+               const uint size,               ///< Number of unknowns
+               const DynamicVector<real>& b,  ///< Rhs vector
+               DynamicVector<real>& x         ///< The vector of unknowns
+               );
+
+    real rho;  ///< Current penalty parameter
+
+    // ADMM specific vectors
+    DynamicVector<real> xs, z, z_old, u, rhs, diag, inv_diag, temp;
+};
+
 /// Conjugate gradient solver.
 class CH_PARALLEL_API ChSolverParallelCG : public ChSolverParallel {
   public:
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// ADMM solver for the cone complementarity problem
+//   min 1/2 x^T N x - b^T x  subject to  x in K
+// written as min f(x) + I_K(z) with x = z. Each iteration performs
+//   x = (N + rho I)^-1 (b + rho (z - u))   (preconditioned conjugate gradient)
+//   z = Proj_K(x + u)
+//   u = u + x - z
+// The penalty rho is adapted to balance the primal and dual residuals.
+//
+// =============================================================================
+
+#include "chrono_parallel/solver/ChSolverParallel.h"
+
+using namespace chrono;
+
+ChSolverParallelADMM::ChSolverParallelADMM() : ChSolverParallel(), rho(0) {}
+
+uint ChSolverParallelADMM::Solve(ChShurProduct& ShurProduct,
+                                 ChProjectConstraints& Project,
+                                 const uint max_iter,
+                                 const uint size,
+                                 const DynamicVector<real>& b,
+                                 DynamicVector<real>& gamma) {
+    if (size == 0) {
+        return 0;
+    }
+
+    real& residual = data_manager->measures.solver.residual;
+    real& objective_value = data_manager->measures.solver.objective_value;
+
+    data_manager->system_timer.start("ChSolverParallel_Solve");
+
+    const real tolerance = data_manager->settings.solver.tol_speed;
+    const uint max_inner = data_manager->settings.solver.max_iteration_inner;
+
+    xs.resize(size);
+    z.resize(size);
+    z_old.resize(size);
+    u.resize(size);
+    rhs.resize(size);
+    inv_diag.resize(size);
+    temp.resize(size);
+
+    ComputeShurDiagonal(size, diag);
+
+    // Default penalty: mean of the nonzero diagonal entries of N
+    rho = data_manager->settings.solver.admm_rho;
+    if (rho <= 0) {
+        real sum = 0;
+        uint count = 0;
+        for (int i = 0; i < (signed)size; i++) {
+            if (diag[i] > 0) {
+                sum += diag[i];
+                count++;
+            }
+        }
+        rho = (count > 0) ? sum / count : 1;
+    }
+
+    // Warm start from the projected multipliers
+    Project(gamma.data());
+    z = gamma;
+    xs = gamma;
+    u = 0;
+
+    residual = 10e30;
+
+    for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
+        // x update: (N + rho I) x = b + rho (z - u)
+        rhs = b + rho * (z - u);
+#pragma omp parallel for
+        for (int i = 0; i < (signed)size; i++) {
+            inv_diag[i] = 1 / (diag[i] + rho);
+        }
+        SolveInnerCG(
+            [&](const DynamicVector<real>& p, DynamicVector<real>& out) {
+                ShurProduct(p, out);
+                out += rho * p;
+            },
+            [&](const DynamicVector<real>& r, DynamicVector<real>& out) { out = inv_diag * r; },  //
+            rhs, xs, max_inner, 1e-2 * tolerance);
+
+        // z update: projection onto the cones
+        z_old = z;
+        z = xs + u;
+        Project(z.data());
+
+        // Scaled dual variable update
+        temp = xs - z;
+        u += temp;
+
+        // Both residuals are scaled by rho to be expressed as velocities
+        real res_primal = rho * Sqrt((real)(temp, temp));
+        temp = z - z_old;
+        real delta_z = Sqrt((real)(temp, temp));
+        real res_dual = rho * delta_z;
+
+        residual = Max(res_primal, res_dual);
+
+        AtIterationEnd(residual, delta_z);
+
+        if (residual < tolerance) {
+            break;
+        }
+
+        // Keep the primal and dual residuals within a factor of 10 of each other
+        if (data_manager->settings.solver.admm_adaptive_rho) {
+            if (res_primal > 10 * res_dual) {
+                rho *= 2;
+                u *= 0.5;
+            } else if (res_dual > 10 * res_primal) {
+                rho *= 0.5;
+                u *= 2;
+            }
+        }
+    }
+
+    gamma = z;
+    ShurProduct(gamma, temp);
+    objective_value = (gamma, 0.5 * temp - b);
+
+    data_manager->system_timer.stop("ChSolverParallel_Solve");
+    return current_iteration;
+}
@@ -0,0 +1,580 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Primal-dual interior point solver for the cone complementarity problem
+//   min 1/2 x^T N x - b^T x  subject to  f_j(x) <= 0
+// Each contact contributes up to three cone inequalities: sliding friction
+// (or the normal bound for frictionless contacts), spinning and rolling
+// friction. A cone with friction coefficient mu on the tangential entries t and
+// normal entry n (shifted by the cohesion c) is written in the smooth convex form
+//   f(x) = sqrt(|t|^2 + eps^2) - eps - mu * (n + c)
+// The reduced Newton system
+//   (N + sum_j lam_j H_j + sum_j (lam_j / -f_j) g_j g_j^T) dx = b - N x + sum_j g_j / (t f_j)
+// is solved matrix-free with a conjugate gradient method. The preconditioner is
+// the inverse of the diagonal block of each contact (its normal, tangential,
+// spinning and rolling entries), which holds all barrier terms of the contact.
+//
+// =============================================================================
+
+#include "chrono_parallel/solver/ChSolverParallel.h"
+
+using namespace chrono;
+
+#define PDIP_BLOCK 6
+
+// In-place Cholesky factorization of the leading n x n part of a PDIP_BLOCK x PDIP_BLOCK block.
+// If the block is not positive definite, it is replaced by its diagonal.
+static void CholeskyFactor(real* A, int n) {
+    for (int j = 0; j < n; j++) {
+        real d = A[j * PDIP_BLOCK + j];
+        for (int k = 0; k < j; k++)
+            d -= A[j * PDIP_BLOCK + k] * A[j * PDIP_BLOCK + k];
+        if (d <= 0) {
+            for (int r = 0; r < n; r++) {
+                for (int c = 0; c < r; c++)
+                    A[r * PDIP_BLOCK + c] = 0;
+            }
+            for (int r = 0; r < n; r++)
+                A[r * PDIP_BLOCK + r] = Sqrt(Max(A[r * PDIP_BLOCK + r], (real)C_EPSILON));
+            return;
+        }
+        A[j * PDIP_BLOCK + j] = Sqrt(d);
+        for (int i = j + 1; i < n; i++) {
+            real v = A[i * PDIP_BLOCK + j];
+            for (int k = 0; k < j; k++)
+                v -= A[i * PDIP_BLOCK + k] * A[j * PDIP_BLOCK + k];
+            A[i * PDIP_BLOCK + j] = v / A[j * PDIP_BLOCK + j];
+        }
+    }
+}
+
+// Solve L * L^T * x = x, with L the factor computed by CholeskyFactor.
+static void CholeskySolve(const real* L, int n, real* x) {
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < i; k++)
+            x[i] -= L[i * PDIP_BLOCK + k] * x[k];
+        x[i] /= L[i * PDIP_BLOCK + i];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        for (int k = i + 1; k < n; k++)
+            x[i] -= L[k * PDIP_BLOCK + i] * x[k];
+        x[i] /= L[i * PDIP_BLOCK + i];
+    }
+}
+
+ChSolverParallelPDIP::ChSolverParallelPDIP() : ChSolverParallel(), cone_eps(0) {}
+
+void ChSolverParallelPDIP::SetupCones() {
+    const custom_vector<real3>& friction = data_manager->host_data.fric_rigid_rigid;
+    const SolverMode mode = data_manager->settings.solver.local_solver_mode;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+    const uint num_unilaterals = data_manager->num_unilaterals;
+    const uint num_bilaterals = data_manager->num_bilaterals;
+
+    cone_mu.resize(3 * num_contacts);
+    cone_t.resize(6 * num_contacts);
+
+    // Entries that are not unknowns of the current solve are kept at zero
+    mask.resize(num_unilaterals + num_bilaterals);
+    mask = 0;
+    subvector(mask, 0, num_contacts) = 1;
+    subvector(mask, num_unilaterals, num_bilaterals) = 1;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        real mu = friction[i].x;
+        real mu_roll = friction[i].y;
+        real mu_spin = friction[i].z;
+
+        // Sliding friction cone, or normal bound (mu = 1, no tangential entries)
+        cone_mu[3 * i + 0] = 1;
+        cone_t[6 * i + 0] = cone_t[6 * i + 1] = -1;
+        if (mode != SolverMode::NORMAL && mu > 0) {
+            cone_mu[3 * i + 0] = mu;
+            cone_t[6 * i + 0] = num_contacts + i * 2 + 0;
+            cone_t[6 * i + 1] = num_contacts + i * 2 + 1;
+            mask[num_contacts + i * 2 + 0] = 1;
+            mask[num_contacts + i * 2 + 1] = 1;
+        }
+
+        // Spinning friction cone
+        cone_mu[3 * i + 1] = 0;
+        cone_t[6 * i + 2] = cone_t[6 * i + 3] = -1;
+        if (mode == SolverMode::SPINNING && mu_spin > 0) {
+            cone_mu[3 * i + 1] = mu_spin;
+            cone_t[6 * i + 2] = 3 * num_contacts + i * 3 + 0;
+            mask[3 * num_contacts + i * 3 + 0] = 1;
+        }
+
+        // Rolling friction cone
+        cone_mu[3 * i + 2] = 0;
+        cone_t[6 * i + 4] = cone_t[6 * i + 5] = -1;
+        if (mode == SolverMode::SPINNING && mu_roll > 0) {
+            cone_mu[3 * i + 2] = mu_roll;
+            cone_t[6 * i + 4] = 3 * num_contacts + i * 3 + 1;
+            cone_t[6 * i + 5] = 3 * num_contacts + i * 3 + 2;
+            mask[3 * num_contacts + i * 3 + 1] = 1;
+            mask[3 * num_contacts + i * 3 + 2] = 1;
+        }
+    }
+
+    // Entries of the diagonal block of each contact (normal entry first) and the corresponding Schur complement block
+    block_idx.resize(PDIP_BLOCK * num_contacts);
+    block_N.resize(PDIP_BLOCK * PDIP_BLOCK * num_contacts);
+    block_L.resize(PDIP_BLOCK * PDIP_BLOCK * num_contacts);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        int* idx = &block_idx[PDIP_BLOCK * i];
+        int n = 0;
+        idx[n++] = i;
+        for (int k = 0; k < 6; k++) {
+            if (cone_t[6 * i + k] >= 0)
+                idx[n++] = cone_t[6 * i + k];
+        }
+        for (int k = n; k < PDIP_BLOCK; k++)
+            idx[k] = -1;
+
+        real* N = &block_N[PDIP_BLOCK * PDIP_BLOCK * i];
+        for (int r = 0; r < n; r++) {
+            for (int c = 0; c <= r; c++) {
+                N[r * PDIP_BLOCK + c] = N[c * PDIP_BLOCK + r] = ComputeShurEntry(idx[r], idx[c]);
+            }
+        }
+    }
+}
+
+bool ChSolverParallelPDIP::EvaluateCones(const DynamicVector<real>& x,
+                                         const DynamicVector<real>& Nx,
+                                         const DynamicVector<real>& b,
+                                         const DynamicVector<real>& lam,
+                                         DynamicVector<real>& fc,
+                                         DynamicVector<real>& rd) {
+    const custom_vector<real>& cohesion = data_manager->host_data.coh_rigid_rigid;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+    const real eps = cone_eps;
+
+    rd = mask * (Nx - b);
+
+    bool feasible = true;
+#pragma omp parallel for reduction(&& : feasible)
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        real n = x[i] + cohesion[i];
+        for (int c = 0; c < 3; c++) {
+            int j = 3 * i + c;
+            real mu = cone_mu[j];
+            if (mu == 0) {
+                fc[j] = -1;
+                continue;
+            }
+            int t0 = cone_t[2 * j + 0];
+            int t1 = cone_t[2 * j + 1];
+            real x0 = (t0 >= 0) ? x[t0] : 0;
+            real x1 = (t1 >= 0) ? x[t1] : 0;
+            real s = Sqrt(x0 * x0 + x1 * x1 + eps * eps);
+            fc[j] = s - eps - mu * n;
+            feasible = feasible && (fc[j] < 0);
+
+            // Add lam_j * grad(f_j); the normal entry is shared by the cones of a contact
+            rd[i] -= lam[j] * mu;
+            if (t0 >= 0)
+                rd[t0] += lam[j] * x0 / s;
+            if (t1 >= 0)
+                rd[t1] += lam[j] * x1 / s;
+        }
+    }
+    return feasible;
+}
+
+real ChSolverParallelPDIP::ResidualNorm(const DynamicVector<real>& rd,
+                                        const DynamicVector<real>& fc,
+                                        const DynamicVector<real>& lam,
+                                        real t) {
+    real norm_cent = 0;
+#pragma omp parallel for reduction(+ : norm_cent)
+    for (int j = 0; j < (signed)fc.size(); j++) {
+        if (cone_mu[j] != 0) {
+            real r_cent = -lam[j] * fc[j] - 1 / t;
+            norm_cent += r_cent * r_cent;
+        }
+    }
+    return Sqrt((real)(rd, rd) + norm_cent);
+}
+
+void ChSolverParallelPDIP::BarrierProduct(const DynamicVector<real>& x,
+                                          const DynamicVector<real>& p,
+                                          DynamicVector<real>& out) {
+    const uint num_contacts = data_manager->num_rigid_contacts;
+    const real eps = cone_eps;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        for (int c = 0; c < 3; c++) {
+            int j = 3 * i + c;
+            real mu = cone_mu[j];
+            if (mu == 0) {
+                continue;
+            }
+            int t0 = cone_t[2 * j + 0];
+            int t1 = cone_t[2 * j + 1];
+            real x0 = (t0 >= 0) ? x[t0] : 0;
+            real x1 = (t1 >= 0) ? x[t1] : 0;
+            real p0 = (t0 >= 0) ? p[t0] : 0;
+            real p1 = (t1 >= 0) ? p[t1] : 0;
+            real s = Sqrt(x0 * x0 + x1 * x1 + eps * eps);
+            real g0 = x0 / s;
+            real g1 = x1 / s;
+
+            // w_j * (g_j^T p) * g_j
+            real w = lam[j] / -fc[j];
+            real gp = w * (g0 * p0 + g1 * p1 - mu * p[i]);
+            out[i] -= gp * mu;
+
+            // lam_j * H_j * p, where H_j = (s^2 I - t t^T) / s^3 on the tangential entries
+            real h = lam[j] / (s * s * s);
+            if (t0 >= 0)
+                out[t0] += gp * g0 + h * ((s * s - x0 * x0) * p0 - x0 * x1 * p1);
+            if (t1 >= 0)
+                out[t1] += gp * g1 + h * ((s * s - x1 * x1) * p1 - x0 * x1 * p0);
+        }
+    }
+}
+
+void ChSolverParallelPDIP::FactorizeBlocks(const DynamicVector<real>& x) {
+    const DynamicVector<real>& E = data_manager->host_data.E;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+    const real eps = cone_eps;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        const int* idx = &block_idx[PDIP_BLOCK * i];
+        const real* N = &block_N[PDIP_BLOCK * PDIP_BLOCK * i];
+        real* L = &block_L[PDIP_BLOCK * PDIP_BLOCK * i];
+
+        int n = 0;
+        while (n < PDIP_BLOCK && idx[n] >= 0)
+            n++;
+        for (int k = 0; k < PDIP_BLOCK * PDIP_BLOCK; k++)
+            L[k] = N[k];
+        for (int r = 0; r < n; r++)
+            L[r * PDIP_BLOCK + r] += E[idx[r]];
+
+        // Barrier terms of the three cones; the tangential entries follow the normal entry in cone order
+        int pos = 1;
+        for (int c = 0; c < 3; c++) {
+            int j = 3 * i + c;
+            real mu = cone_mu[j];
+            int t0 = cone_t[2 * j + 0];
+            int t1 = cone_t[2 * j + 1];
+            int p0 = (t0 >= 0) ? pos++ : -1;
+            int p1 = (t1 >= 0) ? pos++ : -1;
+            if (mu == 0) {
+                continue;
+            }
+            real x0 = (t0 >= 0) ? x[t0] : 0;
+            real x1 = (t1 >= 0) ? x[t1] : 0;
+            real s = Sqrt(x0 * x0 + x1 * x1 + eps * eps);
+            real w = lam[j] / -fc[j];
+            real h = lam[j] / (s * s * s);
+
+            // w * g * g^T + lam * H, with g = (-mu, x0 / s, x1 / s)
+            real g[3] = {-mu, x0 / s, x1 / s};
+            int p[3] = {0, p0, p1};
+            for (int a = 0; a < 3; a++) {
+                if (p[a] < 0)
+                    continue;
+                for (int b = 0; b < 3; b++) {
+                    if (p[b] < 0)
+                        continue;
+                    L[p[a] * PDIP_BLOCK + p[b]] += w * g[a] * g[b];
+                }
+            }
+            if (p0 >= 0)
+                L[p0 * PDIP_BLOCK + p0] += h * (s * s - x0 * x0);
+            if (p1 >= 0)
+                L[p1 * PDIP_BLOCK + p1] += h * (s * s - x1 * x1);
+            if (p0 >= 0 && p1 >= 0) {
+                L[p0 * PDIP_BLOCK + p1] -= h * x0 * x1;
+                L[p1 * PDIP_BLOCK + p0] -= h * x0 * x1;
+            }
+        }
+
+        CholeskyFactor(L, n);
+    }
+}
+
+void ChSolverParallelPDIP::ApplyPreconditioner(const DynamicVector<real>& r, DynamicVector<real>& out) {
+    const uint num_contacts = data_manager->num_rigid_contacts;
+
+    // Jacobi for bilaterals and fixed entries, overwritten below for the contact entries
+    out = inv_diag * r;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        const int* idx = &block_idx[PDIP_BLOCK * i];
+        real v[PDIP_BLOCK];
+        int n = 0;
+        while (n < PDIP_BLOCK && idx[n] >= 0) {
+            v[n] = r[idx[n]];
+            n++;
+        }
+        CholeskySolve(&block_L[PDIP_BLOCK * PDIP_BLOCK * i], n, v);
+        for (int k = 0; k < n; k++)
+            out[idx[k]] = v[k];
+    }
+}
+
+uint ChSolverParallelPDIP::Solve(ChShurProduct& ShurProduct,
+                                 ChProjectConstraints& Project,
+                                 const uint max_iter,
+                                 const uint size,
+                                 const DynamicVector<real>& b,
+                                 DynamicVector<real>& gamma) {
+    if (size == 0) {
+        return 0;
+    }
+
+    // Only rigid contacts and bilaterals can be expressed as cone constraints
+    if (size != data_manager->num_constraints ||
+        data_manager->num_constraints != data_manager->num_unilaterals + data_manager->num_bilaterals) {
+        fallback.Setup(data_manager);
+        current_iteration = fallback.Solve(ShurProduct, Project, max_iter, size, b, gamma);
+        return current_iteration;
+    }
+
+    real& residual = data_manager->measures.solver.residual;
+    real& objective_value = data_manager->measures.solver.objective_value;
+
+    data_manager->system_timer.start("ChSolverParallel_Solve");
+
+    const custom_vector<real>& cohesion = data_manager->host_data.coh_rigid_rigid;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+    const uint num_cones = 3 * num_contacts;
+    const real tolerance = data_manager->settings.solver.tol_speed;
+    const real barrier_factor = data_manager->settings.solver.pdip_barrier_factor;
+    const uint max_inner = data_manager->settings.solver.max_iteration_inner;
+
+    SetupCones();
+
+    fc.resize(num_cones);
+    lam.resize(num_cones);
+    dlam.resize(num_cones);
+    fc_new.resize(num_cones);
+    lam_new.resize(num_cones);
+    rd.resize(size);
+    rd_new.resize(size);
+    Nx.resize(size);
+    Nx_new.resize(size);
+    dx.resize(size);
+    Ndx.resize(size);
+    rhs.resize(size);
+    x_new.resize(size);
+    inv_diag.resize(size);
+
+    ComputeShurDiagonal(size, diag);
+    diag = mask * diag;
+
+    // Scale of the normal impulses, estimated from the unconstrained solution of each contact
+    real scale = 0;
+    real b_max = 0;
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        if (diag[i] > 0) {
+            scale = Max(scale, Abs(b[i]) / diag[i]);
+        }
+        b_max = Max(b_max, Abs(b[i]));
+    }
+    if (scale == 0) {
+        scale = 1;
+    }
+    if (b_max == 0) {
+        b_max = 1;
+    }
+    const real n_min = 1e-2 * scale;
+    cone_eps = 1e-2 * Sqrt((real)C_EPSILON) * scale;
+
+    // Jacobi preconditioner for the entries outside the contact blocks
+#pragma omp parallel for
+    for (int i = 0; i < (signed)size; i++) {
+        inv_diag[i] = (diag[i] > 0) ? 1 / diag[i] : 1;
+    }
+
+    // Start from the projected warm start, pushed strictly inside the cones
+    Project(gamma.data());
+    gamma = mask * gamma;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        real n = Max(gamma[i] + cohesion[i], n_min);
+        gamma[i] = n - cohesion[i];
+        for (int c = 0; c < 3; c++) {
+            int j = 3 * i + c;
+            if (cone_mu[j] == 0) {
+                continue;
+            }
+            int t0 = cone_t[2 * j + 0];
+            int t1 = cone_t[2 * j + 1];
+            real x0 = (t0 >= 0) ? gamma[t0] : 0;
+            real x1 = (t1 >= 0) ? gamma[t1] : 0;
+            real len = Sqrt(x0 * x0 + x1 * x1);
+            real target = 0.5 * cone_mu[j] * n;
+            if (Sqrt(len * len + cone_eps * cone_eps) - cone_eps > target) {
+                real factor = Sqrt((target + cone_eps) * (target + cone_eps) - cone_eps * cone_eps) / len;
+                if (t0 >= 0)
+                    gamma[t0] *= factor;
+                if (t1 >= 0)
+                    gamma[t1] *= factor;
+            }
+        }
+    }
+
+    ShurProduct(gamma, Nx);
+    Nx = mask * Nx;
+    lam = 0;
+    EvaluateCones(gamma, Nx, b, lam, fc, rd);
+
+    // Initial multipliers on a common central path point
+    const real mu_0 = b_max * n_min;
+    uint num_active = 0;
+    for (int j = 0; j < (signed)num_cones; j++) {
+        if (cone_mu[j] != 0) {
+            lam[j] = -mu_0 / fc[j];
+            num_active++;
+        }
+    }
+    EvaluateCones(gamma, Nx, b, lam, fc, rd);
+
+    // Surrogate duality gap of the current iterate
+    auto surrogate_gap = [&]() {
+        real gap = 0;
+#pragma omp parallel for reduction(+ : gap)
+        for (int j = 0; j < (signed)num_cones; j++) {
+            if (cone_mu[j] != 0)
+                gap -= fc[j] * lam[j];
+        }
+        return gap;
+    };
+
+    residual = 10e30;
+    real gap = surrogate_gap();
+
+    for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
+        // Barrier parameter
+        real t = (gap > 0) ? barrier_factor * num_active / gap : 1;
+
+        // Right hand side of the reduced Newton system: b - N x + sum_j g_j / (t f_j)
+        rhs = mask * (b - Nx);
+#pragma omp parallel for
+        for (int i = 0; i < (signed)num_contacts; i++) {
+            for (int c = 0; c < 3; c++) {
+                int j = 3 * i + c;
+                real mu = cone_mu[j];
+                if (mu == 0) {
+                    continue;
+                }
+                int t0 = cone_t[2 * j + 0];
+                int t1 = cone_t[2 * j + 1];
+                real x0 = (t0 >= 0) ? gamma[t0] : 0;
+                real x1 = (t1 >= 0) ? gamma[t1] : 0;
+                real s = Sqrt(x0 * x0 + x1 * x1 + cone_eps * cone_eps);
+                real a = 1 / (t * fc[j]);
+                rhs[i] -= a * mu;
+                if (t0 >= 0)
+                    rhs[t0] += a * x0 / s;
+                if (t1 >= 0)
+                    rhs[t1] += a * x1 / s;
+            }
+        }
+
+        FactorizeBlocks(gamma);
+
+        // Solve the reduced Newton system for the primal step
+        dx = 0;
+        SolveInnerCG(
+            [&](const DynamicVector<real>& p, DynamicVector<real>& out) {
+                temp = mask * p;
+                ShurProduct(temp, out);
+                out = mask * out + p - temp;
+                BarrierProduct(gamma, p, out);
+            },
+            [&](const DynamicVector<real>& r, DynamicVector<real>& out) { ApplyPreconditioner(r, out); },  //
+            rhs, dx, max_inner, 1e-2 * tolerance);
+        dx = mask * dx;
+
+        ShurProduct(dx, Ndx);
+        Ndx = mask * Ndx;
+
+        // Dual step: dlam_j = -lam_j - 1 / (t f_j) - lam_j g_j^T dx / f_j
+        real s_max = 1;
+#pragma omp parallel for reduction(min : s_max)
+        for (int i = 0; i < (signed)num_contacts; i++) {
+            for (int c = 0; c < 3; c++) {
+                int j = 3 * i + c;
+                real mu = cone_mu[j];
+                if (mu == 0) {
+                    dlam[j] = 0;
+                    continue;
+                }
+                int t0 = cone_t[2 * j + 0];
+                int t1 = cone_t[2 * j + 1];
+                real x0 = (t0 >= 0) ? gamma[t0] : 0;
+                real x1 = (t1 >= 0) ? gamma[t1] : 0;
+                real s = Sqrt(x0 * x0 + x1 * x1 + cone_eps * cone_eps);
+                real gdx = -mu * dx[i] + ((t0 >= 0) ? x0 / s * dx[t0] : 0) + ((t1 >= 0) ? x1 / s * dx[t1] : 0);
+                dlam[j] = -lam[j] - 1 / (t * fc[j]) - lam[j] * gdx / fc[j];
+                if (dlam[j] < 0) {
+                    s_max = Min(s_max, -lam[j] / dlam[j]);
+                }
+            }
+        }
+
+        // Backtracking line search, keeping x strictly feasible and reducing the residual
+        real res_norm = ResidualNorm(rd, fc, lam, t);
+        real step = 0.99 * s_max;
+        bool accepted = false;
+        for (int k = 0; k < 50; k++) {
+            x_new = gamma + step * dx;
+            Nx_new = Nx + step * Ndx;
+            lam_new = lam + step * dlam;
+            if (EvaluateCones(x_new, Nx_new, b, lam_new, fc_new, rd_new) &&
+                ResidualNorm(rd_new, fc_new, lam_new, t) <= (1 - 0.01 * step) * res_norm) {
+                accepted = true;
+                break;
+            }
+            step *= 0.5;
+        }
+
+        // No acceptable step: keep the current (strictly feasible) iterate and stop
+        if (!accepted) {
+            residual = Sqrt((real)(rd, rd));
+            objective_value = (gamma, 0.5 * Nx - b);
+            break;
+        }
+
+        gamma = x_new;
+        Nx = Nx_new;
+        lam = lam_new;
+        fc = fc_new;
+        rd = rd_new;
+        gap = surrogate_gap();
+
+        residual = Sqrt((real)(rd, rd));
+        objective_value = (gamma, 0.5 * Nx - b);
+
+        AtIterationEnd(residual, objective_value);
+
+        if (residual < tolerance && gap < tolerance * scale * num_active) {
+            break;
+        }
+    }
+
+    data_manager->system_timer.stop("ChSolverParallel_Solve");
+    return current_iteration;
+}
@@ -27,6 +27,7 @@
 #include "chrono_vehicle/ChVehicle.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
 #ifdef CHRONO_HAS_HDF5
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -90,7 +91,8 @@ ChVehicle::~ChVehicle() {
 void ChVehicle::SetOutput(ChVehicleOutput::Type type,
                           const std::string& out_dir,
                           const std::string& out_name,
-                          double output_step) {
+                          double output_step,
+                          bool async) {
     m_output = true;
     m_output_step = output_step;
 
@@ -107,6 +109,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
 #endif
             break;
     }
+
+    if (async && m_output_db)
+        m_output_db = new ChVehicleOutputAsync(std::unique_ptr<ChVehicleOutput>(m_output_db));
 }
 
 // -----------------------------------------------------------------------------
@@ -115,6 +120,7 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
 void ChVehicle::Advance(double step) {
     if (m_output && m_system->GetChTime() >= m_next_output_time) {
         Output(m_output_frame, *m_output_db);
+        m_output_db->EndFrame();
         m_next_output_time += m_output_step;
         m_output_frame++;
     }
@@ -128,10 +128,13 @@ class CH_VEHICLE_API ChVehicle {
     ChVector<> GetDriverPos() const { return m_chassis->GetDriverPos(); }
 
     /// Enable output for this vehicle system.
+    /// If asynchronous output is requested, output frames are serialized on a separate writer thread (see
+    /// ChVehicleOutputAsync), so that the simulation is not stalled by file I/O.
     void SetOutput(ChVehicleOutput::Type type,   ///< [int] type of output DB
                    const std::string& out_dir,   ///< [in] output directory name
                    const std::string& out_name,  ///< [in] rootname of output file
-                   double output_step            ///< [in] interval between output times
+                   double output_step,           ///< [in] interval between output times
+                   bool async = false            ///< [in] serialize output frames on a writer thread
     );
 
     /// Initialize this vehicle at the specified global location and orientation.
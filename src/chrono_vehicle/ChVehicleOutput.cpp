@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Base class for a vehicle output database.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLinkDistance.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkUniversal.h"
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+void ChVehicleOutput::Frame::Clear() {
+    blocks.Clear();
+    sections.Clear();
+    bodies.Clear();
+    auxref_bodies.Clear();
+    markers.Clear();
+    shafts.Clear();
+    joints.Clear();
+    couples.Clear();
+    lin_springs.Clear();
+    rot_springs.Clear();
+    body_loads.Clear();
+}
+
+ChVehicleOutput::ChVehicleOutput() : m_frame_open(false) {
+    m_frame.frame = 0;
+    m_frame.time = 0;
+}
+
+void ChVehicleOutput::AddBlock(Frame::Kind kind, size_t first, size_t count) {
+    Frame::Block& block = m_frame.blocks.Append();
+    block.kind = kind;
+    block.first = first;
+    block.count = count;
+}
+
+void ChVehicleOutput::WriteTime(int frame, double time) {
+    if (m_frame_open)
+        EndFrame();
+
+    m_frame.Clear();
+    m_frame.frame = frame;
+    m_frame.time = time;
+    m_frame_open = true;
+}
+
+void ChVehicleOutput::EndFrame() {
+    if (!m_frame_open)
+        return;
+
+    WriteFrame(m_frame);
+    m_frame_open = false;
+}
+
+void ChVehicleOutput::WriteSection(const std::string& name) {
+    AddBlock(Frame::Kind::SECTION, m_frame.sections.size(), 1);
+    m_frame.sections.Append() = name;
+}
+
+void ChVehicleOutput::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    AddBlock(Frame::Kind::BODIES, m_frame.bodies.size(), bodies.size());
+    for (auto body : bodies) {
+        BodyData& data = m_frame.bodies.Append();
+        data.id = body->GetIdentifier();
+        data.name = body->GetNameString();
+        data.pos = body->GetPos();
+        data.rot = body->GetRot();
+        data.pos_dt = body->GetPos_dt();
+        data.wvel = body->GetWvel_par();
+        data.pos_dtdt = body->GetPos_dtdt();
+        data.wacc = body->GetWacc_par();
+    }
+}
+
+void ChVehicleOutput::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    AddBlock(Frame::Kind::AUXREF_BODIES, m_frame.auxref_bodies.size(), bodies.size());
+    for (auto body : bodies) {
+        AuxRefBodyData& data = m_frame.auxref_bodies.Append();
+        data.id = body->GetIdentifier();
+        data.name = body->GetNameString();
+        data.pos = body->GetPos();
+        data.rot = body->GetRot();
+        data.pos_dt = body->GetPos_dt();
+        data.wvel = body->GetWvel_par();
+        data.pos_dtdt = body->GetPos_dtdt();
+        data.wacc = body->GetWacc_par();
+        data.ref_pos = body->GetFrame_REF_to_abs().GetPos();
+        data.ref_vel = body->GetFrame_REF_to_abs().GetPos_dt();
+        data.ref_acc = body->GetFrame_REF_to_abs().GetPos_dtdt();
+    }
+}
+
+void ChVehicleOutput::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    AddBlock(Frame::Kind::MARKERS, m_frame.markers.size(), markers.size());
+    for (auto marker : markers) {
+        MarkerData& data = m_frame.markers.Append();
+        data.id = marker->GetIdentifier();
+        data.name = marker->GetNameString();
+        data.pos = marker->GetAbsCoord().pos;
+        data.pos_dt = marker->GetAbsCoord_dt().pos;
+        data.pos_dtdt = marker->GetAbsCoord_dtdt().pos;
+    }
+}
+
+void ChVehicleOutput::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    AddBlock(Frame::Kind::SHAFTS, m_frame.shafts.size(), shafts.size());
+    for (auto shaft : shafts) {
+        ShaftData& data = m_frame.shafts.Append();
+        data.id = shaft->GetIdentifier();
+        data.name = shaft->GetNameString();
+        data.pos = shaft->GetPos();
+        data.pos_dt = shaft->GetPos_dt();
+        data.pos_dtdt = shaft->GetPos_dtdt();
+        data.torque = shaft->GetAppliedTorque();
+    }
+}
+
+void ChVehicleOutput::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    AddBlock(Frame::Kind::JOINTS, m_frame.joints.size(), joints.size());
+    for (auto joint : joints) {
+        JointData& data = m_frame.joints.Append();
+        data.id = joint->GetIdentifier();
+        data.name = joint->GetNameString();
+        data.force = joint->Get_react_force();
+        data.torque = joint->Get_react_torque();
+
+        data.violations.clear();
+        //// TODO: Fix this mess in Chrono
+        if (auto jnt = std::dynamic_pointer_cast<ChLinkLock>(joint)) {
+            ChVectorDynamic<> C = jnt->GetC();
+            for (int i = 0; i < C.size(); i++)
+                data.violations.push_back(C(i));
+        } else if (auto jnt = std::dynamic_pointer_cast<ChLinkUniversal>(joint)) {
+            ChVectorDynamic<> C = jnt->GetC();
+            for (int i = 0; i < C.size(); i++)
+                data.violations.push_back(C(i));
+        } else if (auto jnt = std::dynamic_pointer_cast<ChLinkDistance>(joint)) {
+            data.violations.push_back(jnt->GetCurrentDistance() - jnt->GetImposedDistance());
+        }
+    }
+}
+
+void ChVehicleOutput::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    AddBlock(Frame::Kind::COUPLES, m_frame.couples.size(), couples.size());
+    for (auto couple : couples) {
+        CoupleData& data = m_frame.couples.Append();
+        data.id = couple->GetIdentifier();
+        data.name = couple->GetNameString();
+        data.rot = couple->GetRelativeRotation();
+        data.rot_dt = couple->GetRelativeRotation_dt();
+        data.rot_dtdt = couple->GetRelativeRotation_dtdt();
+        data.torque1 = couple->GetTorqueReactionOn1();
+        data.torque2 = couple->GetTorqueReactionOn2();
+    }
+}
+
+void ChVehicleOutput::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    AddBlock(Frame::Kind::LIN_SPRINGS, m_frame.lin_springs.size(), springs.size());
+    for (auto spring : springs) {
+        LinSpringData& data = m_frame.lin_springs.Append();
+        data.id = spring->GetIdentifier();
+        data.name = spring->GetNameString();
+        data.length = spring->GetLength();
+        data.velocity = spring->GetVelocity();
+        data.force = spring->GetForce();
+    }
+}
+
+void ChVehicleOutput::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
+    AddBlock(Frame::Kind::ROT_SPRINGS, m_frame.rot_springs.size(), springs.size());
+    for (auto spring : springs) {
+        RotSpringData& data = m_frame.rot_springs.Append();
+        data.id = spring->GetIdentifier();
+        data.name = spring->GetNameString();
+        data.angle = spring->GetRotSpringAngle();
+        data.speed = spring->GetRotSpringSpeed();
+        data.torque = spring->GetRotSpringTorque();
+    }
+}
+
+void ChVehicleOutput::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    AddBlock(Frame::Kind::BODY_LOADS, m_frame.body_loads.size(), loads.size());
+    for (auto load : loads) {
+        BodyLoadData& data = m_frame.body_loads.Append();
+        data.id = load->GetIdentifier();
+        data.name = load->GetNameString();
+        data.force = load->GetForce();
+        data.torque = load->GetTorque();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -41,6 +41,9 @@ namespace vehicle {
 /// @{
 
 /// Base class for a vehicle output database.
+/// The Write functions, called by the vehicle subsystems during output, only extract the output data from the
+/// modeling components into a frame record; the frame is passed to WriteFrame, for serialization by the concrete
+/// database, when it is completed with EndFrame. See ChVehicleOutputAsync for serialization on a separate thread.
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
@@ -49,22 +52,188 @@ class CH_VEHICLE_API ChVehicleOutput {
         HDF5    ///< HDF-5
     };
 
-    ChVehicleOutput() {}
+    /// Output data for a body.
+    struct BodyData {
+        int id;                ///< body identifier
+        std::string name;      ///< body name
+        ChVector<> pos;        ///< position
+        ChQuaternion<> rot;    ///< orientation
+        ChVector<> pos_dt;     ///< linear velocity
+        ChVector<> wvel;       ///< angular velocity (absolute frame)
+        ChVector<> pos_dtdt;   ///< linear acceleration
+        ChVector<> wacc;       ///< angular acceleration (absolute frame)
+    };
+
+    /// Output data for a body with an auxiliary reference frame.
+    struct AuxRefBodyData : public BodyData {
+        ChVector<> ref_pos;   ///< reference frame position
+        ChVector<> ref_vel;   ///< reference frame linear velocity
+        ChVector<> ref_acc;   ///< reference frame linear acceleration
+    };
+
+    /// Output data for a marker.
+    struct MarkerData {
+        int id;               ///< marker identifier
+        std::string name;     ///< marker name
+        ChVector<> pos;       ///< absolute position
+        ChVector<> pos_dt;    ///< absolute linear velocity
+        ChVector<> pos_dtdt;  ///< absolute linear acceleration
+    };
+
+    /// Output data for a shaft.
+    struct ShaftData {
+        int id;             ///< shaft identifier
+        std::string name;   ///< shaft name
+        double pos;         ///< angle
+        double pos_dt;      ///< angular velocity
+        double pos_dtdt;    ///< angular acceleration
+        double torque;      ///< applied torque
+    };
+
+    /// Output data for a joint.
+    struct JointData {
+        int id;                          ///< joint identifier
+        std::string name;                ///< joint name
+        ChVector<> force;                ///< reaction force
+        ChVector<> torque;               ///< reaction torque
+        std::vector<double> violations;  ///< constraint violations (if available)
+    };
+
+    /// Output data for a shaft couple.
+    struct CoupleData {
+        int id;             ///< couple identifier
+        std::string name;   ///< couple name
+        double rot;         ///< relative angle
+        double rot_dt;      ///< relative angular velocity
+        double rot_dtdt;    ///< relative angular acceleration
+        double torque1;     ///< reaction torque on shaft 1
+        double torque2;     ///< reaction torque on shaft 2
+    };
+
+    /// Output data for a translational spring-damper.
+    struct LinSpringData {
+        int id;             ///< spring identifier
+        std::string name;   ///< spring name
+        double length;      ///< current length
+        double velocity;    ///< current velocity
+        double force;       ///< reaction force
+    };
+
+    /// Output data for a rotational spring-damper.
+    struct RotSpringData {
+        int id;             ///< spring identifier
+        std::string name;   ///< spring name
+        double angle;       ///< current angle
+        double speed;       ///< current angular velocity
+        double torque;      ///< reaction torque
+    };
+
+    /// Output data for a body-body load.
+    struct BodyLoadData {
+        int id;             ///< load identifier
+        std::string name;   ///< load name
+        ChVector<> force;   ///< load force
+        ChVector<> torque;  ///< load torque
+    };
+
+    /// List of output records which keeps its storage (including that of the record strings and vectors) when
+    /// cleared, so that filling it again for the next frame does not allocate memory.
+    template <typename T>
+    class RecordList {
+      public:
+        RecordList() : m_size(0) {}
+
+        size_t size() const { return m_size; }
+        const T& operator[](size_t i) const { return m_data[i]; }
+
+        /// Append a record to the list and return it (possibly holding stale data, to be overwritten).
+        T& Append() {
+            if (m_size == m_data.size())
+                m_data.emplace_back();
+            return m_data[m_size++];
+        }
+
+        void Clear() { m_size = 0; }
+
+      private:
+        std::vector<T> m_data;
+        size_t m_size;
+    };
+
+    /// Output data for one frame.
+    /// The records are stored by type; the blocks describe the order in which they were written.
+    struct Frame {
+        /// Type of the records in a block.
+        enum class Kind {
+            SECTION,
+            BODIES,
+            AUXREF_BODIES,
+            MARKERS,
+            SHAFTS,
+            JOINTS,
+            COUPLES,
+            LIN_SPRINGS,
+            ROT_SPRINGS,
+            BODY_LOADS
+        };
+
+        /// Range of consecutive records of a given type (for a SECTION, the index of the section name).
+        struct Block {
+            Kind kind;
+            size_t first;
+            size_t count;
+        };
+
+        int frame;    ///< frame number
+        double time;  ///< simulation time
+
+        RecordList<Block> blocks;
+        RecordList<std::string> sections;
+        RecordList<BodyData> bodies;
+        RecordList<AuxRefBodyData> auxref_bodies;
+        RecordList<MarkerData> markers;
+        RecordList<ShaftData> shafts;
+        RecordList<JointData> joints;
+        RecordList<CoupleData> couples;
+        RecordList<LinSpringData> lin_springs;
+        RecordList<RotSpringData> rot_springs;
+        RecordList<BodyLoadData> body_loads;
+
+        /// Remove all records (the storage is retained).
+        void Clear();
+    };
+
+    ChVehicleOutput();
     virtual ~ChVehicleOutput() {}
 
-    virtual void WriteTime(int frame, double time) = 0;
+    /// Start a new output frame (completing the current frame, if necessary).
+    void WriteTime(int frame, double time);
+
+    /// Start a new section in the current frame.
+    void WriteSection(const std::string& name);
+
+    void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+    void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies);
+    void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers);
+    void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts);
+    void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints);
+    void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples);
+    void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs);
+    void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs);
+    void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads);
+
+    /// Complete the current output frame and pass it to WriteFrame.
+    void EndFrame();
+
+    /// Serialize a complete output frame.
+    virtual void WriteFrame(const Frame& frame) = 0;
 
-    virtual void WriteSection(const std::string& name) = 0;
+  private:
+    /// Append a block of records of the given type to the current frame.
+    void AddBlock(Frame::Kind kind, size_t first, size_t count);
 
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) = 0;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) = 0;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) = 0;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) = 0;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) = 0;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) = 0;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) = 0;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) = 0;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) = 0;
+    Frame m_frame;      ///< current output frame
+    bool m_frame_open;  ///< true if a frame was started and not yet completed
 };
 
 /// @} vehicle
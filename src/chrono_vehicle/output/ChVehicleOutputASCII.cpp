@@ -18,10 +18,6 @@
 
 #include <iostream>
 
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
-#include "chrono/physics/ChLinkDistance.h"
-
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
 
 namespace chrono {
@@ -35,84 +31,101 @@ ChVehicleOutputASCII::~ChVehicleOutputASCII() {
     m_stream.close();
 }
 
-void ChVehicleOutputASCII::WriteTime(int frame, double time) {
+void ChVehicleOutputASCII::WriteFrame(const Frame& frame) {
     m_stream << "=====================================\n";
-    m_stream << "Time: " << time << std::endl;
-}
-
-void ChVehicleOutputASCII::WriteSection(const std::string& name) {
-    m_stream << "  \"" << name << "\"" << std::endl;
+    m_stream << "Time: " << frame.time << std::endl;
+
+    for (size_t ib = 0; ib < frame.blocks.size(); ib++) {
+        const Frame::Block& block = frame.blocks[ib];
+        switch (block.kind) {
+            case Frame::Kind::SECTION:
+                m_stream << "  \"" << frame.sections[block.first] << "\"" << std::endl;
+                break;
+            case Frame::Kind::BODIES:
+                WriteBodyRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::AUXREF_BODIES:
+                WriteAuxRefBodyRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::MARKERS:
+                WriteMarkerRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::SHAFTS:
+                WriteShaftRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::JOINTS:
+                WriteJointRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::COUPLES:
+                WriteCoupleRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::LIN_SPRINGS:
+                WriteLinSpringRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::ROT_SPRINGS:
+                WriteRotSpringRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::BODY_LOADS:
+                WriteBodyLoadRecords(frame, block.first, block.count);
+                break;
+        }
+    }
 }
 
-void ChVehicleOutputASCII::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    for (auto body : bodies) {
-        m_stream << "    body: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
-        m_stream << body->GetPos_dtdt() << " " << body->GetWacc_par() << " ";
+void ChVehicleOutputASCII::WriteBodyRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const BodyData& body = frame.bodies[i];
+        m_stream << "    body: " << body.id << " \"" << body.name << "\" ";
+        m_stream << body.pos << " " << body.rot << " ";
+        m_stream << body.pos_dt << " " << body.wvel << " ";
+        m_stream << body.pos_dtdt << " " << body.wacc << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    for (auto body : bodies) {
-        auto& ref_pos = body->GetFrame_REF_to_abs().GetPos();
-        auto& ref_vel = body->GetFrame_REF_to_abs().GetPos_dt();
-        auto& ref_acc = body->GetFrame_REF_to_abs().GetPos_dtdt();
-
-        m_stream << "    body auxref: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
-        m_stream << body->GetPos_dtdt() << " " << body->GetWacc_par() << " ";
-        m_stream << ref_pos << " " << ref_vel << " " << ref_acc << " ";
+void ChVehicleOutputASCII::WriteAuxRefBodyRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const AuxRefBodyData& body = frame.auxref_bodies[i];
+        m_stream << "    body auxref: " << body.id << " \"" << body.name << "\" ";
+        m_stream << body.pos << " " << body.rot << " ";
+        m_stream << body.pos_dt << " " << body.wvel << " ";
+        m_stream << body.pos_dtdt << " " << body.wacc << " ";
+        m_stream << body.ref_pos << " " << body.ref_vel << " " << body.ref_acc << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    for (auto marker : markers) {
-        m_stream << "    marker: " << marker->GetIdentifier() << " \"" << marker->GetNameString() << "\" ";
-        m_stream << marker->GetAbsCoord().pos << " ";
-        m_stream << marker->GetAbsCoord_dt().pos << " ";
-        m_stream << marker->GetAbsCoord_dtdt().pos << " ";
+void ChVehicleOutputASCII::WriteMarkerRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const MarkerData& marker = frame.markers[i];
+        m_stream << "    marker: " << marker.id << " \"" << marker.name << "\" ";
+        m_stream << marker.pos << " ";
+        m_stream << marker.pos_dt << " ";
+        m_stream << marker.pos_dtdt << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    for (auto shaft : shafts) {
-        m_stream << "    shaft: " << shaft->GetIdentifier() << " \"" << shaft->GetNameString() << "\" ";
-        m_stream << shaft->GetPos() << " " << shaft->GetPos_dt() << " " << shaft->GetPos_dtdt() << " ";
-        m_stream << shaft->GetAppliedTorque() << " ";
+void ChVehicleOutputASCII::WriteShaftRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const ShaftData& shaft = frame.shafts[i];
+        m_stream << "    shaft: " << shaft.id << " \"" << shaft.name << "\" ";
+        m_stream << shaft.pos << " " << shaft.pos_dt << " " << shaft.pos_dtdt << " ";
+        m_stream << shaft.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
-    for (auto joint : joints) {
-        std::vector<double> violations;
-        //// TODO: Fix this mess in Chrono
-        if (auto jnt = std::dynamic_pointer_cast<ChLinkLock>(joint)) {
-            ChVectorDynamic<> C = jnt->GetC();
-            for (int i = 0; i < C.size(); i++)
-                violations.push_back(C(i));
-        }
-        else if (auto jnt = std::dynamic_pointer_cast<ChLinkUniversal>(joint)) {
-            ChVectorDynamic<> C = jnt->GetC();
-            for (int i = 0; i < C.size(); i++)
-                violations.push_back(C(i));
-        }
-        else if (auto jnt = std::dynamic_pointer_cast<ChLinkDistance>(joint)) {
-            violations.push_back(jnt->GetCurrentDistance() - jnt->GetImposedDistance());
-        }
-
-        m_stream << "    joint: " << joint->GetIdentifier() << " \"" << joint->GetNameString() << "\" ";
-        m_stream << joint->Get_react_force() << " " << joint->Get_react_torque() << " ";
-        for (auto val : violations) {
+void ChVehicleOutputASCII::WriteJointRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const JointData& joint = frame.joints[i];
+        m_stream << "    joint: " << joint.id << " \"" << joint.name << "\" ";
+        m_stream << joint.force << " " << joint.torque << " ";
+        for (auto val : joint.violations) {
             m_stream << val << " ";
         }
         m_stream << std::endl;
@@ -120,41 +133,44 @@ void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>
     }
 }
 
-void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    for (auto couple : couples) {
-        m_stream << "    couple: " << couple->GetIdentifier() << " \"" << couple->GetNameString() << "\" ";
-        m_stream << couple->GetRelativeRotation() << " " << couple->GetRelativeRotation_dt() << " "
-                 << couple->GetRelativeRotation_dtdt() << " ";
-        m_stream << couple->GetTorqueReactionOn1() << " " << couple->GetTorqueReactionOn2() << " ";
+void ChVehicleOutputASCII::WriteCoupleRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const CoupleData& couple = frame.couples[i];
+        m_stream << "    couple: " << couple.id << " \"" << couple.name << "\" ";
+        m_stream << couple.rot << " " << couple.rot_dt << " " << couple.rot_dtdt << " ";
+        m_stream << couple.torque1 << " " << couple.torque2 << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    lin spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
-        m_stream << spring->GetLength() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetForce() << " ";
+void ChVehicleOutputASCII::WriteLinSpringRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const LinSpringData& spring = frame.lin_springs[i];
+        m_stream << "    lin spring: " << spring.id << " \"" << spring.name << "\" ";
+        m_stream << spring.length << " " << spring.velocity << " ";
+        m_stream << spring.force << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    rot spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
-        m_stream << spring->GetRotSpringAngle() << " " << spring->GetRotSpringSpeed() << " ";
-        m_stream << spring->GetRotSpringTorque() << " ";
+void ChVehicleOutputASCII::WriteRotSpringRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const RotSpringData& spring = frame.rot_springs[i];
+        m_stream << "    rot spring: " << spring.id << " \"" << spring.name << "\" ";
+        m_stream << spring.angle << " " << spring.speed << " ";
+        m_stream << spring.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    for (auto load : loads) {
-        m_stream << "    body-body load: " << load->GetIdentifier() << " \"" << load->GetNameString() << "\" ";
-        m_stream << load->GetForce() << " " << load->GetTorque() << " ";
+void ChVehicleOutputASCII::WriteBodyLoadRecords(const Frame& frame, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+        const BodyLoadData& load = frame.body_loads[i];
+        m_stream << "    body-body load: " << load.id << " \"" << load.name << "\" ";
+        m_stream << load.force << " " << load.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
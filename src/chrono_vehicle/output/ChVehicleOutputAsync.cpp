@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Asynchronous vehicle output database, serializing output frames on a
+// background writer thread.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputAsync::ChVehicleOutputAsync(std::unique_ptr<ChVehicleOutput> database, int num_buffers)
+    : m_database(std::move(database)),
+      m_buffers(std::max(num_buffers, 1)),
+      m_first(0),
+      m_pending(0),
+      m_stop(false),
+      m_num_stalls(0) {
+    m_thread = std::thread(&ChVehicleOutputAsync::WriterLoop, this);
+}
+
+ChVehicleOutputAsync::~ChVehicleOutputAsync() {
+    // A writer error cannot be reported from the destructor; pending frames are discarded in that case
+    try {
+        EndFrame();
+    } catch (...) {
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_pending.notify_one();
+    m_thread.join();
+}
+
+void ChVehicleOutputAsync::WriteFrame(const Frame& frame) {
+    size_t slot;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_error)
+            std::rethrow_exception(m_error);
+        if (m_pending == m_buffers.size()) {
+            m_num_stalls++;
+            m_cv_free.wait(lock, [this]() { return m_pending < m_buffers.size(); });
+        }
+        slot = (m_first + m_pending) % m_buffers.size();
+    }
+
+    // The free slot is not accessed by the writer thread until the frame is queued
+    m_buffers[slot] = frame;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending++;
+    }
+    m_cv_pending.notify_one();
+}
+
+void ChVehicleOutputAsync::Flush() {
+    EndFrame();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_free.wait(lock, [this]() { return m_pending == 0; });
+    if (m_error)
+        std::rethrow_exception(m_error);
+}
+
+void ChVehicleOutputAsync::WriterLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv_pending.wait(lock, [this]() { return m_pending > 0 || m_stop; });
+        if (m_pending == 0)
+            break;
+
+        // Serialize the oldest pending frame; its slot is not reused until it is released below
+        // After a writer error, the remaining frames are discarded
+        if (!m_error) {
+            const Frame& frame = m_buffers[m_first];
+            std::exception_ptr error;
+            lock.unlock();
+            try {
+                m_database->WriteFrame(frame);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error)
+                m_error = error;
+        }
+
+        m_first = (m_first + 1) % m_buffers.size();
+        m_pending--;
+        m_cv_free.notify_all();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
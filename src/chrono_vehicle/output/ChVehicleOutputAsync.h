@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Asynchronous vehicle output database, serializing output frames on a
+// background writer thread.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_ASYNC_H
+#define CH_VEHICLE_OUTPUT_ASYNC_H
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Asynchronous vehicle output database.
+/// Output frames are serialized by the wrapped database (e.g., ChVehicleOutputASCII or ChVehicleOutputHDF5) on a
+/// background writer thread, so that file I/O and formatting do not stall the simulation. A completed frame is copied
+/// into a ring of frame buffers, whose storage is reused from one frame to the next. If the writer falls behind and
+/// all buffers hold pending frames, the simulation waits for a buffer to be released.
+class CH_VEHICLE_API ChVehicleOutputAsync : public ChVehicleOutput {
+  public:
+    /// Construct an asynchronous output database which takes ownership of the given database.
+    ChVehicleOutputAsync(std::unique_ptr<ChVehicleOutput> database,  ///< [in] database used to serialize frames
+                         int num_buffers = 4                         ///< [in] number of frame buffers
+    );
+
+    /// Write all pending frames and stop the writer thread.
+    ~ChVehicleOutputAsync();
+
+    /// Wait until all pending frames have been written.
+    /// An exception thrown by the wrapped database on the writer thread is rethrown here.
+    void Flush();
+
+    /// Return the number of frames for which the simulation had to wait for a free buffer.
+    int GetNumStalls() const { return m_num_stalls; }
+
+    /// Queue a complete output frame for serialization on the writer thread.
+    /// An exception thrown by the wrapped database on the writer thread is rethrown here.
+    virtual void WriteFrame(const Frame& frame) override;
+
+  private:
+    void WriterLoop();
+
+    std::unique_ptr<ChVehicleOutput> m_database;  ///< database used to serialize frames
+    std::vector<Frame> m_buffers;                 ///< ring of frame buffers
+    size_t m_first;                               ///< index of the oldest pending frame
+    size_t m_pending;                             ///< number of pending frames
+    bool m_stop;                                  ///< request for the writer thread to exit
+    int m_num_stalls;                             ///< number of frames that waited for a free buffer
+    std::exception_ptr m_error;                   ///< exception thrown on the writer thread
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv_pending;  ///< signaled when a frame is queued (or at exit)
+    std::condition_variable m_cv_free;     ///< signaled when a frame is written
+    std::thread m_thread;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -21,9 +21,6 @@
 #include <sstream>
 #include <fstream>
 
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
-
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 
 namespace chrono {
@@ -317,6 +314,48 @@ std::string format_number(int num, int precision) {
 
 // -----------------------------------------------------------------------------
 
+void ChVehicleOutputHDF5::WriteFrame(const Frame& frame) {
+    WriteTime(frame.frame, frame.time);
+
+    for (size_t ib = 0; ib < frame.blocks.size(); ib++) {
+        const Frame::Block& block = frame.blocks[ib];
+        if (block.kind != Frame::Kind::SECTION && block.count == 0)
+            continue;
+        switch (block.kind) {
+            case Frame::Kind::SECTION:
+                WriteSection(frame.sections[block.first]);
+                break;
+            case Frame::Kind::BODIES:
+                WriteBodyRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::AUXREF_BODIES:
+                WriteAuxRefBodyRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::MARKERS:
+                WriteMarkerRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::SHAFTS:
+                WriteShaftRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::JOINTS:
+                WriteJointRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::COUPLES:
+                WriteCoupleRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::LIN_SPRINGS:
+                WriteLinSpringRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::ROT_SPRINGS:
+                WriteRotSpringRecords(frame, block.first, block.count);
+                break;
+            case Frame::Kind::BODY_LOADS:
+                WriteBodyLoadRecords(frame, block.first, block.count);
+                break;
+        }
+    }
+}
+
 void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
     // Close the currently open section group
     if (m_section_group) {
@@ -357,160 +396,128 @@ void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
     m_section_group = new H5::Group(m_frame_group->createGroup(name));
 }
 
-void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    if (bodies.empty())
-        return;
-
-    auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
+void ChVehicleOutputHDF5::WriteBodyRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<body_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector<>& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+    std::vector<body_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const BodyData& body = frame.bodies[first + i];
+        const ChVector<>& p = body.pos;
+        const ChQuaternion<>& q = body.rot;
+        info[i] = {body.id, p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
     set.write(info.data(), getBodyType());
 }
 
-void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    if (bodies.empty())
-        return;
-
-    auto nbodies = bodies.size();
-    hsize_t dim[] = { nbodies };
+void ChVehicleOutputHDF5::WriteAuxRefBodyRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<bodyaux_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector<>& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = { bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3() };
+    std::vector<bodyaux_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const AuxRefBodyData& body = frame.auxref_bodies[first + i];
+        const ChVector<>& p = body.pos;
+        const ChQuaternion<>& q = body.rot;
+        info[i] = {body.id, p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
     set.write(info.data(), getBodyAuxType());
 }
 
-void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    if (markers.empty())
-        return;
-
-    auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
+void ChVehicleOutputHDF5::WriteMarkerRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<marker_info> info(nmarkers);
-    for (auto i = 0; i < nmarkers; i++) {
-        const ChVector<>& p = markers[i]->GetAbsCoord().pos;
-        const ChVector<>& pd = markers[i]->GetAbsCoord_dt().pos;
-        const ChVector<>& pdd = markers[i]->GetAbsCoord_dtdt().pos;
-        info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
+    std::vector<marker_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const MarkerData& marker = frame.markers[first + i];
+        const ChVector<>& p = marker.pos;
+        const ChVector<>& pd = marker.pos_dt;
+        const ChVector<>& pdd = marker.pos_dtdt;
+        info[i] = {marker.id, p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
     set.write(info.data(), getMarkerType());
 }
 
-void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    if (shafts.empty())
-        return;
-
-    auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
+void ChVehicleOutputHDF5::WriteShaftRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<shaft_info> info(nshafts);
-    for (auto i = 0; i < nshafts; i++) {
-        info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(),
-                   shafts[i]->GetAppliedTorque()};
+    std::vector<shaft_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const ShaftData& shaft = frame.shafts[first + i];
+        info[i] = {shaft.id, shaft.pos, shaft.pos_dt, shaft.pos_dtdt, shaft.torque};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
     set.write(info.data(), getShaftType());
 }
 
-void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
-    if (joints.empty())
-        return;
-
-    auto njoints = joints.size();
-    hsize_t dim[] = { njoints };
+void ChVehicleOutputHDF5::WriteJointRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<joint_info> info(njoints);
-    for (auto i = 0; i < njoints; i++) {
-        const ChVector<>& f = joints[i]->Get_react_force();
-        const ChVector<>& t = joints[i]->Get_react_torque();
-        info[i] = { joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
+    std::vector<joint_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const JointData& joint = frame.joints[first + i];
+        const ChVector<>& f = joint.force;
+        const ChVector<>& t = joint.torque;
+        info[i] = {joint.id, f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
     set.write(info.data(), getJointType());
 }
 
-void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    if (couples.empty())
-        return;
-
-    auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
+void ChVehicleOutputHDF5::WriteCoupleRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<couple_info> info(ncouples);
-    for (auto i = 0; i < ncouples; i++) {
-        info[i] = {couples[i]->GetIdentifier(),          couples[i]->GetRelativeRotation(),
-                   couples[i]->GetRelativeRotation_dt(), couples[i]->GetRelativeRotation_dtdt(),
-                   couples[i]->GetTorqueReactionOn1(),   couples[i]->GetTorqueReactionOn2()};
+    std::vector<couple_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const CoupleData& couple = frame.couples[first + i];
+        info[i] = {couple.id, couple.rot, couple.rot_dt, couple.rot_dtdt, couple.torque1, couple.torque2};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
     set.write(info.data(), getCoupleType());
 }
 
-void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    if (springs.empty())
-        return;
-
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
+void ChVehicleOutputHDF5::WriteLinSpringRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<linspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
-                   springs[i]->GetForce()};
+    std::vector<linspring_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const LinSpringData& spring = frame.lin_springs[first + i];
+        info[i] = {spring.id, spring.length, spring.velocity, spring.force};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
     set.write(info.data(), getLinSpringType());
 }
 
-void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
-    if (springs.empty())
-        return;
-
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
+void ChVehicleOutputHDF5::WriteRotSpringRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<rotspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetRotSpringAngle(), springs[i]->GetRotSpringSpeed(),
-                   springs[i]->GetRotSpringTorque()};
+    std::vector<rotspring_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const RotSpringData& spring = frame.rot_springs[first + i];
+        info[i] = {spring.id, spring.angle, spring.speed, spring.torque};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
     set.write(info.data(), getRotSpringType());
 }
 
-void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    if (loads.empty())
-        return;
-
-    auto nloads = loads.size();
-    hsize_t dim[] = { nloads };
+void ChVehicleOutputHDF5::WriteBodyLoadRecords(const Frame& frame, size_t first, size_t count) {
+    hsize_t dim[] = {count};
     H5::DataSpace dataspace(1, dim);
-    std::vector<bodyload_info> info(nloads);
-    for (auto i = 0; i < nloads; i++) {
-        ChVector<> f = loads[i]->GetForce();
-        ChVector<> t = loads[i]->GetTorque();
-        info[i] = { loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
+    std::vector<bodyload_info> info(count);
+    for (size_t i = 0; i < count; i++) {
+        const BodyLoadData& load = frame.body_loads[first + i];
+        const ChVector<>& f = load.force;
+        const ChVector<>& t = load.torque;
+        info[i] = {load.id, f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
     }
 
     H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
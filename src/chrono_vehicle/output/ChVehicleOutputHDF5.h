@@ -38,19 +38,22 @@ class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
     ChVehicleOutputHDF5(const std::string& filename);
     ~ChVehicleOutputHDF5();
 
+    /// Serialize a complete output frame.
+    virtual void WriteFrame(const Frame& frame) override;
+
   private:
-    virtual void WriteTime(int frame, double time) override;
-    virtual void WriteSection(const std::string& name) override;
-
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    void WriteTime(int frame, double time);
+    void WriteSection(const std::string& name);
+
+    void WriteBodyRecords(const Frame& frame, size_t first, size_t count);
+    void WriteAuxRefBodyRecords(const Frame& frame, size_t first, size_t count);
+    void WriteMarkerRecords(const Frame& frame, size_t first, size_t count);
+    void WriteShaftRecords(const Frame& frame, size_t first, size_t count);
+    void WriteJointRecords(const Frame& frame, size_t first, size_t count);
+    void WriteCoupleRecords(const Frame& frame, size_t first, size_t count);
+    void WriteLinSpringRecords(const Frame& frame, size_t first, size_t count);
+    void WriteRotSpringRecords(const Frame& frame, size_t first, size_t count);
+    void WriteBodyLoadRecords(const Frame& frame, size_t first, size_t count);
 
     H5::H5File* m_fileHDF5;
     H5::Group* m_frame_group;
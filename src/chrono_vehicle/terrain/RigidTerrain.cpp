@@ -49,6 +49,8 @@ RigidTerrain::RigidTerrain(ChSystem* system)
       m_num_patches(0),
       m_collision_family(14),
       m_use_friction_functor(false),
+      m_use_mesh_grid(false),
+      m_mesh_grid_cell(0),
       m_contact_callback(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -59,6 +61,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
       m_num_patches(0),
       m_collision_family(14),
       m_use_friction_functor(false),
+      m_use_mesh_grid(false),
+      m_mesh_grid_cell(0),
       m_contact_callback(nullptr) {
     // Open and parse the input file
     Document d = ReadFileJSON(filename);
@@ -235,8 +239,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     AddPatch(patch, position, material);
 
     // Load mesh from file
-    patch->m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-    patch->m_trimesh->LoadWavefrontMesh(mesh_file, true, true);
+    patch->m_trimesh = geometry::ChTriangleMeshConnected::LoadShared(mesh_file, true, true);
 
     // Create the collision model
     patch->m_body->GetCollisionModel()->ClearModel();
@@ -497,6 +500,13 @@ void RigidTerrain::Initialize() {
         }
     }
 
+    if (m_use_mesh_grid) {
+        for (auto patch : m_patches) {
+            if (auto mesh_patch = std::dynamic_pointer_cast<MeshPatch>(patch))
+                mesh_patch->BuildQueryGrid(m_mesh_grid_cell);
+        }
+    }
+
     if (!m_friction_fun)
         m_use_friction_functor = false;
     if (!m_use_friction_functor)
@@ -587,6 +597,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (!m_grid_start.empty())
+        return FindPointGrid(loc, height, normal);
+
     ChVector<> from = loc + (m_radius + 1000) * ChWorldFrame::Vertical();
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -598,6 +611,149 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Query grid for mesh patches.
+// The mesh triangles (in the ISO world frame) are binned, based on their horizontal bounding box, in a uniform grid
+// stored in compressed form (m_grid_start, m_grid_faces). A vertical query then only intersects the triangles of the
+// cell containing the query point.
+// -----------------------------------------------------------------------------
+void RigidTerrain::MeshPatch::BuildQueryGrid(double cell_size) {
+    const auto& vertices = m_trimesh->getCoordsVertices();
+    const auto& faces = m_trimesh->getIndicesVertexes();
+    if (faces.empty())
+        return;
+
+    m_grid_vertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        m_grid_vertices[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+
+    // Horizontal extent of the mesh and average horizontal triangle size
+    double x_min = std::numeric_limits<double>::max();
+    double y_min = std::numeric_limits<double>::max();
+    double x_max = std::numeric_limits<double>::lowest();
+    double y_max = std::numeric_limits<double>::lowest();
+    double avg_size = 0;
+    for (const auto& f : faces) {
+        const auto& a = m_grid_vertices[f[0]];
+        const auto& b = m_grid_vertices[f[1]];
+        const auto& c = m_grid_vertices[f[2]];
+        double fx_min = std::min({a.x(), b.x(), c.x()});
+        double fx_max = std::max({a.x(), b.x(), c.x()});
+        double fy_min = std::min({a.y(), b.y(), c.y()});
+        double fy_max = std::max({a.y(), b.y(), c.y()});
+        x_min = std::min(x_min, fx_min);
+        x_max = std::max(x_max, fx_max);
+        y_min = std::min(y_min, fy_min);
+        y_max = std::max(y_max, fy_max);
+        avg_size += std::max(fx_max - fx_min, fy_max - fy_min);
+    }
+    avg_size /= faces.size();
+
+    // Grid dimensions (limit the number of cells to a small multiple of the number of faces)
+    double lx = std::max(x_max - x_min, 1e-6);
+    double ly = std::max(y_max - y_min, 1e-6);
+    if (cell_size <= 0)
+        cell_size = std::max(avg_size, 1e-6);
+    double max_cells = 4.0 * faces.size() + 1;
+    if ((lx / cell_size) * (ly / cell_size) > max_cells)
+        cell_size = std::sqrt(lx * ly / max_cells);
+    m_grid_x0 = x_min;
+    m_grid_y0 = y_min;
+    m_grid_cell = cell_size;
+    m_grid_nx = std::max(1, (int)std::ceil(lx / cell_size));
+    m_grid_ny = std::max(1, (int)std::ceil(ly / cell_size));
+
+    // Range of cells overlapped by the horizontal bounding box of a face
+    auto cell_range = [this](const ChVector<>& a, const ChVector<>& b, const ChVector<>& c, int& ix1, int& ix2,
+                             int& iy1, int& iy2) {
+        ix1 = std::max(0, (int)std::floor((std::min({a.x(), b.x(), c.x()}) - m_grid_x0) / m_grid_cell));
+        ix2 = std::min(m_grid_nx - 1, (int)std::floor((std::max({a.x(), b.x(), c.x()}) - m_grid_x0) / m_grid_cell));
+        iy1 = std::max(0, (int)std::floor((std::min({a.y(), b.y(), c.y()}) - m_grid_y0) / m_grid_cell));
+        iy2 = std::min(m_grid_ny - 1, (int)std::floor((std::max({a.y(), b.y(), c.y()}) - m_grid_y0) / m_grid_cell));
+    };
+
+    // Count the faces overlapping each cell, then fill the cells
+    int ix1, ix2, iy1, iy2;
+    std::vector<int> count(m_grid_nx * m_grid_ny + 1, 0);
+    for (const auto& f : faces) {
+        cell_range(m_grid_vertices[f[0]], m_grid_vertices[f[1]], m_grid_vertices[f[2]], ix1, ix2, iy1, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                count[iy * m_grid_nx + ix + 1]++;
+    }
+    for (size_t i = 1; i < count.size(); i++)
+        count[i] += count[i - 1];
+    m_grid_start = count;
+
+    m_grid_faces.resize(count.back());
+    for (int i = 0; i < (int)faces.size(); i++) {
+        const auto& f = faces[i];
+        cell_range(m_grid_vertices[f[0]], m_grid_vertices[f[1]], m_grid_vertices[f[2]], ix1, ix2, iy1, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                m_grid_faces[count[iy * m_grid_nx + ix]++] = i;
+    }
+}
+
+bool RigidTerrain::MeshPatch::FindPointGrid(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    ChVector<> p = ChWorldFrame::ToISO(loc);
+    height = 0;
+    normal = ChWorldFrame::Vertical();
+
+    // Locate the grid cell (a point on the far grid boundary is assigned to the last cell)
+    double sx = (p.x() - m_grid_x0) / m_grid_cell;
+    double sy = (p.y() - m_grid_y0) / m_grid_cell;
+    if (sx < 0 || sy < 0 || sx > m_grid_nx || sy > m_grid_ny)
+        return false;
+    int ix = std::min((int)sx, m_grid_nx - 1);
+    int iy = std::min((int)sy, m_grid_ny - 1);
+    int cell = iy * m_grid_nx + ix;
+
+    // Same vertical extent as the ray used in FindPoint
+    double z_max = p.z() + m_radius + 1000;
+    double z_min = p.z() - m_radius - 1000;
+
+    const auto& faces = m_trimesh->getIndicesVertexes();
+    bool hit = false;
+    ChVector<> n;
+    for (int k = m_grid_start[cell]; k < m_grid_start[cell + 1]; k++) {
+        const auto& f = faces[m_grid_faces[k]];
+        const auto& a = m_grid_vertices[f[0]];
+        const auto& b = m_grid_vertices[f[1]];
+        const auto& c = m_grid_vertices[f[2]];
+
+        // Barycentric coordinates of the query point in the horizontal projection of the triangle
+        double det = (b.y() - c.y()) * (a.x() - c.x()) + (c.x() - b.x()) * (a.y() - c.y());
+        if (std::abs(det) < 1e-14)
+            continue;  // vertical (or degenerate) triangle
+        double w1 = ((b.y() - c.y()) * (p.x() - c.x()) + (c.x() - b.x()) * (p.y() - c.y())) / det;
+        double w2 = ((c.y() - a.y()) * (p.x() - c.x()) + (a.x() - c.x()) * (p.y() - c.y())) / det;
+        double w3 = 1 - w1 - w2;
+        const double eps = 1e-10;
+        if (w1 < -eps || w2 < -eps || w3 < -eps)
+            continue;
+
+        // Keep the highest intersection (the first one hit by a downward ray)
+        double z = w1 * a.z() + w2 * b.z() + w3 * c.z();
+        if (z > z_max || z < z_min || (hit && z <= height))
+            continue;
+        hit = true;
+        height = z;
+        n = Vcross(b - a, c - a);
+    }
+
+    if (!hit)
+        return false;
+
+    // Report the face normal, oriented upward
+    n.Normalize();
+    if (n.z() < 0)
+        n = -n;
+    normal = ChWorldFrame::FromISO(n);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
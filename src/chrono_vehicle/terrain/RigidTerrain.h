@@ -156,6 +156,18 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// By default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of a precomputed grid to accelerate height, normal, and friction queries on mesh patches.
+    /// If enabled, the triangles of each mesh (or height-map) patch are binned in a uniform grid over the horizontal
+    /// plane and vertical queries are answered by intersecting only the triangles in one grid cell, instead of casting
+    /// a ray into the patch collision model. Queries are then answered on the exact mesh surface (a ray cast into the
+    /// collision model reports points offset by up to the collision margin). The grid cell size is computed from the
+    /// average triangle size, unless explicitly provided.
+    /// By default, this option is disabled.  This function must be called before Initialize.
+    void UseMeshQueryGrid(bool val, double cell_size = 0) {
+        m_use_mesh_grid = val;
+        m_mesh_grid_cell = cell_size;
+    }
+
     /// Get the terrain coefficient of friction at the point below the specified location.
     /// For RigidTerrain, this function defers to the user-provided functor object of type
     /// ChTerrain::FrictionFunctor, if one was specified. Otherwise, it returns the constant
@@ -173,7 +185,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void ExportMeshWavefront(const std::string& out_dir);
 
     /// Find the terrain height, normal, and coefficient of friction at the point below the specified location.
-    /// The point on the terrain surface is obtained through ray casting into the terrain contact model.
+    /// The point on the terrain surface is obtained through ray casting into the terrain contact model (or using the
+    /// mesh query grid, see UseMeshQueryGrid).
     /// The return value is 'true' if the ray intersection succeeded and 'false' otherwise (in which case
     /// the output is set to heigh=0, normal=[0,0,1], and friction=0.8).
     bool FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const;
@@ -199,12 +212,29 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+
+        /// Bin the mesh triangles in a uniform grid over the horizontal plane (cell_size = 0: automatic size).
+        void BuildQueryGrid(double cell_size);
+
+        /// Find the highest mesh point on the vertical through the specified location, using the query grid.
+        bool FindPointGrid(const ChVector<>& loc, double& height, ChVector<>& normal) const;
+
+        std::vector<ChVector<>> m_grid_vertices;  ///< mesh vertices, in the ISO world frame
+        std::vector<int> m_grid_start;            ///< start of each cell in m_grid_faces (size nx * ny + 1)
+        std::vector<int> m_grid_faces;            ///< indices of the faces overlapping each grid cell
+        double m_grid_x0;                         ///< grid origin (x)
+        double m_grid_y0;                         ///< grid origin (y)
+        double m_grid_cell;                       ///< grid cell size
+        int m_grid_nx;                            ///< number of grid cells in x direction
+        int m_grid_ny;                            ///< number of grid cells in y direction
     };
 
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_mesh_grid;
+    double m_mesh_grid_cell;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
@@ -28,6 +28,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChTracer.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
@@ -794,6 +795,8 @@ static const std::vector<ChVector2<int>> neighbors4{
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMDeformableSoil::ComputeInternalForces() {
+    CH_TRACE("SCMDeformableSoil::ComputeInternalForces");
+
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
     std::vector<int> modified_vertices = m_external_modified_vertices;
     m_external_modified_vertices.clear();
@@ -874,51 +877,77 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
     int nthreads = GetSystem()->GetNumThreadsChrono();
 
-    // Loop through all moving patches (user-defined or default one)
+    // Collect the rays to be cast at all vertices in the moving patches (user-defined or default one).
+    // Grid nodes are only read at this stage, so vertices can be processed concurrently.
+    std::vector<collision::ChCollisionSystem::ChRay> rays;  // rays to be cast
+    std::vector<ChVector2<int>> ray_nodes;                  // grid node of each ray
+    std::vector<double> ray_heights;                        // current terrain height at grid node of each ray
+
     for (auto& p : m_patches) {
+        int num_vertices = (int)p.m_range.size();
+        std::vector<collision::ChCollisionSystem::ChRay> patch_rays(num_vertices);
+        std::vector<double> patch_heights(num_vertices);
+        std::vector<char> patch_active(num_vertices);
+
         // Loop through all vertices in the patch range
 #pragma omp parallel for num_threads(nthreads)
-        for (int k = 0; k < p.m_range.size(); k++) {
+        for (int k = 0; k < num_vertices; k++) {
             ChVector2<int> ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
             double x = ij.x() * m_delta;
             double y = ij.y() * m_delta;
-            double z;
-#pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
+            double z = GetHeight(ij);
 
             ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
 
             // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
             ChVector<> to = vertex_abs + N * m_test_offset_up;
             ChVector<> from = to - N * m_test_offset_down;
 
-            // Ray-OBB test (quick rejection)6
-            if (m_moving_patch && !RayOBBtest(p, from, N))
+            // Ray-OBB test (quick rejection)
+            patch_active[k] = !m_moving_patch || RayOBBtest(p, from, N);
+            patch_rays[k].from = from;
+            patch_rays[k].to = to;
+            patch_heights[k] = z;
+        }
+
+        // Keep only the rays that passed the quick rejection test
+        for (int k = 0; k < num_vertices; k++) {
+            if (!patch_active[k])
                 continue;
+            rays.push_back(patch_rays[k]);
+            ray_nodes.push_back(p.m_range[k]);
+            ray_heights.push_back(patch_heights[k]);
+        }
+    }
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-#pragma omp atomic
-            m_num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-#pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z)));
-                    }
+    // Cast all rays into the collision system (the collision system may process them concurrently)
+    std::vector<collision::ChCollisionSystem::ChRayhitResult> ray_results;
+    {
+        CH_TRACE("SCMDeformableSoil::RayHitBatch");
+        GetSystem()->GetCollisionSystem()->RayHitBatch(rays, ray_results);
+    }
+    m_num_ray_casts = (int)rays.size();
 
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
+    // Record the ray-cast hits
+    for (size_t r = 0; r < rays.size(); r++) {
+        const auto& mrayhit_result = ray_results[r];
+        if (!mrayhit_result.hit)
+            continue;
+
+        const auto& ij = ray_nodes[r];
+        double z = ray_heights[r];
+
+        // If this is the first hit from this node, initialize the node record
+        if (m_grid_map.find(ij) == m_grid_map.end()) {
+            m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z)));
         }
+
+        // Add to our map of hits to process
+        HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+        hits.insert(std::make_pair(ij, record));
+        m_num_ray_hits++;
     }
 
     m_timer_ray_casting.stop();
@@ -51,6 +51,18 @@ void ChTrackAssembly::GetTrackShoeStates(BodyStates& states) const {
     size_t num_shoes = GetNumTrackShoes();
     assert(states.size() == num_shoes);
 
+    if (m_pool) {
+        // The first bodies in the pool are the track shoe bodies, in order
+        for (size_t i = 0; i < num_shoes; ++i) {
+            const ChBody* shoe = m_pool->GetBody(i);
+            states[i].pos = shoe->GetPos();
+            states[i].rot = shoe->GetRot();
+            states[i].lin_vel = shoe->GetPos_dt();
+            states[i].ang_vel = shoe->GetWvel_par();
+        }
+        return;
+    }
+
     for (size_t i = 0; i < num_shoes; ++i)
         states[i] = GetTrackShoeState(i);
 }
@@ -83,9 +95,18 @@ void ChTrackAssembly::Initialize(std::shared_ptr<ChChassis> chassis, const ChVec
     // road wheels, and idler. (Implemented by derived classes)
     bool ccw = Assemble(chassis->GetBody());
 
+    // In pooled mode, create the connection pool and register the track shoe bodies first (so that the index of a
+    // shoe body in the pool is the index of the track shoe).
+    size_t num_shoes = GetNumTrackShoes();
+    if (m_use_pool) {
+        m_pool = chrono_types::make_shared<ChTrackConnectionPool>();
+        for (size_t i = 0; i < num_shoes; ++i)
+            m_pool->AddBody(GetTrackShoe(i)->GetShoeBody());
+        chassis->GetBody()->GetSystem()->Add(m_pool);
+    }
+
     // Loop over all track shoes and allow them to connect themselves to their
     // neighbor.
-    size_t num_shoes = GetNumTrackShoes();
     std::shared_ptr<ChTrackShoe> next;
     for (size_t i = 0; i < num_shoes; ++i) {
         next = (i == num_shoes - 1) ? GetTrackShoe(0) : GetTrackShoe(i + 1);
@@ -148,10 +169,19 @@ double ChTrackAssembly::GetMass() const {
 // -----------------------------------------------------------------------------
 void ChTrackAssembly::Synchronize(double time, double braking, const TerrainForces& shoe_forces) {
     // Apply track shoe forces
-    for (size_t i = 0; i < GetNumTrackShoes(); ++i) {
-        GetTrackShoe(i)->m_shoe->Empty_forces_accumulators();
-        GetTrackShoe(i)->m_shoe->Accumulate_force(shoe_forces[i].force, shoe_forces[i].point, false);
-        GetTrackShoe(i)->m_shoe->Accumulate_torque(shoe_forces[i].moment, false);
+    if (m_pool) {
+        for (size_t i = 0; i < GetNumTrackShoes(); ++i) {
+            ChBody* shoe = m_pool->GetBody(i);
+            shoe->Empty_forces_accumulators();
+            shoe->Accumulate_force(shoe_forces[i].force, shoe_forces[i].point, false);
+            shoe->Accumulate_torque(shoe_forces[i].moment, false);
+        }
+    } else {
+        for (size_t i = 0; i < GetNumTrackShoes(); ++i) {
+            GetTrackShoe(i)->m_shoe->Empty_forces_accumulators();
+            GetTrackShoe(i)->m_shoe->Accumulate_force(shoe_forces[i].force, shoe_forces[i].point, false);
+            GetTrackShoe(i)->m_shoe->Accumulate_torque(shoe_forces[i].moment, false);
+        }
     }
 
     // Apply braking input
@@ -38,6 +38,7 @@
 #include "chrono_vehicle/tracked_vehicle/ChRoadWheelAssembly.h"
 #include "chrono_vehicle/tracked_vehicle/ChRoller.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackShoe.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackConnectionPool.h"
 
 namespace chrono {
 namespace vehicle {
@@ -139,6 +140,17 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     /// The track assembly reference frame is ISO, with origin at the sprocket center.
     virtual const ChVector<> GetRollerLocation(int which) const { return ChVector<>(0, 0, 0); }
 
+    /// Enable/disable the pooled connection mode (default: false).
+    /// In pooled mode, the force elements connecting the track shoes (rotational spring-dampers and bushings) are
+    /// collected in a single ChTrackConnectionPool which stores the shoe states and connection forces in contiguous
+    /// arrays and evaluates all connections in one pass. Ideal joints and constraints are not affected.
+    /// This function must be called before Initialize.
+    void UseConnectionPool(bool val) { m_use_pool = val; }
+
+    /// Get the connection pool of this track assembly.
+    /// Return an empty pointer if the pooled connection mode is not enabled or if the track was not initialized.
+    std::shared_ptr<ChTrackConnectionPool> GetConnectionPool() const { return m_pool; }
+
     /// Initialize this track assembly subsystem.
     /// The subsystem is initialized by attaching it to the specified chassis
     /// at the specified location (with respect to and expressed in the reference
@@ -184,7 +196,7 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     ChTrackAssembly(const std::string& name,  ///< [in] name of the subsystem
                     VehicleSide side          ///< [in] assembly on left/right vehicle side
                     )
-        : ChPart(name), m_side(side) {}
+        : ChPart(name), m_side(side), m_use_pool(false) {}
 
     /// Assemble track shoes over wheels.
     /// Return true if the track shoes were initialized in a counter clockwise
@@ -204,6 +216,9 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     ChRoadWheelAssemblyList m_suspensions;  ///< road-wheel assemblies
     ChRollerList m_rollers;                 ///< roller subsystems
 
+    bool m_use_pool;                              ///< use a pool for the track shoe connections?
+    std::shared_ptr<ChTrackConnectionPool> m_pool;  ///< pool of track shoe connections (pooled mode only)
+
     friend class ChTrackedVehicle;
     friend class ChTrackTestRig;
 };
@@ -0,0 +1,296 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Pool of track shoe connection elements (rotational spring-dampers and
+// bushings), evaluated in a single pass over contiguous arrays.
+//
+// =============================================================================
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackConnectionPool.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+ChTrackConnectionPool::Bushing::Bushing(std::shared_ptr<ChBody> bodyA,
+                                        std::shared_ptr<ChBody> bodyB,
+                                        const ChFrame<>& abs_application,
+                                        ChMatrixConstRef stiffness,
+                                        ChMatrixConstRef damping)
+    : ChLoadBodyBodyBushingGeneric(bodyA, bodyB, abs_application, stiffness, damping) {}
+
+// -----------------------------------------------------------------------------
+ChTrackConnectionPool::ChTrackConnectionPool() {}
+
+int ChTrackConnectionPool::AddBody(std::shared_ptr<ChBody> body) {
+    auto found = m_body_index.find(body.get());
+    if (found != m_body_index.end())
+        return found->second;
+
+    int index = (int)m_bodies.size();
+    m_body_index[body.get()] = index;
+    m_bodies.push_back(body);
+
+    m_pos.push_back(body->GetPos());
+    m_rot.push_back(body->GetRot());
+    m_rot_dt.push_back(body->GetRot_dt());
+    m_vel.push_back(body->GetPos_dt());
+    m_wvel_loc.push_back(body->GetWvel_loc());
+    m_A.push_back(body->GetA());
+
+    return index;
+}
+
+void ChTrackConnectionPool::AddRotSpring(std::shared_ptr<ChBody> body1,
+                                         std::shared_ptr<ChBody> body2,
+                                         const ChCoordsys<>& csys1,
+                                         const ChCoordsys<>& csys2,
+                                         std::shared_ptr<ChLinkRotSpringCB::TorqueFunctor> functor) {
+    m_rsda_body1.push_back(AddBody(body1));
+    m_rsda_body2.push_back(AddBody(body2));
+
+    // Express the two frames relative to their bodies (as done by ChMarker::Impose_Abs_Coord)
+    m_rsda_rot1.push_back(body1->GetRot().GetConjugate() * csys1.rot);
+    m_rsda_rot2.push_back(body2->GetRot().GetConjugate() * csys2.rot);
+
+    m_rsda_fun.push_back(functor);
+    m_rsda_angle.push_back(0);
+    m_rsda_speed.push_back(0);
+    m_rsda_torque.push_back(0);
+    m_rsda_abs_torque.push_back(VNULL);
+}
+
+void ChTrackConnectionPool::AddBushing(std::shared_ptr<Bushing> bushing) {
+    auto bodyA = bushing->GetBodyA();
+    auto bodyB = bushing->GetBodyB();
+
+    m_bushings.push_back(bushing);
+    m_bushing_bodyA.push_back(AddBody(bodyA));
+    m_bushing_bodyB.push_back(AddBody(bodyB));
+
+    m_bushing_frameA.push_back(bushing->GetApplicationFrameA());
+    m_bushing_frameB.push_back(bushing->GetApplicationFrameB());
+    m_bushing_neutral.push_back(bushing->NeutralDisplacement());
+    m_bushing_neutral_force.push_back(bushing->GetNeutralForce());
+    m_bushing_neutral_torque.push_back(bushing->GetNeutralTorque());
+    m_bushing_K.push_back(bushing->GetStiffnessMatrix());
+    m_bushing_R.push_back(bushing->GetDampingMatrix());
+
+    m_bushing_Q.push_back(BushingLoad::Zero());
+    m_bushing_dQdx.push_back(ChMatrixNM<double, 12, 12>::Zero());
+    m_bushing_dQdv.push_back(ChMatrixNM<double, 12, 12>::Zero());
+    m_bushing_KRM.push_back(ChKblockGeneric(&bodyA->Variables(), &bodyB->Variables()));
+}
+
+// -----------------------------------------------------------------------------
+void ChTrackConnectionPool::Update(double time, bool update_assets) {
+    // Gather the current body states
+    for (size_t i = 0; i < m_bodies.size(); i++) {
+        const ChBody* body = m_bodies[i].get();
+        m_pos[i] = body->GetPos();
+        m_rot[i] = body->GetRot();
+        m_rot_dt[i] = body->GetRot_dt();
+        m_vel[i] = body->GetPos_dt();
+        m_wvel_loc[i] = body->GetWvel_loc();
+        m_A[i] = body->GetA();
+    }
+
+    UpdateRotSprings(time);
+    UpdateBushings();
+
+    ChPhysicsItem::Update(time, update_assets);
+}
+
+void ChTrackConnectionPool::UpdateRotSprings(double time) {
+    for (size_t i = 0; i < m_rsda_body1.size(); i++) {
+        int b1 = m_rsda_body1[i];
+        int b2 = m_rsda_body2[i];
+        const ChQuaternion<>& m1 = m_rsda_rot1[i];
+        ChQuaternion<> m2c = m_rsda_rot2[i].GetConjugate();
+
+        // Relative rotation of the frame on body 1 with respect to the frame on body 2, and its time derivative
+        ChQuaternion<> q1 = m_rot[b1] * m1;
+        ChQuaternion<> rel_rot = m2c * (m_rot[b2].GetConjugate() * q1);
+        ChQuaternion<> rel_rot_dt =
+            m2c * (m_rot_dt[b2].GetConjugate() * q1) + m2c * (m_rot[b2].GetConjugate() * (m_rot_dt[b1] * m1));
+
+        // Relative angle about the (positive z) relative rotation axis, and relative angular speed
+        double angle;
+        ChVector<> axis;
+        Q_to_AngAxis(rel_rot, angle, axis);
+        if (axis.z() < 0) {
+            axis = -axis;
+            angle = -angle;
+        }
+        ChGwMatrix34<> Gw(rel_rot);
+        ChVector<> rel_wvel = Gw * rel_rot_dt;
+        double speed = Vdot(rel_wvel, axis);
+
+        double torque = m_rsda_fun[i] ? (*m_rsda_fun[i])(time, angle, speed, nullptr) : 0;
+
+        m_rsda_angle[i] = angle;
+        m_rsda_speed[i] = speed;
+        m_rsda_torque[i] = torque;
+        m_rsda_abs_torque[i] = m_A[b2] * m_rsda_rot2[i].Rotate(axis * torque);
+    }
+}
+
+void ChTrackConnectionPool::ComputeBushingLoad(size_t i,
+                                               const ChCoordsys<>& coordA,
+                                               const ChVector<>& velA,
+                                               const ChVector<>& wvelA,
+                                               const ChCoordsys<>& coordB,
+                                               const ChVector<>& velB,
+                                               const ChVector<>& wvelB,
+                                               BushingLoad& Q,
+                                               ChVector<>& force,
+                                               ChVector<>& torque) const {
+    ChFrameMoving<> bodyA(coordA);
+    bodyA.SetPos_dt(velA);
+    bodyA.SetWvel_loc(wvelA);
+    ChFrameMoving<> bodyB(coordB);
+    bodyB.SetPos_dt(velB);
+    bodyB.SetWvel_loc(wvelB);
+
+    ChFrameMoving<> frame_Aw = ChFrameMoving<>(m_bushing_frameA[i]) >> bodyA;
+    ChFrameMoving<> frame_Bw = ChFrameMoving<>(m_bushing_frameB[i]) >> bodyB;
+    ChFrameMoving<> rel_AB = frame_Aw >> frame_Bw.GetInverse();
+
+    // Bushing force and torque, in the bushing frame on body B (see ChLoadBodyBodyBushingGeneric)
+    const ChFrame<>& neutral = m_bushing_neutral[i];
+    ChVector<> rel_pos = rel_AB.GetPos() + neutral.GetPos();
+    ChQuaternion<> rel_rot = rel_AB.GetRot() * neutral.GetRot();
+    ChVector<> dir_rot;
+    double angle_rot;
+    rel_rot.Q_to_AngAxis(angle_rot, dir_rot);
+    if (angle_rot > CH_C_PI)
+        angle_rot -= CH_C_2PI;
+    if (angle_rot < -CH_C_PI)
+        angle_rot += CH_C_2PI;
+    ChVector<> vect_rot = dir_rot * angle_rot;
+
+    ChVectorN<double, 6> S;
+    ChVectorN<double, 6> S_dt;
+    S.segment(0, 3) = rel_pos.eigen();
+    S.segment(3, 3) = vect_rot.eigen();
+    S_dt.segment(0, 3) = rel_AB.GetPos_dt().eigen();
+    S_dt.segment(3, 3) = rel_AB.GetWvel_par().eigen();
+
+    ChVectorN<double, 6> F = m_bushing_K[i] * S + m_bushing_R[i] * S_dt;
+    force = ChVector<>(F.segment(0, 3)) - m_bushing_neutral_force[i];
+    torque = ChVector<>(F.segment(3, 3)) - m_bushing_neutral_torque[i];
+
+    // Generalized load on the two bodies (see ChLoadBodyBody)
+    ChVector<> abs_force = frame_Bw.TransformDirectionLocalToParent(force);
+    ChVector<> abs_torque = frame_Bw.TransformDirectionLocalToParent(torque);
+
+    ChVector<> loc_ftorque = coordA.rot.RotateBack((frame_Aw.GetPos() - coordA.pos) % -abs_force);
+    ChVector<> loc_torque = coordA.rot.RotateBack(-abs_torque);
+    Q.segment(0, 3) = -abs_force.eigen();
+    Q.segment(3, 3) = (loc_ftorque + loc_torque).eigen();
+
+    loc_ftorque = coordB.rot.RotateBack((frame_Bw.GetPos() - coordB.pos) % abs_force);
+    loc_torque = coordB.rot.RotateBack(abs_torque);
+    Q.segment(6, 3) = abs_force.eigen();
+    Q.segment(9, 3) = (loc_ftorque + loc_torque).eigen();
+}
+
+void ChTrackConnectionPool::UpdateBushings() {
+    // Perturbation for the finite-difference Jacobians (as in ChLoadCustomMultiple)
+    const double delta = 1e-8;
+
+    BushingLoad Q1;
+    ChVector<> force;
+    ChVector<> torque;
+    ChVector<> force1;
+    ChVector<> torque1;
+
+    for (size_t i = 0; i < m_bushing_bodyA.size(); i++) {
+        int a = m_bushing_bodyA[i];
+        int b = m_bushing_bodyB[i];
+
+        // State of the two bodies: x = [coordA, coordB], v = [velA, wvelA, velB, wvelB]
+        ChCoordsys<> x[2] = {ChCoordsys<>(m_pos[a], m_rot[a]), ChCoordsys<>(m_pos[b], m_rot[b])};
+        ChVector<> v[4] = {m_vel[a], m_wvel_loc[a], m_vel[b], m_wvel_loc[b]};
+        const ChMatrix33<>* A[2] = {&m_A[a], &m_A[b]};
+
+        BushingLoad& Q = m_bushing_Q[i];
+        ComputeBushingLoad(i, x[0], v[0], v[1], x[1], v[2], v[3], Q, force, torque);
+        m_bushings[i]->SetResults(force, torque);
+
+        // Stiffness Jacobian, K = -dQ/dx, with the position increment of ChBody::LoadableStateIncrement
+        for (int j = 0; j < 12; j++) {
+            int body = j / 6;
+            int dir = j % 3;
+            ChCoordsys<> x_inc[2] = {x[0], x[1]};
+            if ((j % 6) < 3) {
+                x_inc[body].pos[dir] += delta;
+            } else {
+                ChQuaternion<> rot_inc;
+                rot_inc.Q_from_AngAxis(delta, ChVector<>(A[body]->col(dir)));
+                x_inc[body].rot = rot_inc * x[body].rot;
+            }
+            ComputeBushingLoad(i, x_inc[0], v[0], v[1], x_inc[1], v[2], v[3], Q1, force1, torque1);
+            m_bushing_dQdx[i].col(j) = (Q1 - Q) * (-1.0 / delta);
+        }
+
+        // Damping Jacobian, R = -dQ/dv
+        for (int j = 0; j < 12; j++) {
+            ChVector<> v_inc[4] = {v[0], v[1], v[2], v[3]};
+            v_inc[j / 3][j % 3] += delta;
+            ComputeBushingLoad(i, x[0], v_inc[0], v_inc[1], x[1], v_inc[2], v_inc[3], Q1, force1, torque1);
+            m_bushing_dQdv[i].col(j) = (Q1 - Q) * (-1.0 / delta);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void ChTrackConnectionPool::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    // Rotational spring-dampers: pure torques, applied with opposite signs on the two bodies
+    for (size_t i = 0; i < m_rsda_body1.size(); i++) {
+        ChBody* body1 = m_bodies[m_rsda_body1[i]].get();
+        ChBody* body2 = m_bodies[m_rsda_body2[i]].get();
+        const ChVector<>& abs_torque = m_rsda_abs_torque[i];
+        if (body1->Variables().IsActive()) {
+            R.segment(body1->GetOffset_w() + 3, 3) +=
+                c * m_A[m_rsda_body1[i]].transpose() * abs_torque.eigen();
+        }
+        if (body2->Variables().IsActive()) {
+            R.segment(body2->GetOffset_w() + 3, 3) -=
+                c * m_A[m_rsda_body2[i]].transpose() * abs_torque.eigen();
+        }
+    }
+
+    // Bushings: generalized loads on the two bodies
+    for (size_t i = 0; i < m_bushing_bodyA.size(); i++) {
+        ChBody* bodyA = m_bodies[m_bushing_bodyA[i]].get();
+        ChBody* bodyB = m_bodies[m_bushing_bodyB[i]].get();
+        if (bodyA->Variables().IsActive())
+            R.segment(bodyA->GetOffset_w(), 6) += c * m_bushing_Q[i].segment(0, 6);
+        if (bodyB->Variables().IsActive())
+            R.segment(bodyB->GetOffset_w(), 6) += c * m_bushing_Q[i].segment(6, 6);
+    }
+}
+
+void ChTrackConnectionPool::InjectKRMmatrices(ChSystemDescriptor& descriptor) {
+    for (auto& KRM : m_bushing_KRM)
+        descriptor.InsertKblock(&KRM);
+}
+
+void ChTrackConnectionPool::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    for (size_t i = 0; i < m_bushing_KRM.size(); i++) {
+        m_bushing_KRM[i].Get_K() = Kfactor * m_bushing_dQdx[i] + Rfactor * m_bushing_dQdv[i];
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
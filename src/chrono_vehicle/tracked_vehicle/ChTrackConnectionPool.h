@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Pool of track shoe connection elements (rotational spring-dampers and
+// bushings), evaluated in a single pass over contiguous arrays.
+//
+// =============================================================================
+
+#ifndef CH_TRACK_CONNECTION_POOL_H
+#define CH_TRACK_CONNECTION_POOL_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkRotSpringCB.h"
+#include "chrono/physics/ChLoadsBody.h"
+#include "chrono/solver/ChKblockGeneric.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_tracked
+/// @{
+
+/// Pool of the force elements connecting the bodies of a track assembly.
+/// Instead of representing each connection as a separate link or load (with its own markers, state caches, and
+/// virtual update functions), the pool stores the body states, connection parameters, and connection forces in
+/// contiguous arrays and evaluates all connections in a single pass at each update. Two types of connections are
+/// supported, with results identical (up to round-off) to those of the corresponding Chrono elements:
+/// - rotational spring-dampers, equivalent to ChLinkRotSpringCB;
+/// - bushings, equivalent to ChLoadBodyBodyBushingGeneric (including the stiffness and damping Jacobians).
+///
+/// A pool is created and managed by a track assembly in pooled connection mode (see
+/// ChTrackAssembly::UseConnectionPool); the track shoes then add their connections to the pool.
+class CH_VEHICLE_API ChTrackConnectionPool : public ChPhysicsItem {
+  public:
+    /// Bushing load whose force is evaluated by a connection pool.
+    /// Such a load must not be added to a load container; its force and torque (as reported by GetForce and
+    /// GetTorque) are set by the pool at each update.
+    class CH_VEHICLE_API Bushing : public ChLoadBodyBodyBushingGeneric {
+      public:
+        Bushing(std::shared_ptr<ChBody> bodyA,      ///< body A
+                std::shared_ptr<ChBody> bodyB,      ///< body B
+                const ChFrame<>& abs_application,  ///< initial frame of the bushing in absolute space
+                ChMatrixConstRef stiffness,         ///< 6x6 stiffness matrix, in the bushing frame
+                ChMatrixConstRef damping            ///< 6x6 damping matrix, in the bushing frame
+        );
+
+      private:
+        void SetResults(const ChVector<>& force, const ChVector<>& torque) {
+            locB_force = force;
+            locB_torque = torque;
+        }
+
+        friend class ChTrackConnectionPool;
+    };
+
+    ChTrackConnectionPool();
+    ~ChTrackConnectionPool() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChTrackConnectionPool* Clone() const override { return new ChTrackConnectionPool(*this); }
+
+    /// Add the specified body to the pool and return its index.
+    /// Bodies are added automatically with their connections; a body added more than once keeps its first index.
+    /// The pool bodies must be ChBody objects (their reference frame is the centroidal frame).
+    int AddBody(std::shared_ptr<ChBody> body);
+
+    /// Add a rotational spring-damper between the two bodies.
+    /// This is equivalent to a ChLinkRotSpringCB initialized with the two specified absolute frames (with the
+    /// difference that the functor is invoked with a null link pointer).
+    void AddRotSpring(std::shared_ptr<ChBody> body1,                               ///< first body
+                      std::shared_ptr<ChBody> body2,                               ///< second body
+                      const ChCoordsys<>& csys1,                                   ///< frame on first body (abs)
+                      const ChCoordsys<>& csys2,                                   ///< frame on second body (abs)
+                      std::shared_ptr<ChLinkRotSpringCB::TorqueFunctor> functor  ///< torque functor
+    );
+
+    /// Add a bushing between its two bodies.
+    /// The stiffness, damping, and neutral configuration of the bushing are read when the bushing is added.
+    void AddBushing(std::shared_ptr<Bushing> bushing);
+
+    /// Get the number of bodies in the pool.
+    size_t GetNumBodies() const { return m_bodies.size(); }
+
+    /// Get the number of rotational spring-dampers.
+    size_t GetNumRotSprings() const { return m_rsda_body1.size(); }
+
+    /// Get the number of bushings.
+    size_t GetNumBushings() const { return m_bushing_bodyA.size(); }
+
+    /// Get the specified body.
+    ChBody* GetBody(size_t i) const { return m_bodies[i].get(); }
+
+    /// Get the position of the specified body, as of the last update.
+    const ChVector<>& GetBodyPos(size_t i) const { return m_pos[i]; }
+
+    /// Get the orientation of the specified body, as of the last update.
+    const ChQuaternion<>& GetBodyRot(size_t i) const { return m_rot[i]; }
+
+    /// Get the angle of the specified rotational spring-damper, as of the last update.
+    double GetRotSpringAngle(size_t i) const { return m_rsda_angle[i]; }
+
+    /// Get the angular speed of the specified rotational spring-damper, as of the last update.
+    double GetRotSpringSpeed(size_t i) const { return m_rsda_speed[i]; }
+
+    /// Get the torque of the specified rotational spring-damper, as of the last update.
+    double GetRotSpringTorque(size_t i) const { return m_rsda_torque[i]; }
+
+    /// Evaluate all connection forces (and bushing Jacobians) at the current body states.
+    virtual void Update(double time, bool update_assets = true) override;
+
+    /// Add the connection forces to the residual R += c * F.
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+
+    /// Register the bushing Jacobian blocks with the system descriptor.
+    virtual void InjectKRMmatrices(ChSystemDescriptor& descriptor) override;
+
+    /// Compute the bushing Jacobian blocks K = Kfactor * K + Rfactor * R.
+    virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) override;
+
+  private:
+    typedef ChVectorN<double, 12> BushingLoad;
+
+    // Evaluate the generalized load of the specified bushing at the given states of its two bodies.
+    void ComputeBushingLoad(size_t i,
+                            const ChCoordsys<>& coordA,
+                            const ChVector<>& velA,
+                            const ChVector<>& wvelA,
+                            const ChCoordsys<>& coordB,
+                            const ChVector<>& velB,
+                            const ChVector<>& wvelB,
+                            BushingLoad& Q,
+                            ChVector<>& force,
+                            ChVector<>& torque) const;
+
+    void UpdateRotSprings(double time);
+    void UpdateBushings();
+
+    std::vector<std::shared_ptr<ChBody>> m_bodies;  ///< pool bodies
+    std::unordered_map<ChBody*, int> m_body_index;  ///< index of each pool body
+
+    // Body states, gathered at each update
+    std::vector<ChVector<>> m_pos;          ///< body positions
+    std::vector<ChQuaternion<>> m_rot;      ///< body orientations
+    std::vector<ChQuaternion<>> m_rot_dt;   ///< body orientation derivatives
+    std::vector<ChVector<>> m_vel;          ///< body linear velocities
+    std::vector<ChVector<>> m_wvel_loc;     ///< body angular velocities (local frame)
+    std::vector<ChMatrix33<>> m_A;          ///< body rotation matrices
+
+    // Rotational spring-dampers
+    std::vector<int> m_rsda_body1;                                              ///< index of first body
+    std::vector<int> m_rsda_body2;                                              ///< index of second body
+    std::vector<ChQuaternion<>> m_rsda_rot1;                                    ///< frame on first body (local)
+    std::vector<ChQuaternion<>> m_rsda_rot2;                                    ///< frame on second body (local)
+    std::vector<std::shared_ptr<ChLinkRotSpringCB::TorqueFunctor>> m_rsda_fun;  ///< torque functors
+    std::vector<double> m_rsda_angle;                                           ///< current relative angles
+    std::vector<double> m_rsda_speed;                                           ///< current relative speeds
+    std::vector<double> m_rsda_torque;                                          ///< current torques
+    std::vector<ChVector<>> m_rsda_abs_torque;                                  ///< current torques (abs frame)
+
+    // Bushings (fixed-size Eigen types are stored with an aligned allocator)
+    template <typename T>
+    using aligned_vector = std::vector<T, Eigen::aligned_allocator<T>>;
+
+    std::vector<std::shared_ptr<Bushing>> m_bushings;              ///< bushing loads (for reporting forces)
+    std::vector<int> m_bushing_bodyA;                               ///< index of body A
+    std::vector<int> m_bushing_bodyB;                               ///< index of body B
+    aligned_vector<ChFrame<>> m_bushing_frameA;                     ///< bushing frame on body A (local)
+    aligned_vector<ChFrame<>> m_bushing_frameB;                     ///< bushing frame on body B (local)
+    aligned_vector<ChFrame<>> m_bushing_neutral;                    ///< neutral displacement
+    std::vector<ChVector<>> m_bushing_neutral_force;                ///< neutral force
+    std::vector<ChVector<>> m_bushing_neutral_torque;               ///< neutral torque
+    aligned_vector<ChMatrixNM<double, 6, 6>> m_bushing_K;           ///< stiffness matrices
+    aligned_vector<ChMatrixNM<double, 6, 6>> m_bushing_R;           ///< damping matrices
+    aligned_vector<BushingLoad> m_bushing_Q;                        ///< current generalized loads
+    aligned_vector<ChMatrixNM<double, 12, 12>> m_bushing_dQdx;      ///< current stiffness Jacobians (-dQ/dx)
+    aligned_vector<ChMatrixNM<double, 12, 12>> m_bushing_dQdv;      ///< current damping Jacobians (-dQ/dv)
+    std::vector<ChKblockGeneric> m_bushing_KRM;                     ///< Jacobian blocks for the system descriptor
+};
+
+/// @} vehicle_tracked
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -379,9 +379,6 @@ bool ChTrackCollisionManager::OnNarrowphase(collision::ChCollisionInfo& contacti
 void ChTrackCustomContact::Setup() {
     // Calculate contact forces for all current wheel-shoe collisions, calling the user-supplied callback
     ApplyForces();
-
-    // Perform a full update of the load container 
-    ChLoadContainer::Update(ChTime, false);
 }
 
 void ChTrackCustomContact::Update(double mytime, bool update_assets) {
@@ -392,9 +389,30 @@ void ChTrackCustomContact::Update(double mytime, bool update_assets) {
     ChTime = mytime;
 }
 
+void ChTrackCustomContact::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    for (size_t i = 0; i < m_bodies.size(); i++) {
+        if (!m_bodies[i]->Variables().IsActive())
+            continue;
+        unsigned int offset = m_bodies[i]->GetOffset_w();
+        R.segment(offset + 0, 3) += c * m_forces[i].eigen();
+        R.segment(offset + 3, 3) += c * m_torques[i].eigen();
+    }
+}
+
+// Record a contact force acting on the given body at the given point (both in the absolute frame), together with its
+// torque about the body center (in the body frame). This is equivalent to a ChLoadBodyForce evaluated at the current
+// body state, without the allocation of a load object for each contact.
+void ChTrackCustomContact::AddForce(ChBody* body, const ChVector<>& force, const ChVector<>& point) {
+    m_bodies.push_back(body);
+    m_forces.push_back(force);
+    m_torques.push_back(body->GetRot().RotateBack((point - body->GetPos()) % force));
+}
+
 void ChTrackCustomContact::ApplyForces() {
-    // Reset the load list for this load container
-    GetLoadList().clear();
+    // Reset the contact forces (the arrays keep their capacity)
+    m_bodies.clear();
+    m_forces.clear();
+    m_torques.clear();
 
     ////std::cout << "Idler-shoe collisions: " << m_collision_manager->m_collisions_idler.size() << std::endl;
     ////std::cout << "Wheel-shoe collisions: " << m_collision_manager->m_collisions_wheel.size() << std::endl;
@@ -409,10 +427,8 @@ void ChTrackCustomContact::ApplyForces() {
         ComputeForce(cInfo, bodyA, bodyB, true, forceB);
 
         // Apply equal and opposite forces on the two bodies (road wheel and track shoe) in contact
-        auto loadA = chrono_types::make_shared<ChLoadBodyForce>(bodyA, -forceB, false, cInfo.vpA, false);
-        auto loadB = chrono_types::make_shared<ChLoadBodyForce>(bodyB, +forceB, false, cInfo.vpB, false);
-        Add(loadA);
-        Add(loadB);
+        AddForce(bodyA.get(), -forceB, cInfo.vpA);
+        AddForce(bodyB.get(), +forceB, cInfo.vpB);
     }
     
     for (auto& cInfo : m_collision_manager->m_collisions_wheel) {
@@ -423,10 +439,8 @@ void ChTrackCustomContact::ApplyForces() {
         ComputeForce(cInfo, bodyA, bodyB, false, forceB);
 
         // Apply equal and opposite forces on the two bodies (wheel and track shoe) in contact
-        auto loadA = chrono_types::make_shared<ChLoadBodyForce>(bodyA, -forceB, false, cInfo.vpA, false);
-        auto loadB = chrono_types::make_shared<ChLoadBodyForce>(bodyB, +forceB, false, cInfo.vpB, false);
-        Add(loadA);
-        Add(loadB);
+        AddForce(bodyA.get(), -forceB, cInfo.vpA);
+        AddForce(bodyB.get(), +forceB, cInfo.vpB);
     }
 }
 
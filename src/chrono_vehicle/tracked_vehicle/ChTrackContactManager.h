@@ -153,10 +153,17 @@ class CH_VEHICLE_API ChTrackCustomContact : public ChLoadContainer {
   private:
     virtual void Setup() override;
     virtual void Update(double mytime, bool update_assets = true) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
     void ApplyForces();
+    void AddForce(ChBody* body, const ChVector<>& force, const ChVector<>& point);
 
     ChTrackCollisionManager* m_collision_manager;
 
+    // Contact forces for the current step, stored in contiguous arrays (reused from one step to the next)
+    std::vector<ChBody*> m_bodies;      ///< bodies acted upon by the contact forces
+    std::vector<ChVector<>> m_forces;   ///< contact forces (absolute frame)
+    std::vector<ChVector<>> m_torques;  ///< torques of contact forces about body centers (body frame)
+
     friend class ChTrackedVehicle;
 };
 
@@ -26,6 +26,7 @@
 #include "chrono/physics/ChLoadContainer.h"
 
 #include "chrono_vehicle/ChSubsysDefs.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
 #include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeBandBushing.h"
 
 namespace chrono {
@@ -164,9 +165,14 @@ void ChTrackShoeBandBushing::AddWebVisualization(std::shared_ptr<ChBody> segment
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void ChTrackShoeBandBushing::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAssembly* assembly, bool ccw) {
-    // Bushings are inherited from ChLoad, so they require a 'load container'
-    auto loadcontainer = chrono_types::make_shared<ChLoadContainer>();
-    m_shoe->GetSystem()->Add(loadcontainer);
+    // Bushings are inherited from ChLoad, so they require a 'load container' (unless they are evaluated by the
+    // connection pool of the track assembly)
+    auto pool = assembly->GetConnectionPool();
+    std::shared_ptr<ChLoadContainer> loadcontainer;
+    if (!pool) {
+        loadcontainer = chrono_types::make_shared<ChLoadContainer>();
+        m_shoe->GetSystem()->Add(loadcontainer);
+    }
 
     // Stiffness and Damping matrix values
     ChMatrixNM<double, 6, 6> K_matrix;
@@ -191,40 +197,48 @@ void ChTrackShoeBandBushing::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackA
 
     int index = 0;
 
+    // Create a bushing and add it to the load container or to the connection pool
+    auto add_bushing = [&](std::shared_ptr<ChBody> bodyA,  // body A
+                           std::shared_ptr<ChBody> bodyB,  // body B
+                           const ChFrame<>& frame,         // initial frame of bushing in abs space
+                           const ChFrame<>& frameA,        // application frame on body A
+                           const ChFrame<>& frameB         // application frame on body B
+                       ) {
+        std::shared_ptr<ChLoadBodyBodyBushingGeneric> loadbushing;
+        std::shared_ptr<ChTrackConnectionPool::Bushing> pooled;
+        if (pool) {
+            pooled = chrono_types::make_shared<ChTrackConnectionPool::Bushing>(bodyA, bodyB, frame, K_matrix, R_matrix);
+            loadbushing = pooled;
+        } else {
+            loadbushing =
+                chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(bodyA, bodyB, frame, K_matrix, R_matrix);
+        }
+        loadbushing->SetNameString(m_name + "_bushing_" + std::to_string(index++));
+        loadbushing->SetApplicationFrameA(frameA);
+        loadbushing->SetApplicationFrameB(frameB);
+        if (pool)
+            pool->AddBushing(pooled);
+        else
+            loadcontainer->Add(loadbushing);
+        m_web_bushings.push_back(loadbushing);
+    };
+
     // Connect tread body to the first web segment.
     {
         ChVector<> loc = m_shoe->TransformPointLocalToParent(ChVector<>(GetToothBaseLength() / 2, 0, 0));
         ChQuaternion<>& rot = m_shoe->GetRot();
-        auto loadbushing = chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(
-            m_shoe,               // body A
-            m_web_segments[0],    // body B
-            ChFrame<>(loc, rot),  // initial frame of bushing in abs space
-            K_matrix,             // the 6x6 (translation+rotation) K matrix in local frame
-            R_matrix              // the 6x6 (translation+rotation) R matrix in local frame
-        );
-        loadbushing->SetNameString(m_name + "_bushing_" + std::to_string(index++));
-        loadbushing->SetApplicationFrameA(ChFrame<>(ChVector<>(GetToothBaseLength() / 2, 0, 0)));
-        loadbushing->SetApplicationFrameB(ChFrame<>(ChVector<>(-m_seg_length / 2, 0, 0)));
-        loadcontainer->Add(loadbushing);
-        m_web_bushings.push_back(loadbushing);
+        add_bushing(m_shoe, m_web_segments[0], ChFrame<>(loc, rot),
+                    ChFrame<>(ChVector<>(GetToothBaseLength() / 2, 0, 0)),
+                    ChFrame<>(ChVector<>(-m_seg_length / 2, 0, 0)));
     }
 
     // Connect the web segments to each other.
     for (size_t is = 0; is < GetNumWebSegments() - 1; is++) {
         ChVector<> loc = m_web_segments[is]->TransformPointLocalToParent(ChVector<>(m_seg_length / 2, 0, 0));
         ChQuaternion<>& rot = m_web_segments[is]->GetRot();
-        auto loadbushing = chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(
-            m_web_segments[is],      // body A
-            m_web_segments[is + 1],  // body B
-            ChFrame<>(loc, rot),     // initial frame of bushing in abs space
-            K_matrix,                // the 6x6 (translation+rotation) K matrix in local frame
-            R_matrix                 // the 6x6 (translation+rotation) R matrix in local frame
-        );
-        loadbushing->SetNameString(m_name + "_bushing_" + std::to_string(index++));
-        loadbushing->SetApplicationFrameA(ChFrame<>(ChVector<>(m_seg_length / 2, 0, 0)));
-        loadbushing->SetApplicationFrameB(ChFrame<>(ChVector<>(-m_seg_length / 2, 0, 0)));
-        loadcontainer->Add(loadbushing);
-        m_web_bushings.push_back(loadbushing);
+        add_bushing(m_web_segments[is], m_web_segments[is + 1], ChFrame<>(loc, rot),
+                    ChFrame<>(ChVector<>(m_seg_length / 2, 0, 0)),
+                    ChFrame<>(ChVector<>(-m_seg_length / 2, 0, 0)));
     }
 
     {
@@ -232,18 +246,9 @@ void ChTrackShoeBandBushing::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackA
         int is = GetNumWebSegments() - 1;
         ChVector<> loc = m_web_segments[is]->TransformPointLocalToParent(ChVector<>(m_seg_length / 2, 0, 0));
         ChQuaternion<>& rot = m_web_segments[is]->GetRot();
-        auto loadbushing = chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(
-            m_web_segments[is],   // body A
-            next->GetShoeBody(),  // body B
-            ChFrame<>(loc, rot),  // initial frame of bushing in abs space
-            K_matrix,             // the 6x6 (translation+rotation) K matrix in local frame
-            R_matrix              // the 6x6 (translation+rotation) R matrix in local frame
-        );
-        loadbushing->SetNameString(m_name + "_bushing_" + std::to_string(index++));
-        loadbushing->SetApplicationFrameA(ChFrame<>(ChVector<>(m_seg_length / 2, 0, 0)));
-        loadbushing->SetApplicationFrameB(ChFrame<>(ChVector<>(-GetToothBaseLength() / 2, 0, 0)));
-        loadcontainer->Add(loadbushing);
-        m_web_bushings.push_back(loadbushing);
+        add_bushing(m_web_segments[is], next->GetShoeBody(), ChFrame<>(loc, rot),
+                    ChFrame<>(ChVector<>(m_seg_length / 2, 0, 0)),
+                    ChFrame<>(ChVector<>(-GetToothBaseLength() / 2, 0, 0)));
     }
 }
 
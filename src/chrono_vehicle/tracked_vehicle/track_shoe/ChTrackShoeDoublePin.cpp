@@ -172,6 +172,9 @@ void ChTrackShoeDoublePin::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAss
     bool add_RSDA = (track->GetConnectionType() == ChTrackAssemblySegmented::ConnectionType::RSDA_JOINT);
     assert(!add_RSDA || track->GetTorqueFunctor());
 
+    // In pooled connection mode, the RSDAs are evaluated by the connection pool of the track assembly
+    auto pool = track->GetConnectionPool();
+
     // Create and initialize the revolute joints between shoe body and connector bodies.
     ChVector<> loc_L =
         m_shoe->TransformPointLocalToParent(ChVector<>(sign * GetShoeLength() / 2, +GetShoeWidth() / 2, 0));
@@ -190,7 +193,12 @@ void ChTrackShoeDoublePin::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAss
     system->AddLink(m_revolute_R);
 
     // Optionally, include rotational spring-dampers to model track bending stiffness
-    if (add_RSDA) {
+    if (add_RSDA && pool) {
+        pool->AddRotSpring(m_shoe, m_connector_L, ChCoordsys<>(loc_L, m_shoe->GetRot()),
+                           ChCoordsys<>(loc_L, m_connector_L->GetRot()), track->GetTorqueFunctor());
+        pool->AddRotSpring(m_shoe, m_connector_R, ChCoordsys<>(loc_R, m_shoe->GetRot()),
+                           ChCoordsys<>(loc_R, m_connector_R->GetRot()), track->GetTorqueFunctor());
+    } else if (add_RSDA) {
         auto rsda_L = chrono_types::make_shared<ChLinkRotSpringCB>();
         rsda_L->SetNameString(m_name + "_rsda_rev_L");
         rsda_L->Initialize(m_shoe, m_connector_L, false, ChCoordsys<>(loc_L, m_shoe->GetRot()),
@@ -241,7 +249,12 @@ void ChTrackShoeDoublePin::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAss
     }
 
     // Optionally, include rotational spring-dampers to model track bending stiffness
-    if (add_RSDA) {
+    if (add_RSDA && pool) {
+        pool->AddRotSpring(next->GetShoeBody(), m_connector_L, ChCoordsys<>(loc_L, next->GetShoeBody()->GetRot()),
+                           ChCoordsys<>(loc_L, m_connector_L->GetRot()), track->GetTorqueFunctor());
+        pool->AddRotSpring(next->GetShoeBody(), m_connector_R, ChCoordsys<>(loc_R, next->GetShoeBody()->GetRot()),
+                           ChCoordsys<>(loc_R, m_connector_R->GetRot()), track->GetTorqueFunctor());
+    } else if (add_RSDA) {
         auto rsda_L = chrono_types::make_shared<ChLinkRotSpringCB>();
         rsda_L->SetNameString(m_name + "_rsda_sph_L");
         rsda_L->Initialize(next->GetShoeBody(), m_connector_L, false,
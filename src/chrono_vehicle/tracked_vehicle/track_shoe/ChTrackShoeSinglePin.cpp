@@ -79,6 +79,9 @@ void ChTrackShoeSinglePin::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAss
     bool add_RSDA = (track->GetConnectionType() == ChTrackAssemblySegmented::ConnectionType::RSDA_JOINT);
     assert(!add_RSDA || track->GetTorqueFunctor());
 
+    // In pooled connection mode, the RSDAs are evaluated by the connection pool of the track assembly
+    auto pool = track->GetConnectionPool();
+
     ChVector<> loc = m_shoe->TransformPointLocalToParent(ChVector<>(sign * GetPitch() / 2, 0, 0));
 
     if (m_index == 0) {
@@ -100,7 +103,10 @@ void ChTrackShoeSinglePin::Connect(std::shared_ptr<ChTrackShoe> next, ChTrackAss
     }
 
     // Optionally, include rotational spring-damper to model track bending stiffness
-    if (add_RSDA) {
+    if (add_RSDA && pool) {
+        pool->AddRotSpring(m_shoe, next->GetShoeBody(), ChCoordsys<>(loc, m_shoe->GetRot()),
+                           ChCoordsys<>(loc, next->GetShoeBody()->GetRot()), track->GetTorqueFunctor());
+    } else if (add_RSDA) {
         auto rsda = chrono_types::make_shared<ChLinkRotSpringCB>();
         rsda->SetNameString(m_name + "_rsda");
         rsda->Initialize(m_shoe, next->GetShoeBody(), false, ChCoordsys<>(loc, m_shoe->GetRot()),
@@ -17,6 +17,9 @@
 // =============================================================================
 
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
@@ -93,7 +96,7 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 
-Document ReadFileJSON(const std::string& filename) {
+static Document ParseFileJSON(const std::string& filename) {
     Document d;
     std::ifstream ifs(filename);
     if (!ifs.good()) {
@@ -108,6 +111,63 @@ Document ReadFileJSON(const std::string& filename) {
     return d;
 }
 
+// Cache of parsed JSON documents, keyed by file name (only valid documents are cached).
+// Cached documents are never modified, so they can be copied without holding the lock.
+struct CacheJSON {
+    std::mutex mutex;
+    bool enabled = false;
+    std::unordered_map<std::string, std::shared_ptr<const Document>> documents;
+};
+
+static CacheJSON& GetCacheJSON() {
+    static CacheJSON cache;
+    return cache;
+}
+
+Document ReadFileJSON(const std::string& filename) {
+    CacheJSON& cache = GetCacheJSON();
+    std::shared_ptr<const Document> cached;
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (!cache.enabled)
+            return ParseFileJSON(filename);
+        auto entry = cache.documents.find(filename);
+        if (entry != cache.documents.end())
+            cached = entry->second;
+    }
+
+    if (!cached) {
+        // Files are parsed outside the lock; if several threads load the same file, the first document inserted is
+        // kept
+        Document d = ParseFileJSON(filename);
+        if (d.IsNull())
+            return d;
+        cached = std::shared_ptr<const Document>(new Document(std::move(d)));
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.enabled)
+            cached = cache.documents.emplace(filename, cached).first->second;
+    }
+
+    Document d;
+    d.CopyFrom(*cached, d.GetAllocator());
+    return d;
+}
+
+void EnableCacheJSON(bool val) {
+    CacheJSON& cache = GetCacheJSON();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.enabled = val;
+    if (!val)
+        cache.documents.clear();
+}
+
+bool IsCacheJSONEnabled() {
+    CacheJSON& cache = GetCacheJSON();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.enabled;
+}
+
 // -----------------------------------------------------------------------------
 
 ChVector<> ReadVectorJSON(const Value& a) {
@@ -47,8 +47,18 @@ namespace vehicle {
 
 /// Load and return a RapidJSON document from the specified file.
 /// A Null document is returned if the file cannot be opened.
+/// If caching is enabled (see EnableCacheJSON), a file is parsed only the first time it is loaded.
 CH_VEHICLE_API rapidjson::Document ReadFileJSON(const std::string& filename);
 
+/// Enable or disable caching of the documents loaded with ReadFileJSON (default: disabled).
+/// With caching enabled, ReadFileJSON returns a copy of the document parsed the first time a file was loaded, which
+/// avoids re-reading and re-parsing the same specification files when constructing many instances of a model (see
+/// ChVehicleBatch). Disabling caching releases all cached documents. This function is thread-safe.
+CH_VEHICLE_API void EnableCacheJSON(bool val);
+
+/// Return true if caching of JSON documents is enabled.
+CH_VEHICLE_API bool IsCacheJSONEnabled();
+
 // -----------------------------------------------------------------------------
 
 /// Load and return a ChVector from the specified JSON array
@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch runner for many independent vehicle simulations in one process.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/parallel/ChOpenMP.h"
+
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleBatch.h"
+
+namespace chrono {
+namespace vehicle {
+
+namespace {
+
+// Queue of sample indices owned by one worker thread. The owner takes samples from the front of its queue, while
+// other workers steal samples from the back.
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<size_t> samples;
+
+    bool PopFront(size_t& sample) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (samples.empty())
+            return false;
+        sample = samples.front();
+        samples.pop_front();
+        return true;
+    }
+
+    bool PopBack(size_t& sample) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (samples.empty())
+            return false;
+        sample = samples.back();
+        samples.pop_back();
+        return true;
+    }
+};
+
+}  // end anonymous namespace
+
+ChVehicleBatch::ChVehicleBatch(int num_threads) : m_run_time(0), m_num_steps(0), m_num_steals(0) {
+    m_num_threads = (num_threads > 0) ? num_threads : ChOMP::GetNumProcs();
+}
+
+void ChVehicleBatch::AddSample(std::shared_ptr<Sample> sample) {
+    m_samples.push_back(sample);
+}
+
+void ChVehicleBatch::Run() {
+    m_run_time = 0;
+    m_num_steps = 0;
+    m_num_steals = 0;
+    if (m_samples.empty())
+        return;
+
+    int num_threads = std::min(m_num_threads, (int)m_samples.size());
+
+    // Distribute samples round-robin over the worker queues
+    std::vector<WorkerQueue> queues(num_threads);
+    for (size_t i = 0; i < m_samples.size(); i++)
+        queues[i % num_threads].samples.push_back(i);
+
+    // Share parsed JSON specification files across all samples
+    bool cache_json = IsCacheJSONEnabled();
+    EnableCacheJSON(true);
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    long long num_steps = 0;
+    int num_steals = 0;
+
+    ChTimer<double> timer;
+    timer.start();
+
+#pragma omp parallel num_threads(num_threads) reduction(+ : num_steps, num_steals)
+    {
+        int id = ChOMP::GetThreadNum();
+        size_t index;
+        while (true) {
+            // Take the next sample from the own queue or, if empty, steal one from another worker
+            bool found = queues[id].PopFront(index);
+            for (int k = 1; !found && k < num_threads; k++) {
+                found = queues[(id + k) % num_threads].PopBack(index);
+                if (found)
+                    num_steals++;
+            }
+            if (!found)
+                break;
+
+            try {
+                auto& sample = m_samples[index];
+                sample->Construct();
+                do {
+                    num_steps++;
+                } while (sample->Advance());
+                sample->Destroy();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    timer.stop();
+    m_run_time = timer();
+    m_num_steps = num_steps;
+    m_num_steals = num_steals;
+
+    EnableCacheJSON(cache_json);
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
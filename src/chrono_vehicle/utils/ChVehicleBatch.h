@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch runner for many independent vehicle simulations in one process.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_BATCH_H
+#define CH_VEHICLE_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Batch runner for independent simulations (e.g., the samples of a Monte-Carlo study).
+/// Each sample owns its Chrono system, vehicle, terrain, etc. Samples are distributed over a pool of worker threads,
+/// each with its own queue of samples; a worker which runs out of samples steals samples from the queues of the other
+/// workers. A sample is constructed on the worker thread when it is started and destroyed as soon as it completes, so
+/// that at most one model per worker thread is alive at any time.
+///
+/// The worker threads form an OpenMP parallel region. With OpenMP nested parallelism disabled (the default), the
+/// parallel regions in each sample system run on the calling worker thread only.
+///
+/// While a batch runs, JSON specification files are parsed only once and shared by all samples (see EnableCacheJSON).
+class CH_VEHICLE_API ChVehicleBatch {
+  public:
+    /// Base class for a sample in a simulation batch.
+    class CH_VEHICLE_API Sample {
+      public:
+        virtual ~Sample() {}
+
+        /// Construct the sample model (system, vehicle, terrain, ...).
+        virtual void Construct() = 0;
+
+        /// Advance the sample simulation by one step.
+        /// Return false if the sample simulation is completed.
+        virtual bool Advance() = 0;
+
+        /// Destroy the sample model, once the sample simulation is completed.
+        /// Any results should be extracted here, before releasing the model.
+        virtual void Destroy() {}
+    };
+
+    /// Construct a batch runner using the specified number of worker threads (0: number of processors).
+    ChVehicleBatch(int num_threads = 0);
+
+    /// Add a sample to this batch.
+    void AddSample(std::shared_ptr<Sample> sample);
+
+    /// Get the number of samples in this batch.
+    size_t GetNumSamples() const { return m_samples.size(); }
+
+    /// Get the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Run all samples to completion.
+    /// An exception thrown by a sample is rethrown here, once the workers have completed all other samples.
+    void Run();
+
+    /// Get the wall-clock time of the last run (in seconds).
+    double GetRunTime() const { return m_run_time; }
+
+    /// Get the total number of steps taken in the last run, over all samples.
+    long long GetNumSteps() const { return m_num_steps; }
+
+    /// Get the number of samples stolen by a worker from the queue of another worker in the last run.
+    int GetNumSteals() const { return m_num_steals; }
+
+  private:
+    std::vector<std::shared_ptr<Sample>> m_samples;  ///< samples in this batch
+    int m_num_threads;                               ///< number of worker threads
+    double m_run_time;                               ///< wall-clock time of last run
+    long long m_num_steps;                           ///< number of steps in last run
+    int m_num_steals;                                ///< number of stolen samples in last run
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -113,8 +113,8 @@ std::shared_ptr<ChTriangleMeshShape> ChTire::AddVisualizationMesh(const std::str
     ChQuaternion<> rot = left ? Q_from_AngZ(0) : Q_from_AngZ(CH_C_PI);
     m_vis_mesh_file = left ? mesh_file_left : mesh_file_right;
 
-    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-    trimesh->LoadWavefrontMesh(vehicle::GetDataFile(m_vis_mesh_file), false, false);
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(
+        *geometry::ChTriangleMeshConnected::LoadShared(vehicle::GetDataFile(m_vis_mesh_file), false, false));
     trimesh->Transform(ChVector<>(0, GetOffset(), 0), ChMatrix33<>(rot));
 
     auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
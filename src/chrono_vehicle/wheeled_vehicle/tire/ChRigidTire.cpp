@@ -61,13 +61,14 @@ void ChRigidTire::Initialize(std::shared_ptr<ChWheel> wheel) {
 
     if (m_use_contact_mesh) {
         // Mesh contact
-        m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        m_trimesh->LoadWavefrontMesh(m_contact_meshFile, true, false);
+        m_trimesh = geometry::ChTriangleMeshConnected::LoadShared(m_contact_meshFile, true, false);
 
         //// RADU
         // Hack to deal with current limitation: cannot set offset on a trimesh collision shape!
+        // The offset is applied to a copy, as the loaded mesh is shared.
         double offset = GetOffset();
         if (std::abs(offset) > 1e-3) {
+            m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*m_trimesh);
             for (int i = 0; i < m_trimesh->m_vertices.size(); i++)
                 m_trimesh->m_vertices[i].y() += offset;
         }
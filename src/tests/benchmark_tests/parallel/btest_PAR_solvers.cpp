@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test comparing the Chrono::Parallel NSC solvers on a dense granular
+// packing with a high mass ratio: layers of light spheres settled in a box,
+// loaded by a layer of spheres 1000 times heavier.
+// For each solver, the average number of solver iterations per step is
+// reported (Solver_Iterations) along with the timers.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+// SOLVER:  Chrono::Parallel solver type
+// N:       number of spheres per side of each layer
+template <SolverType SOLVER, int N>
+class PackingTest : public utils::ChBenchmarkTest {
+  public:
+    PackingTest();
+    ~PackingTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_iterations += m_system->data_manager->measures.solver.total_iteration;
+        m_steps++;
+    }
+
+    /// Return the average number of solver iterations per step since the last reset.
+    double GetAverageIterations() const { return m_steps > 0 ? (double)m_iterations / m_steps : 0; }
+
+    void ResetIterations() {
+        m_iterations = 0;
+        m_steps = 0;
+    }
+
+  private:
+    ChSystemParallelNSC* m_system;
+    double m_step;
+    long long m_iterations;
+    int m_steps;
+};
+
+template <SolverType SOLVER, int N>
+PackingTest<SOLVER, N>::PackingTest() : m_system(new ChSystemParallelNSC()), m_step(1e-3), m_iterations(0), m_steps(0) {
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = 1000;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->solver.tolerance = 1e-4;
+    m_system->GetSettings()->solver.tol_speed = 1e-4;
+    m_system->GetSettings()->solver.alpha = 0;
+    m_system->GetSettings()->solver.contact_recovery_speed = 1;
+    m_system->GetSettings()->collision.collision_envelope = 0.005;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    m_system->ChangeSolverType(SOLVER);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    double radius = 0.05;
+    double spacing = 2.01 * radius;
+    double hdim = 0.5 * N * spacing;
+    utils::CreateBoxContainer(m_system, -1, mat, ChVector<>(hdim, hdim, 1), 0.1);
+
+    // Light spheres in the bottom layers, heavy spheres in the top layer
+    int num_layers = 6;
+    for (int il = 0; il < num_layers; il++) {
+        double density = (il == num_layers - 1) ? 1e6 : 1e3;
+        double mass = density * (4.0 / 3.0) * CH_C_PI * radius * radius * radius;
+        for (int ix = 0; ix < N; ix++) {
+            for (int iy = 0; iy < N; iy++) {
+                ChVector<> pos(-hdim + (ix + 0.5) * spacing, -hdim + (iy + 0.5) * spacing, (il + 0.5) * spacing);
+
+                auto ball = std::shared_ptr<ChBody>(m_system->NewBody());
+                ball->SetMass(mass);
+                ball->SetInertiaXX((2.0 / 5.0) * mass * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(pos);
+                ball->SetCollide(true);
+                ball->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(ball.get(), mat, radius);
+                ball->GetCollisionModel()->BuildModel();
+                m_system->AddBody(ball);
+            }
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 100   // number of simulation steps for each benchmark
+
+#define PAR_BM_SOLVER(TEST_NAME, TEST)                                                        \
+    using TEST_NAME = utils::ChBenchmarkFixture<TEST, NUM_SKIP_STEPS>;                        \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                      \
+        m_test->ResetIterations();                                                            \
+        while (st.KeepRunning()) {                                                            \
+            m_test->Simulate(NUM_SIM_STEPS);                                                  \
+        }                                                                                     \
+        Report(st);                                                                           \
+        st.counters["Solver_Iterations"] = m_test->GetAverageIterations();                    \
+        WriteMetrics(#TEST_NAME);                                                             \
+    }                                                                                         \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+using packing_apgd_type = PackingTest<SolverType::APGD, 20>;
+using packing_pdip_type = PackingTest<SolverType::PDIP, 20>;
+using packing_admm_type = PackingTest<SolverType::ADMM, 20>;
+
+PAR_BM_SOLVER(PackingAPGD, packing_apgd_type);
+PAR_BM_SOLVER(PackingPDIP, packing_pdip_type);
+PAR_BM_SOLVER(PackingADMM, packing_admm_type);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
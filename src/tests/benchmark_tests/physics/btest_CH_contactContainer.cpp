@@ -0,0 +1,120 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the per-step cost of the SMC and NSC contact containers.
+// A set of synthetic collision pairs is fed to the contact container at each
+// step (BeginAddContact / AddContact / EndAddContact), after which the contact
+// forces (SMC) or the contact reaction terms (NSC) are loaded in a residual.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+#define NUM_BODIES 1000  // number of bodies among which contacts are distributed
+
+template <typename SYSTEM, typename MATERIAL>
+class ContactContainerTest {
+  public:
+    ContactContainerTest(int num_contacts);
+
+    void ExecuteStep();
+    int GetNumContacts() { return m_system.GetContactContainer()->GetNcontacts(); }
+
+  private:
+    SYSTEM m_system;
+    std::shared_ptr<ChMaterialSurface> m_mat;
+    std::vector<collision::ChCollisionInfo> m_cinfo;
+    ChVectorDynamic<> m_R;
+    ChVectorDynamic<> m_L;
+};
+
+template <typename SYSTEM, typename MATERIAL>
+ContactContainerTest<SYSTEM, MATERIAL>::ContactContainerTest(int num_contacts) {
+    m_mat = chrono_types::make_shared<MATERIAL>();
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int ib = 0; ib < NUM_BODIES; ib++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(ib, 0, 0));
+        body->SetPos_dt(ChVector<>(0, 0, -0.01 * (ib % 7)));
+        m_system.AddBody(body);
+        bodies.push_back(body);
+    }
+    m_system.Setup();
+
+    // Distribute contacts among pairs of bodies, cycling through all bodies
+    m_cinfo.resize(num_contacts);
+    for (int ic = 0; ic < num_contacts; ic++) {
+        int ia = ic % NUM_BODIES;
+        int ib = (ia + 1 + ic / NUM_BODIES) % NUM_BODIES;
+        if (ib == ia)
+            ib = (ia + 1) % NUM_BODIES;
+        auto& cinfo = m_cinfo[ic];
+        cinfo.modelA = bodies[ia]->GetCollisionModel().get();
+        cinfo.modelB = bodies[ib]->GetCollisionModel().get();
+        cinfo.vN = ChVector<>(0, 0, 1);
+        cinfo.distance = -1e-3;
+        cinfo.vpA = bodies[ia]->GetPos() + ChVector<>(0, 0, 0.5);
+        cinfo.vpB = cinfo.vpA + cinfo.distance * cinfo.vN;
+        cinfo.eff_radius = 0.5;
+    }
+}
+
+template <typename SYSTEM, typename MATERIAL>
+void ContactContainerTest<SYSTEM, MATERIAL>::ExecuteStep() {
+    auto container = m_system.GetContactContainer();
+
+    container->BeginAddContact();
+    for (const auto& cinfo : m_cinfo)
+        container->AddContact(cinfo, m_mat, m_mat);
+    container->EndAddContact();
+
+    m_R.setZero(m_system.GetNcoords_w());
+    m_L.setOnes(container->GetDOC_d());
+    container->IntLoadResidual_F(0, m_R, 1.0);
+    container->IntLoadResidual_CqL(0, m_R, m_L, 1.0);
+}
+
+// =============================================================================
+
+template <typename SYSTEM, typename MATERIAL>
+static void ContactContainerStep(benchmark::State& st) {
+    ContactContainerTest<SYSTEM, MATERIAL> test((int)st.range(0));
+
+    // Hot start (allocate all contact objects)
+    test.ExecuteStep();
+
+    for (auto _ : st) {
+        test.ExecuteStep();
+    }
+
+    st.SetItemsProcessed(st.iterations() * test.GetNumContacts());
+    st.counters["Contacts"] = test.GetNumContacts();
+}
+
+static void ContactCounts(benchmark::internal::Benchmark* b) {
+    b->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE(ContactContainerStep, ChSystemSMC, ChMaterialSurfaceSMC)->Apply(ContactCounts);
+BENCHMARK_TEMPLATE(ContactContainerStep, ChSystemNSC, ChMaterialSurfaceNSC)->Apply(ContactCounts);
@@ -13,6 +13,8 @@
 // =============================================================================
 //
 // Benchmark test for contact simulation using NSC contact.
+// The mixer is simulated with the default (sequential) PSOR solver and with the
+// multithreaded (graph-colored) PSOR solver, using different numbers of threads.
 //
 // =============================================================================
 
@@ -22,6 +24,7 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBodyEasy.h"
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChSolverPSOR.h"
 
 #include "chrono/assets/ChColorAsset.h"
 
@@ -33,7 +36,9 @@ using namespace chrono;
 
 // =============================================================================
 
-template <int N>
+// N:           number of sphere, box, and cylinder bodies
+// NUM_THREADS: number of threads for the multithreaded PSOR solver (0: use sequential PSOR solver)
+template <int N, int NUM_THREADS = 0>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
     MixerTestNSC();
@@ -49,8 +54,14 @@ class MixerTestNSC : public utils::ChBenchmarkTest {
     double m_step;
 };
 
-template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+template <int N, int NUM_THREADS>
+MixerTestNSC<N, NUM_THREADS>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+    if (NUM_THREADS > 0) {
+        m_system->SetNumThreads(NUM_THREADS, 1, 1);
+        auto solver = std::static_pointer_cast<ChSolverPSOR>(m_system->GetSolver());
+        solver->EnableMultithreading(true);
+    }
+
     auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
 
     for (int bi = 0; bi < N; bi++) {
@@ -106,8 +117,8 @@ MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->AddLink(motor);
 }
 
-template <int N>
-void MixerTestNSC<N>::SimulateVis() {
+template <int N, int NUM_THREADS>
+void MixerTestNSC<N, NUM_THREADS>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     irrlicht::ChIrrApp application(m_system, L"Rigid contacts", irr::core::dimension2d<irr::u32>(800, 600), false, true);
     application.AddTypicalLogo();
@@ -135,6 +146,20 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+using mixer_128_seq_type = MixerTestNSC<128>;
+using mixer_128_mt01_type = MixerTestNSC<128, 1>;
+using mixer_128_mt02_type = MixerTestNSC<128, 2>;
+using mixer_128_mt04_type = MixerTestNSC<128, 4>;
+using mixer_128_mt08_type = MixerTestNSC<128, 8>;
+using mixer_128_mt16_type = MixerTestNSC<128, 16>;
+
+CH_BM_SIMULATION_LOOP(MixerNSC128, mixer_128_seq_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC128_MT01, mixer_128_mt01_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC128_MT02, mixer_128_mt02_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC128_MT04, mixer_128_mt04_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC128_MT08, mixer_128_mt08_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC128_MT16, mixer_128_mt16_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
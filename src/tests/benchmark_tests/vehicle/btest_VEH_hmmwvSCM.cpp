@@ -77,7 +77,7 @@ class HmmwvScmDriver : public ChDriver {
 
 // =============================================================================
 
-template <int TIRE_TYPE, bool OBJECTS>
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS = 4>
 class HmmwvScmTest : public utils::ChBenchmarkTest {
   public:
     HmmwvScmTest();
@@ -91,6 +91,11 @@ class HmmwvScmTest : public utils::ChBenchmarkTest {
     double GetTime() const { return m_hmmwv->GetSystem()->GetChTime(); }
     double GetLocation() const { return m_hmmwv->GetVehicle().GetVehiclePos().x(); }
 
+    void ResetTimersSCM();
+
+    double m_timer_scm_total;        ///< time for SCM terrain force calculation (ms)
+    double m_timer_scm_ray_casting;  ///< time for SCM ray casting (ms)
+
   private:
     HMMWV_Full* m_hmmwv;
     HmmwvScmDriver* m_driver;
@@ -99,8 +104,9 @@ class HmmwvScmTest : public utils::ChBenchmarkTest {
     double m_step;
 };
 
-template <int TIRE_TYPE, bool OBJECTS>
-HmmwvScmTest<TIRE_TYPE, OBJECTS>::HmmwvScmTest() : m_step(2e-3) {
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS>
+HmmwvScmTest<TIRE_TYPE, OBJECTS, NUM_THREADS>::HmmwvScmTest()
+    : m_step(2e-3), m_timer_scm_total(0), m_timer_scm_ray_casting(0) {
     PowertrainModelType powertrain_model = PowertrainModelType::SHAFTS;
     DrivelineType drive_type = DrivelineType::AWD;
     TireModelType tire_type = (TIRE_TYPE == MESH_TIRE) ? TireModelType::RIGID_MESH : TireModelType::RIGID;
@@ -124,7 +130,7 @@ HmmwvScmTest<TIRE_TYPE, OBJECTS>::HmmwvScmTest() : m_step(2e-3) {
     m_hmmwv->SetWheelVisualizationType(VisualizationType::NONE);
     m_hmmwv->SetTireVisualizationType(tire_vis);
 
-    m_hmmwv->GetSystem()->SetNumThreads(4);
+    m_hmmwv->GetSystem()->SetNumThreads(NUM_THREADS);
 
     // Create the terrain using 4 moving patches
     m_terrain = new SCMDeformableTerrain(m_hmmwv->GetSystem());
@@ -173,15 +179,15 @@ HmmwvScmTest<TIRE_TYPE, OBJECTS>::HmmwvScmTest() : m_step(2e-3) {
     }
 }
 
-template <int TIRE_TYPE, bool OBJECTS>
-HmmwvScmTest<TIRE_TYPE, OBJECTS>::~HmmwvScmTest() {
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS>
+HmmwvScmTest<TIRE_TYPE, OBJECTS, NUM_THREADS>::~HmmwvScmTest() {
     delete m_hmmwv;
     delete m_terrain;
     delete m_driver;
 }
 
-template <int TIRE_TYPE, bool OBJECTS>
-void HmmwvScmTest<TIRE_TYPE, OBJECTS>::ExecuteStep() {
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS>
+void HmmwvScmTest<TIRE_TYPE, OBJECTS, NUM_THREADS>::ExecuteStep() {
     double time = m_hmmwv->GetSystem()->GetChTime();
 
     // Driver inputs
@@ -196,10 +202,22 @@ void HmmwvScmTest<TIRE_TYPE, OBJECTS>::ExecuteStep() {
     m_driver->Advance(m_step);
     m_terrain->Advance(m_step);
     m_hmmwv->Advance(m_step);
+
+    // Accumulate SCM timers
+    m_timer_scm_total += m_terrain->GetTimerMovingPatches() + m_terrain->GetTimerRayCasting() +
+                         m_terrain->GetTimerContactPatches() + m_terrain->GetTimerContactForces() +
+                         m_terrain->GetTimerBulldozing() + m_terrain->GetTimerVisUpdate();
+    m_timer_scm_ray_casting += m_terrain->GetTimerRayCasting();
 }
 
-template <int TIRE_TYPE, bool OBJECTS>
-void HmmwvScmTest<TIRE_TYPE, OBJECTS>::SimulateVis() {
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS>
+void HmmwvScmTest<TIRE_TYPE, OBJECTS, NUM_THREADS>::ResetTimersSCM() {
+    m_timer_scm_total = 0;
+    m_timer_scm_ray_casting = 0;
+}
+
+template <int TIRE_TYPE, bool OBJECTS, int NUM_THREADS>
+void HmmwvScmTest<TIRE_TYPE, OBJECTS, NUM_THREADS>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     ChWheeledVehicleIrrApp app(&m_hmmwv->GetVehicle(), L"HMMWV SMC benchmark");
     app.SetSkyBox();
@@ -239,6 +257,35 @@ CH_BM_SIMULATION_ONCE(HmmwvSCM_CYL_0, cyl_0_test_type, NUM_SKIP_STEPS, NUM_SIM_S
 CH_BM_SIMULATION_ONCE(HmmwvSCM_MESH_1, mesh_1_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvSCM_CYL_1, cyl_1_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 
+// Scaling of the SCM terrain calculation with the number of threads.
+// Besides the usual timers, these tests report the time spent in SCM (total and for ray casting only) and the number
+// of threads used for both the Chrono and the collision system (the latter processes the batch of SCM ray casts).
+#define CH_BM_SCM_THREADS(TEST_NAME, NUM_THREADS)                                                     \
+    using scm_##TEST_NAME = HmmwvScmTest<MESH_TIRE, false, NUM_THREADS>;                            \
+    using TEST_NAME = chrono::utils::ChBenchmarkFixture<scm_##TEST_NAME, 0>;                          \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateOnce)(benchmark::State & st) {                              \
+        Reset(NUM_SKIP_STEPS);                                                                        \
+        m_test->ResetTimersSCM();                                                                     \
+        while (st.KeepRunning()) {                                                                    \
+            m_test->Simulate(NUM_SIM_STEPS);                                                          \
+        }                                                                                             \
+        Report(st);                                                                                   \
+        WriteMetrics(#TEST_NAME);                                                                     \
+        st.counters["Threads"] = NUM_THREADS;                                                         \
+        st.counters["SCM_Total"] = m_test->m_timer_scm_total;                                         \
+        st.counters["SCM_RayCasting"] = m_test->m_timer_scm_ray_casting;                              \
+    }                                                                                                 \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateOnce)                                                     \
+        ->Unit(benchmark::kMillisecond)                                                               \
+        ->Iterations(1)                                                                               \
+        ->Repetitions(REPEATS);
+
+CH_BM_SCM_THREADS(HmmwvSCM_MESH_0_T1, 1);
+CH_BM_SCM_THREADS(HmmwvSCM_MESH_0_T2, 2);
+CH_BM_SCM_THREADS(HmmwvSCM_MESH_0_T4, 4);
+CH_BM_SCM_THREADS(HmmwvSCM_MESH_0_T8, 8);
+CH_BM_SCM_THREADS(HmmwvSCM_MESH_0_T16, 16);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -12,7 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// Benchmark test for M113 acceleration test.
+// Benchmark test for M113 acceleration test, with and without pooled track shoe
+// connections.
 //
 // =============================================================================
 
@@ -38,7 +39,7 @@ using namespace chrono::vehicle::m113;
 
 // =============================================================================
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
+template <typename EnumClass, EnumClass SHOE_TYPE, bool POOLED>
 class M113AccTest : public utils::ChBenchmarkTest {
 public:
     M113AccTest();
@@ -60,14 +61,16 @@ private:
     double m_step;
 };
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool POOLED>
+M113AccTest<EnumClass, SHOE_TYPE, POOLED>::M113AccTest() : m_step(1e-3) {
     BrakeType brake_type = BrakeType::SIMPLE;
     ChContactMethod contact_method = ChContactMethod::NSC;
     CollisionType chassis_collision_type = CollisionType::NONE;
 
     // Create the M113 vehicle, set parameters, and initialize.
     m_m113 = new M113_Vehicle(false, SHOE_TYPE, brake_type, contact_method, chassis_collision_type);
+    m_m113->GetTrackAssembly(LEFT)->UseConnectionPool(POOLED);
+    m_m113->GetTrackAssembly(RIGHT)->UseConnectionPool(POOLED);
     m_m113->Initialize(ChCoordsys<>(ChVector<>(-250 + 5, 0, 1.1), ChQuaternion<>(1, 0, 0, 0)));
 
     m_m113->SetChassisVisualizationType(VisualizationType::NONE);
@@ -114,15 +117,15 @@ M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
     m_shoeR.resize(m_m113->GetNumTrackShoes(RIGHT));
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::~M113AccTest() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool POOLED>
+M113AccTest<EnumClass, SHOE_TYPE, POOLED>::~M113AccTest() {
     delete m_m113;
     delete m_terrain;
     delete m_driver;
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool POOLED>
+void M113AccTest<EnumClass, SHOE_TYPE, POOLED>::ExecuteStep() {
     double time = m_m113->GetChTime();
 
     if (time < 0.5) {
@@ -145,8 +148,8 @@ void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
     m_m113->Advance(m_step);
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool POOLED>
+void M113AccTest<EnumClass, SHOE_TYPE, POOLED>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     ChTrackedVehicleIrrApp app(m_m113, L"M113 acceleration test");
     app.SetSkyBox();
@@ -176,11 +179,15 @@ void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
 #define REPEATS 10
 
 // NOTE: trick to prevent erros in expanding macros due to types that contain a comma.
-typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN> sp_test_type;
-typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN> dp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, false> sp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, false> dp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, true> sp_pool_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, true> dp_pool_test_type;
 
 CH_BM_SIMULATION_LOOP(M113Acc_SP, sp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_LOOP(M113Acc_DP, dp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113Acc_SP_pool, sp_pool_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113Acc_DP_pool, dp_pool_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 
 // =============================================================================
 
@@ -189,8 +196,8 @@ int main(int argc, char* argv[]) {
 
 #ifdef CHRONO_IRRLICHT
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
-        M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN> test;
-        ////M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN> test;
+        M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, false> test;
+        ////M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, false> test;
         test.SimulateVis();
         return 0;
     }
@@ -22,6 +22,10 @@
 
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
 
 #include "gtest/gtest.h"
 
@@ -77,3 +81,65 @@ TEST(SparseMatrix, pattern_learner) {
 	
 
 }
+
+// ------------------------------------------------------------------
+
+TEST(SparseMatrix, parallel_assembly) {
+    // Chain of variables, coupled by overlapping stiffness blocks and by constraints.
+    const int n = 20;
+    std::vector<ChVariablesGeneric> variables(n, ChVariablesGeneric(3));
+    std::vector<ChKblockGeneric> kblocks(n - 1);
+    std::vector<ChConstraintTwoGeneric> constraints(n - 1);
+
+    ChSystemDescriptor sysd;
+    sysd.SetNumThreads(4);
+    sysd.BeginInsertion();
+    for (int i = 0; i < n; i++) {
+        variables[i].GetMass().setIdentity();
+        variables[i].GetMass() *= 1.0 + i;
+        sysd.InsertVariables(&variables[i]);
+    }
+    for (int i = 0; i < n - 1; i++) {
+        kblocks[i].SetVariables({&variables[i], &variables[i + 1]});
+        kblocks[i].Get_K().setConstant(0.1 * i);
+        sysd.InsertKblock(&kblocks[i]);
+        constraints[i].SetVariables(&variables[i], &variables[i + 1]);
+        constraints[i].Get_Cq_a().setConstant(1.0);
+        constraints[i].Get_Cq_b().setConstant(-1.0 - i);
+        constraints[i].Set_cfm_i(1e-3 * i);
+        sysd.InsertConstraint(&constraints[i]);
+    }
+    sysd.EndInsertion();
+
+    ChSparseMatrix Z_serial;
+    sysd.ConvertToMatrixForm(&Z_serial, nullptr);
+    Z_serial.makeCompressed();
+
+    ChAssemblySlots slots;
+    ASSERT_TRUE(sysd.LearnAssemblySlots(Z_serial, slots));
+
+    // Change the values, but not the structure, then assemble both ways.
+    for (int i = 0; i < n - 1; i++) {
+        kblocks[i].Get_K().setConstant(0.2 * i);
+        constraints[i].Get_Cq_b().setConstant(2.0 + i);
+    }
+
+    ChSparseMatrix Z_parallel = Z_serial;
+    ASSERT_TRUE(sysd.ConvertToMatrixFormParallel(Z_parallel, slots));
+    sysd.ConvertToMatrixForm(&Z_serial, nullptr);
+
+    ASSERT_EQ(Z_serial.nonZeros(), Z_parallel.nonZeros());
+    for (int i = 0; i < Z_serial.nonZeros(); i++) {
+        ASSERT_EQ(Z_serial.innerIndexPtr()[i], Z_parallel.innerIndexPtr()[i]);
+        ASSERT_NEAR(Z_serial.valuePtr()[i], Z_parallel.valuePtr()[i], precision);
+    }
+
+    // A change in the system structure is detected, even if all blocks keep the same number of elements.
+    constraints[0].SetVariables(&variables[0], &variables[2]);
+    ASSERT_FALSE(sysd.ConvertToMatrixFormParallel(Z_parallel, slots));
+
+    constraints[0].SetVariables(&variables[0], &variables[1]);
+    constraints[0].SetActive(false);
+    sysd.UpdateCountsAndOffsets();
+    ASSERT_FALSE(sysd.ConvertToMatrixFormParallel(Z_parallel, slots));
+}
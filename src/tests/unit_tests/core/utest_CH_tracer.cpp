@@ -0,0 +1,69 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the tracing profiler (ChTracer).
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChTracer.h"
+
+using namespace chrono::utils;
+
+TEST(ChTracer, disabled) {
+    ChTracer::Enable(false);
+    ChTracer::Clear();
+    {
+        CH_TRACE("disabled");
+    }
+    ASSERT_EQ(ChTracer::GetNumEvents(), 0u);
+}
+
+TEST(ChTracer, nested) {
+    ChTracer::Enable();
+    ChTracer::Clear();
+    {
+        CH_TRACE("outer");
+        for (int i = 0; i < 3; i++) {
+            CH_TRACE("inner");
+        }
+    }
+    ChTracer::Enable(false);
+    ASSERT_EQ(ChTracer::GetNumEvents(), 4u);
+}
+
+TEST(ChTracer, chrome_trace) {
+    ChTracer::Enable();
+    ChTracer::Clear();
+    {
+        CH_TRACE("step");
+    }
+    {
+        CH_TRACE(ChTracer::Intern("quoted \"name\""));
+    }
+    ChTracer::Enable(false);
+
+    ASSERT_TRUE(ChTracer::WriteChromeTrace("tracer_test.json"));
+
+    std::ifstream file("tracer_test.json");
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string json = buffer.str();
+
+    ASSERT_NE(json.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(json.find("{\"name\":\"step\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"quoted \\\"name\\\"\""), std::string::npos);
+}
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the shared triangle mesh cache and the binary mesh format.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+static const char* obj_file = "trimesh_cache_test.obj";
+static const char* obj_copy_file = "trimesh_cache_test_copy.obj";
+static const char* bin_file = "trimesh_cache_test.chmesh";
+
+// Write a unit cube, with per-face normals, as a Wavefront OBJ file.
+static void WriteCube(const char* filename) {
+    std::ofstream ofile(filename);
+    ofile << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\nv 1 0 1\nv 1 1 1\nv 0 1 1\n";
+    ofile << "vn 0 0 -1\nvn 0 0 1\nvn 0 -1 0\nvn 0 1 0\nvn -1 0 0\nvn 1 0 0\n";
+    ofile << "f 1//1 3//1 2//1\nf 1//1 4//1 3//1\nf 5//2 6//2 7//2\nf 5//2 7//2 8//2\n";
+    ofile << "f 1//3 2//3 6//3\nf 1//3 6//3 5//3\nf 4//4 8//4 7//4\nf 4//4 7//4 3//4\n";
+    ofile << "f 1//5 5//5 8//5\nf 1//5 8//5 4//5\nf 2//6 3//6 7//6\nf 2//6 7//6 6//6\n";
+}
+
+static void CheckEqual(const ChTriangleMeshConnected& m1, const ChTriangleMeshConnected& m2) {
+    ASSERT_EQ(m1.m_vertices.size(), m2.m_vertices.size());
+    ASSERT_EQ(m1.m_normals.size(), m2.m_normals.size());
+    ASSERT_EQ(m1.m_face_v_indices.size(), m2.m_face_v_indices.size());
+    ASSERT_EQ(m1.m_face_n_indices.size(), m2.m_face_n_indices.size());
+    for (size_t i = 0; i < m1.m_vertices.size(); i++)
+        ASSERT_TRUE(m1.m_vertices[i].Equals(m2.m_vertices[i]));
+    for (size_t i = 0; i < m1.m_normals.size(); i++)
+        ASSERT_TRUE(m1.m_normals[i].Equals(m2.m_normals[i]));
+    for (size_t i = 0; i < m1.m_face_v_indices.size(); i++)
+        ASSERT_TRUE(m1.m_face_v_indices[i] == m2.m_face_v_indices[i]);
+    for (size_t i = 0; i < m1.m_face_n_indices.size(); i++)
+        ASSERT_TRUE(m1.m_face_n_indices[i] == m2.m_face_n_indices[i]);
+}
+
+TEST(ChTriangleMeshConnected, shared) {
+    WriteCube(obj_file);
+    WriteCube(obj_copy_file);
+
+    ChTriangleMeshConnected mesh;
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(obj_file, true, false));
+    ASSERT_EQ(mesh.getNumTriangles(), 12);
+
+    // Files with identical contents and flags share the same mesh
+    auto shared1 = ChTriangleMeshConnected::LoadShared(obj_file, true, false);
+    auto shared2 = ChTriangleMeshConnected::LoadShared(obj_copy_file, true, false);
+    ASSERT_EQ(shared1, shared2);
+    CheckEqual(*shared1, mesh);
+
+    // Different flags result in a different mesh
+    auto shared3 = ChTriangleMeshConnected::LoadShared(obj_file, false, false);
+    ASSERT_NE(shared3, shared1);
+    ASSERT_EQ(shared3->m_normals.size(), 0);
+
+    // Cleared meshes remain valid, but are no longer returned
+    ChTriangleMeshConnected::ClearSharedMeshes();
+    ASSERT_EQ(shared1->getNumTriangles(), 12);
+    ASSERT_NE(ChTriangleMeshConnected::LoadShared(obj_file, true, false), shared1);
+
+    // A missing file results in an empty mesh
+    auto missing = ChTriangleMeshConnected::LoadShared("missing_file.obj");
+    ASSERT_EQ(missing->getNumTriangles(), 0);
+
+    std::remove(obj_file);
+    std::remove(obj_copy_file);
+}
+
+TEST(ChTriangleMeshConnected, binary) {
+    WriteCube(obj_file);
+    ChTriangleMeshConnected mesh;
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(obj_file, true, false));
+    ASSERT_TRUE(mesh.WriteBinaryMesh(bin_file));
+
+    ChTriangleMeshConnected loaded;
+    ASSERT_TRUE(loaded.LoadBinaryMesh(bin_file));
+    CheckEqual(loaded, mesh);
+
+    // Binary files are recognized by LoadShared
+    auto shared = ChTriangleMeshConnected::LoadShared(bin_file, true, false);
+    CheckEqual(*shared, mesh);
+
+    // An OBJ file is not a binary mesh file
+    ASSERT_FALSE(loaded.LoadBinaryMesh(obj_file));
+
+    // A truncated binary file is rejected
+    {
+        std::ifstream ifile(bin_file, std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(ifile)), std::istreambuf_iterator<char>());
+        std::ofstream ofile(bin_file, std::ios::binary);
+        ofile.write(contents.data(), contents.size() - 16);
+    }
+    ASSERT_FALSE(loaded.LoadBinaryMesh(bin_file));
+    ASSERT_EQ(ChTriangleMeshConnected::LoadShared(bin_file)->getNumTriangles(), 0);
+
+    std::remove(obj_file);
+    std::remove(bin_file);
+}
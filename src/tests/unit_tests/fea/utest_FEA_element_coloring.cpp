@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test the element coloring of a mesh and the parallel loading of element
+// contributions (internal and gravity forces, M*v products) into global vectors.
+//
+// =============================================================================
+
+#include <cmath>
+#include <set>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChElementColoring.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Spokes of two cable elements each, all attached to a common hub node.
+// The hub is shared by more elements than the maximum number of colors.
+class ElementColoringTest : public ::testing::Test {
+  protected:
+    ElementColoringTest() : num_spokes(70) {
+        mesh = chrono_types::make_shared<ChMesh>();
+        auto section = chrono_types::make_shared<ChBeamSectionCable>();
+        section->SetDiameter(0.01);
+        section->SetYoungModulus(1e8);
+
+        auto hub = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(hub);
+        for (int k = 0; k < num_spokes; k++) {
+            double angle = k * CH_C_2PI / num_spokes;
+            ChVector<> dir(std::cos(angle), std::sin(angle), 0);
+            auto mid = chrono_types::make_shared<ChNodeFEAxyzD>(0.5 * dir, dir);
+            auto end = chrono_types::make_shared<ChNodeFEAxyzD>(1.0 * dir, dir);
+            mesh->AddNode(mid);
+            mesh->AddNode(end);
+            auto element1 = chrono_types::make_shared<ChElementCableANCF>();
+            element1->SetNodes(hub, mid);
+            element1->SetSection(section);
+            mesh->AddElement(element1);
+            auto element2 = chrono_types::make_shared<ChElementCableANCF>();
+            element2->SetNodes(mid, end);
+            element2->SetSection(section);
+            mesh->AddElement(element2);
+        }
+
+        system.Add(mesh);
+        system.Setup();
+        system.Update();
+
+        // Deform the spokes, so that internal forces are not zero.
+        for (unsigned int in = 0; in < mesh->GetNnodes(); in++) {
+            auto node = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNodes()[in]);
+            node->SetPos(node->GetPos() * 1.01 + ChVector<>(0, 0, 0.01 * in));
+            node->SetPos_dt(ChVector<>(0.1, 0, -0.1 * in));
+        }
+    }
+
+    // Load all element contributions with the given number of threads and load mode.
+    ChVectorDynamic<> Load(int nthreads, ChMesh::ParallelLoadMode mode) {
+        system.SetNumThreads(nthreads);
+        mesh->SetParallelLoadMode(mode);
+        ChVectorDynamic<> w = ChVectorDynamic<>::LinSpaced(system.GetNcoords_w(), 0.0, 1.0);
+        ChVectorDynamic<> R = ChVectorDynamic<>::Zero(system.GetNcoords_w());
+        mesh->IntLoadResidual_F(0, R, 0.5);
+        mesh->IntLoadResidual_Mv(0, R, w, 2.0);
+        return R;
+    }
+
+    int num_spokes;
+    ChSystemSMC system;
+    std::shared_ptr<ChMesh> mesh;
+};
+
+TEST_F(ElementColoringTest, coloring) {
+    ChElementColoring coloring;
+    coloring.Update(mesh->GetElements());
+
+    ASSERT_EQ(coloring.GetNumColors(), ChElementColoring::max_colors);
+    ASSERT_EQ(coloring.GetElements().size() + coloring.GetSequentialElements().size(), mesh->GetNelements());
+    ASSERT_EQ(coloring.GetSequentialElements().size(), (size_t)(num_spokes - ChElementColoring::max_colors));
+
+    // No two elements of the same color share a node.
+    for (int color = 0; color < coloring.GetNumColors(); color++) {
+        std::set<ChNodeFEAbase*> nodes;
+        for (unsigned int i = coloring.GetColorStart(color); i < coloring.GetColorEnd(color); i++) {
+            auto element = mesh->GetElement(coloring.GetElements()[i]);
+            for (int in = 0; in < element->GetNnodes(); in++)
+                ASSERT_TRUE(nodes.insert(element->GetNodeN(in).get()).second);
+        }
+    }
+}
+
+TEST_F(ElementColoringTest, parallel_load) {
+    ChVectorDynamic<> R_serial = Load(1, ChMesh::ParallelLoadMode::AUTOMATIC);
+    ChVectorDynamic<> R_coloring = Load(4, ChMesh::ParallelLoadMode::COLORING);
+    ChVectorDynamic<> R_buffers = Load(4, ChMesh::ParallelLoadMode::THREAD_BUFFERS);
+
+    ASSERT_GT(R_serial.norm(), 0.0);
+    ASSERT_NEAR((R_coloring - R_serial).norm(), 0.0, 1e-10 * R_serial.norm());
+    ASSERT_NEAR((R_buffers - R_serial).norm(), 0.0, 1e-10 * R_serial.norm());
+}
@@ -0,0 +1,183 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// ChronoParallel unit test for the SMC contact history. Balls slide on a ground
+// body, each ball touching only the ground. The contact history of a body with
+// many neighbors must be kept for all of its contacts, and a small scene must
+// give the same results as with the previous per-body history table.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a system with balls sliding on a fixed box. The ground is created last, so that it is the body with the
+// largest index in all contacts.
+ChSystemParallelSMC* CreateSystem(ChSystemSMC::TangentialDisplacementModel tdispl_model,
+                                  const std::vector<ChVector<>>& init_vel,
+                                  const std::vector<ChVector<>>& init_omg) {
+    ChSystemParallelSMC* system = new ChSystemParallelSMC;
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    system->GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    system->GetSettings()->solver.tangential_displ_mode = tdispl_model;
+    system->GetSettings()->solver.use_material_properties = false;
+    system->GetSettings()->collision.collision_envelope = 0.01;
+    system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 2);
+    system->SetNumThreads(1);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    material->SetFriction(0.3f);
+    material->SetRestitution(0);
+    material->SetKn(2e5f);
+    material->SetGn(40);
+    material->SetKt(2e5f);
+    material->SetGt(20);
+
+    // Balls on a regular grid, far enough apart to never touch each other
+    double mass = 1;
+    double radius = 0.1;
+    int num_balls = (int)init_vel.size();
+    int num_rows = (num_balls + 5) / 6;
+    for (int i = 0; i < num_balls; i++) {
+        std::shared_ptr<ChBody> ball(system->NewBody());
+        ball->SetMass(mass);
+        ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+        ball->SetPos(ChVector<>(0.5 * (i % 6) - 1.25, 0.5 * (i / 6) - 0.25 * (num_rows - 1), radius - 5e-5));
+        ball->SetPos_dt(init_vel[i]);
+        ball->SetWvel_par(init_omg[i]);
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(material, radius);
+        ball->GetCollisionModel()->BuildModel();
+        system->AddBody(ball);
+    }
+
+    std::shared_ptr<ChBody> ground(system->NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(material, 3, 3, 0.1);
+    ground->GetCollisionModel()->BuildModel();
+    system->AddBody(ground);
+
+    return system;
+}
+
+// -----------------------------------------------------------------------------
+
+// More balls on the ground than the previous limit of 20 history entries per body. With identical initial conditions,
+// all balls must move in the same way, and the history of each contact must persist over all steps.
+TEST(ChronoParallel, contact_history_neighbors) {
+    int num_balls = 30;
+    std::vector<ChVector<>> init_vel(num_balls, ChVector<>(1, 0.5, 0));
+    std::vector<ChVector<>> init_omg(num_balls, ChVector<>(0, 0, 0));
+    ChSystemParallelSMC* system = CreateSystem(ChSystemSMC::MultiStep, init_vel, init_omg);
+
+    std::vector<ChVector<>> init_pos(num_balls);
+    for (int i = 0; i < num_balls; i++)
+        init_pos[i] = system->Get_bodylist()[i]->GetPos();
+
+    double time_step = 1e-4;
+    int num_steps = 1000;
+    for (int step = 0; step < num_steps; step++) {
+        system->DoStepDynamics(time_step);
+
+        // One history entry per contact
+        ASSERT_EQ(system->data_manager->num_rigid_contacts, (uint)num_balls);
+        ASSERT_EQ(system->data_manager->host_data.shear_keys.size(), (size_t)num_balls);
+    }
+
+    // All contacts were found in the history at every step after the first one
+    const auto& shear_disp = system->data_manager->host_data.shear_disp;
+    const auto& contact_duration = system->data_manager->host_data.contact_duration;
+    for (int i = 0; i < num_balls; i++) {
+        ASSERT_NEAR(contact_duration[i], (num_steps - 1) * time_step, 1e-9);
+        ASSERT_GT(Length(shear_disp[i]), 0);
+    }
+
+    // Up to round-off in the contact geometry, all balls are in the same state
+    auto ball0 = system->Get_bodylist()[0];
+    for (int i = 1; i < num_balls; i++) {
+        auto ball = system->Get_bodylist()[i];
+        ASSERT_NEAR(((ball->GetPos() - init_pos[i]) - (ball0->GetPos() - init_pos[0])).Length(), 0, 1e-9);
+        ASSERT_NEAR((ball->GetPos_dt() - ball0->GetPos_dt()).Length(), 0, 1e-9);
+        ASSERT_NEAR((ball->GetWvel_par() - ball0->GetWvel_par()).Length(), 0, 1e-9);
+    }
+
+    delete system;
+}
+
+// -----------------------------------------------------------------------------
+
+// Balls sliding, rolling, and bouncing in different directions. The final ball states must match those obtained with
+// the previous per-body contact history table (exact for bodies with at most 20 neighbors, as is the ground here).
+void CheckRegression(ChSystemSMC::TangentialDisplacementModel tdispl_model, const double ref[][6]) {
+    std::vector<ChVector<>> init_vel = {ChVector<>(1, 0, 0),  ChVector<>(0, 1, 0),   ChVector<>(-0.5, 0.5, 0),
+                                        ChVector<>(0, 0, -1), ChVector<>(0.2, 0, 0), ChVector<>(-1, -1, 0)};
+    std::vector<ChVector<>> init_omg = {ChVector<>(0, 0, 0),  ChVector<>(5, 0, 0),   ChVector<>(0, 0, 10),
+                                        ChVector<>(0, 20, 0), ChVector<>(0, -10, 0), ChVector<>(-3, 3, 0)};
+    ChSystemParallelSMC* system = CreateSystem(tdispl_model, init_vel, init_omg);
+
+    double time_step = 1e-4;
+    int num_steps = 2000;
+    for (int step = 0; step < num_steps; step++)
+        system->DoStepDynamics(time_step);
+
+    // Each ball only touches the ground and the motion is smooth, so the only differences are round-off errors
+    double tolerance = 1e-8;
+    for (int i = 0; i < (int)init_vel.size(); i++) {
+        auto ball = system->Get_bodylist()[i];
+        ChVector<> pos = ball->GetPos();
+        ChVector<> vel = ball->GetPos_dt();
+        ASSERT_NEAR(pos.x(), ref[i][0], tolerance);
+        ASSERT_NEAR(pos.y(), ref[i][1], tolerance);
+        ASSERT_NEAR(pos.z(), ref[i][2], tolerance);
+        ASSERT_NEAR(vel.x(), ref[i][3], tolerance);
+        ASSERT_NEAR(vel.y(), ref[i][4], tolerance);
+        ASSERT_NEAR(vel.z(), ref[i][5], tolerance);
+    }
+
+    delete system;
+}
+
+TEST(ChronoParallel, contact_history_onestep) {
+    const double ref[6][6] = {
+        {-1.0931568955, 0, 0.0999509419435, 0.714285910287, 0, 5.7326685389e-05},
+        {-0.75, 0.145601166185, 0.0999509419435, 0, 0.571461592249, 5.7326685389e-05},
+        {-0.326417599916, 0.0764175999159, 0.0999509419435, -0.357142864029, 0.357142864029, 5.7326685389e-05},
+        {0.305040942591, 0, 0.0979642223167, 0.357857035179, 0, -0.144386553789},
+        {0.741514706319, 0, 0.0999509419435, -0.142855616544, 0, 5.7326685389e-05},
+        {1.09107106184, -0.158928938157, 0.0999509419435, -0.62931977621, -0.62931977621, 5.7326685389e-05},
+    };
+    CheckRegression(ChSystemSMC::OneStep, ref);
+}
+
+TEST(ChronoParallel, contact_history_multistep) {
+    const double ref[6][6] = {
+        {-1.09329273347, 0, 0.0999509419435, 0.714854502458, 0, 5.7326685389e-05},
+        {-0.75, 0.145464902423, 0.0999509419435, 0, 0.570078878991, 5.7326685389e-05},
+        {-0.326321433124, 0.0763214331239, 0.0999509419435, -0.357151386956, 0.357151386956, 5.7326685389e-05},
+        {0.367967050462, 0, 0.0979642223167, 0.546111389359, 0, -0.144386553789},
+        {0.741378871059, 0, 0.0999509419435, -0.143452348516, 0, 5.7326685389e-05},
+        {1.09115898082, -0.158841019185, 0.0999509419435, -0.629835392559, -0.629835392559, 5.7326685389e-05},
+    };
+    CheckRegression(ChSystemSMC::MultiStep, ref);
+}
@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// ChronoParallel unit test for instanced triangle meshes. Balls slide over two
+// bodies sharing one triangle mesh. With mesh instancing (BVH mid-phase), the
+// contacts, the SMC contact history, and the body states must match those
+// obtained with one collision shape per mesh triangle (up to round-off).
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// -----------------------------------------------------------------------------
+
+// Create a bumpy terrain patch, as a triangle mesh on a regular grid.
+std::shared_ptr<geometry::ChTriangleMeshConnected> CreateTerrainMesh() {
+    int n = 12;
+    double size = 3;
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    auto& vertices = trimesh->getCoordsVertices();
+    auto& faces = trimesh->getIndicesVertexes();
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            double x = size * i / n - size / 2;
+            double y = size * j / n - size / 2;
+            vertices.push_back(ChVector<>(x, y, 0.05 * std::sin(2 * x) * std::cos(2 * y)));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v = i * (n + 1) + j;
+            faces.push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            faces.push_back(ChVector<int>(v, v + n + 2, v + 1));
+        }
+    }
+    return trimesh;
+}
+
+// Create a system with two fixed bodies sharing the terrain mesh and balls sliding over them.
+ChSystemParallelSMC* CreateSystem(std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh, bool instancing) {
+    ChSystemParallelSMC* system = new ChSystemParallelSMC;
+    system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    system->GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    system->GetSettings()->solver.tangential_displ_mode = ChSystemSMC::MultiStep;
+    system->GetSettings()->solver.use_material_properties = false;
+    system->GetSettings()->collision.collision_envelope = 0.01;
+    system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    system->GetSettings()->collision.use_mesh_instancing = instancing;
+    system->SetNumThreads(1);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    material->SetFriction(0.4f);
+    material->SetRestitution(0);
+    material->SetKn(2e5f);
+    material->SetGn(600);
+    material->SetKt(2e5f);
+    material->SetGt(20);
+
+    // The second body is rotated; the mesh is offset in the collision model of the first one
+    for (int k = 0; k < 2; k++) {
+        std::shared_ptr<ChBody> ground(system->NewBody());
+        ground->SetBodyFixed(true);
+        ground->SetCollide(true);
+        ground->SetPos(ChVector<>(3.5 * k, 0, 0));
+        ground->SetRot(Q_from_AngZ(0.5 * k));
+        ground->GetCollisionModel()->ClearModel();
+        ground->GetCollisionModel()->AddTriangleMesh(material, trimesh, true, false, ChVector<>(0, 0, 0.02 * (1 - k)));
+        ground->GetCollisionModel()->BuildModel();
+        system->AddBody(ground);
+    }
+
+    double mass = 1;
+    double radius = 0.15;
+    for (int k = 0; k < 2; k++) {
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++) {
+                std::shared_ptr<ChBody> ball(system->NewBody());
+                ball->SetMass(mass);
+                ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(ChVector<>(3.5 * k + 0.6 * i, 0.6 * j, 0.25));
+                ball->SetPos_dt(ChVector<>(0.5, 0.3 * j, 0));
+                ball->SetCollide(true);
+                ball->GetCollisionModel()->ClearModel();
+                ball->GetCollisionModel()->AddSphere(material, radius);
+                ball->GetCollisionModel()->BuildModel();
+                system->AddBody(ball);
+            }
+        }
+    }
+
+    return system;
+}
+
+// -----------------------------------------------------------------------------
+
+// Check that the contacts of the two systems match, regardless of their order. Contacts are identified by the pair of
+// bodies and the contact point on the first one; matching contacts must have the same normal and depth. A contact
+// missing in the other system is only accepted if it is at the detection threshold (2 x envelope).
+void CompareContacts(ChSystemParallelSMC* system_T, ChSystemParallelSMC* system_M, double tolerance) {
+    const auto& data_T = system_T->data_manager->host_data;
+    const auto& data_M = system_M->data_manager->host_data;
+    uint num_contacts_T = system_T->data_manager->num_rigid_contacts;
+    uint num_contacts_M = system_M->data_manager->num_rigid_contacts;
+    double threshold = 2 * system_T->GetSettings()->collision.collision_envelope;
+
+    std::vector<bool> matched(num_contacts_M, false);
+    uint num_matched = 0;
+    for (uint i = 0; i < num_contacts_T; i++) {
+        int match = -1;
+        for (uint j = 0; j < num_contacts_M; j++) {
+            if (matched[j] || data_M.bids_rigid_rigid[j].x != data_T.bids_rigid_rigid[i].x ||
+                data_M.bids_rigid_rigid[j].y != data_T.bids_rigid_rigid[i].y)
+                continue;
+            if (Length(data_M.cpta_rigid_rigid[j] - data_T.cpta_rigid_rigid[i]) < tolerance &&
+                Length(data_M.norm_rigid_rigid[j] - data_T.norm_rigid_rigid[i]) < tolerance &&
+                std::abs(data_M.dpth_rigid_rigid[j] - data_T.dpth_rigid_rigid[i]) < tolerance) {
+                match = j;
+                break;
+            }
+        }
+        if (match >= 0) {
+            matched[match] = true;
+            num_matched++;
+        } else {
+            ASSERT_NEAR(data_T.dpth_rigid_rigid[i], threshold, tolerance);
+        }
+    }
+    for (uint j = 0; j < num_contacts_M; j++) {
+        if (!matched[j])
+            ASSERT_NEAR(data_M.dpth_rigid_rigid[j], threshold, tolerance);
+    }
+}
+
+TEST(ChronoParallel, mesh_instancing) {
+    auto trimesh = CreateTerrainMesh();
+    int num_triangles = trimesh->getNumTriangles();
+
+    ChSystemParallelSMC* system_T = CreateSystem(trimesh, false);
+    ChSystemParallelSMC* system_M = CreateSystem(trimesh, true);
+
+    // One shape per ball and per mesh triangle, or one shape per ball and per mesh
+    int num_bodies = (int)system_T->Get_bodylist().size();
+    ASSERT_EQ(system_T->data_manager->num_rigid_shapes, (uint)(2 * num_triangles + num_bodies - 2));
+    ASSERT_EQ(system_M->data_manager->num_rigid_shapes, (uint)num_bodies);
+
+    // Both systems start each step from the same body states. The mesh triangles are transformed in a different order
+    // (to the body frame when the shapes are created, or from the mesh frame during collision detection), so contacts
+    // and states after one step only differ by round-off errors.
+    double time_step = 1e-3;
+    int num_steps = 1000;
+    double tolerance = 1e-9;
+    int max_contacts = 0;
+
+    for (int step = 0; step < num_steps; step++) {
+        system_T->DoStepDynamics(time_step);
+        system_M->DoStepDynamics(time_step);
+
+        // The mid-phase must find all contacts found with individual triangle shapes, and the contact history must
+        // have one entry per ball and triangle in contact
+        ASSERT_NO_FATAL_FAILURE(CompareContacts(system_T, system_M, tolerance));
+        ASSERT_EQ(system_M->data_manager->host_data.shear_keys.size(),
+                  system_T->data_manager->host_data.shear_keys.size());
+        max_contacts = std::max(max_contacts, (int)system_T->data_manager->num_rigid_contacts);
+
+        for (int i = 2; i < num_bodies; i++) {
+            auto body_T = system_T->Get_bodylist()[i];
+            auto body_M = system_M->Get_bodylist()[i];
+            ASSERT_NEAR((body_T->GetPos() - body_M->GetPos()).Length(), 0, tolerance);
+            ASSERT_NEAR((body_T->GetPos_dt() - body_M->GetPos_dt()).Length(), 0, tolerance);
+            ASSERT_NEAR((body_T->GetWvel_par() - body_M->GetWvel_par()).Length(), 0, tolerance);
+
+            // Remove the round-off differences before the next step
+            body_M->SetPos(body_T->GetPos());
+            body_M->SetRot(body_T->GetRot());
+            body_M->SetPos_dt(body_T->GetPos_dt());
+            body_M->SetWvel_par(body_T->GetWvel_par());
+        }
+    }
+
+    // All balls are in contact with the terrain, some of them with more than one triangle
+    ASSERT_GT(max_contacts, num_bodies - 2);
+
+    // No ball fell through the terrain
+    for (int i = 2; i < num_bodies; i++)
+        ASSERT_GT(system_M->Get_bodylist()[i]->GetPos().z(), 0);
+
+    delete system_T;
+    delete system_M;
+}
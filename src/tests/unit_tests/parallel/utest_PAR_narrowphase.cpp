@@ -13,14 +13,19 @@
 // =============================================================================
 //
 // ChronoParallel unit test to compare solutions from different narrowphase
-// algorithms.
+// algorithms, and contacts found with and without the sorted narrowphase.
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "chrono_parallel/physics/ChSystemParallel.h"
 #include "chrono_parallel/solver/ChSystemDescriptorParallel.h"
 
 #include "chrono/ChConfig.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
 #include "chrono/utils/ChUtilsCreators.h"
 #include "chrono/utils/ChUtilsGenerators.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
@@ -204,7 +209,178 @@ bool CompareContacts(ChSystemParallel* msystem_A, ChSystemParallel* msystem_B) {
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// Sorted narrowphase
+// -----------------------------------------------------------------------------
+
+// Create a mix of spheres, boxes, and capsules above a bumpy terrain made of triangle shapes.
+void CreateMixedScene(ChSystemParallelNSC* sys) {
+    sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys->GetSettings()->solver.tolerance = 1e-2;
+    sys->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    sys->GetSettings()->solver.max_iteration_normal = 0;
+    sys->GetSettings()->solver.max_iteration_sliding = 25;
+    sys->GetSettings()->solver.max_iteration_spinning = 0;
+    sys->ChangeSolverType(SolverType::APGD);
+    sys->GetSettings()->collision.collision_envelope = 0.01;
+    sys->GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    sys->GetSettings()->collision.narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
+    sys->SetNumThreads(1);
+
+    CreateContainer(sys);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    // Terrain: one TRIANGLE shape per triangle of a height field
+    int n = 6;
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    auto& vertices = trimesh->getCoordsVertices();
+    auto& faces = trimesh->getIndicesVertexes();
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            double x = 2.0 * i / n - 1;
+            double y = 2.0 * j / n - 1;
+            vertices.push_back(ChVector<>(x, y, 0.1 + 0.08 * std::sin(3 * x) * std::cos(3 * y)));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v = i * (n + 1) + j;
+            faces.push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            faces.push_back(ChVector<int>(v, v + n + 2, v + 1));
+        }
+    }
+
+    std::shared_ptr<ChBody> terrain(sys->NewBody());
+    terrain->SetBodyFixed(true);
+    terrain->SetCollide(true);
+    terrain->GetCollisionModel()->ClearModel();
+    terrain->GetCollisionModel()->AddTriangleMesh(mat, trimesh, true, false);
+    terrain->GetCollisionModel()->BuildModel();
+    sys->AddBody(terrain);
+
+    // Falling objects, cycling through the shape types
+    double mass = 1;
+    double size = 0.1;
+    srand(1);
+
+    int k = 0;
+    for (int ix = -2; ix < 3; ix++) {
+        for (int iy = -2; iy < 3; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                ChVector<> rnd(rand() % 1000 / 100000.0, rand() % 1000 / 100000.0, rand() % 1000 / 100000.0);
+                ChVector<> pos(0.35 * ix, 0.35 * iy, 0.35 * iz + 0.4);
+                double angle = rand() % 1000 / 1000.0 * CH_C_PI;
+                ChQuaternion<> rot = Q_from_AngAxis(angle, ChVector<>(1, 1, 0).GetNormalized());
+
+                std::shared_ptr<ChBody> body(sys->NewBody());
+                body->SetMass(mass);
+                body->SetInertiaXX(0.4 * mass * size * size * ChVector<>(1, 1, 1));
+                body->SetPos(pos + rnd);
+                body->SetRot(rot);
+                body->SetCollide(true);
+
+                body->GetCollisionModel()->ClearModel();
+                switch (k++ % 3) {
+                    case 0:
+                        utils::AddSphereGeometry(body.get(), mat, size);
+                        break;
+                    case 1:
+                        utils::AddBoxGeometry(body.get(), mat, ChVector<>(size, 0.8 * size, 0.6 * size));
+                        break;
+                    case 2:
+                        utils::AddCapsuleGeometry(body.get(), mat, 0.6 * size, size);
+                        break;
+                }
+                body->GetCollisionModel()->BuildModel();
+
+                sys->AddBody(body);
+            }
+        }
+    }
+}
+
+// Set the states of all bodies in system A to those in system B.
+void SyncStates(ChSystemParallel* msystem_A, ChSystemParallel* msystem_B) {
+    for (size_t i = 0; i < msystem_A->Get_bodylist().size(); i++) {
+        auto body_A = msystem_A->Get_bodylist()[i];
+        auto body_B = msystem_B->Get_bodylist()[i];
+        body_A->SetPos(body_B->GetPos());
+        body_A->SetRot(body_B->GetRot());
+        body_A->SetPos_dt(body_B->GetPos_dt());
+        body_A->SetWvel_par(body_B->GetWvel_par());
+    }
+}
+
+// Check that the contacts of the two systems match, regardless of their order. Contacts are identified by the pair of
+// bodies and the contact point on the first one; matching contacts must have the same normal and depth. A contact
+// missing in the other system is only accepted if it is at the detection threshold (2 x envelope).
+void CompareContactSets(ChSystemParallel* msystem_A, ChSystemParallel* msystem_B, double tolerance) {
+    const auto& data_A = msystem_A->data_manager->host_data;
+    const auto& data_B = msystem_B->data_manager->host_data;
+    uint num_contacts_A = msystem_A->data_manager->num_rigid_contacts;
+    uint num_contacts_B = msystem_B->data_manager->num_rigid_contacts;
+    double threshold = 2 * msystem_A->GetSettings()->collision.collision_envelope;
+
+    std::vector<bool> matched(num_contacts_B, false);
+    for (uint i = 0; i < num_contacts_A; i++) {
+        int match = -1;
+        for (uint j = 0; j < num_contacts_B; j++) {
+            if (matched[j] || data_B.bids_rigid_rigid[j].x != data_A.bids_rigid_rigid[i].x ||
+                data_B.bids_rigid_rigid[j].y != data_A.bids_rigid_rigid[i].y)
+                continue;
+            if (Length(data_B.cpta_rigid_rigid[j] - data_A.cpta_rigid_rigid[i]) < tolerance &&
+                Length(data_B.norm_rigid_rigid[j] - data_A.norm_rigid_rigid[i]) < tolerance &&
+                std::abs(data_B.dpth_rigid_rigid[j] - data_A.dpth_rigid_rigid[i]) < tolerance) {
+                match = j;
+                break;
+            }
+        }
+        if (match >= 0)
+            matched[match] = true;
+        else
+            ASSERT_NEAR(data_A.dpth_rigid_rigid[i], threshold, tolerance);
+    }
+    for (uint j = 0; j < num_contacts_B; j++) {
+        if (!matched[j])
+            ASSERT_NEAR(data_B.dpth_rigid_rigid[j], threshold, tolerance);
+    }
+}
+
+// The sorted narrowphase calls the same collision functions as the generic dispatch (only the sphere-sphere test is
+// inlined), so the contacts found from the same body states may only differ by round-off errors.
+TEST(ChronoParallel, sorted_narrowphase) {
+    ChSystemParallelNSC* msystem_d = new ChSystemParallelNSC();
+    ChSystemParallelNSC* msystem_s = new ChSystemParallelNSC();
+    CreateMixedScene(msystem_d);
+    CreateMixedScene(msystem_s);
+    msystem_s->GetSettings()->collision.use_sorted_narrowphase = true;
+
+    double time_step = 1e-3;
+    int num_steps = 500;
+    uint max_contacts = 0;
+    for (int step = 0; step < num_steps; step++) {
+        SyncStates(msystem_s, msystem_d);
+        msystem_d->DoStepDynamics(time_step);
+        msystem_s->DoStepDynamics(time_step);
+
+        ASSERT_NO_FATAL_FAILURE(CompareContactSets(msystem_d, msystem_s, 1e-10));
+        max_contacts = std::max(max_contacts, msystem_d->data_manager->num_rigid_contacts);
+    }
+
+    // All objects landed on the terrain or on each other
+    ASSERT_GT(max_contacts, (uint)msystem_d->Get_bodylist().size());
+
+    delete msystem_d;
+    delete msystem_s;
+}
+
+// -----------------------------------------------------------------------------
+
 int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+
     // No animation by default (i.e. when no program arguments)
     bool animate = (argc > 1);
 
@@ -269,7 +445,7 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    return 0;
+    return RUN_ALL_TESTS();
 }
 
 
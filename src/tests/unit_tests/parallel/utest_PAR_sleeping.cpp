@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// ChronoParallel unit test for sleeping islands.
+// Two separate stacks of boxes settle on the ground and go to sleep. A box is
+// then dropped on one of the stacks, which must wake up while the other stack
+// remains asleep.
+// =============================================================================
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+// Create a unit cube at the specified location.
+static std::shared_ptr<ChBody> CreateBox(ChSystemParallel& system,
+                                         std::shared_ptr<ChMaterialSurface> mat,
+                                         const ChVector<>& pos) {
+    double mass = 1;
+    auto box = std::shared_ptr<ChBody>(system.NewBody());
+    box->SetMass(mass);
+    box->SetInertiaXX(mass / 6 * ChVector<>(1, 1, 1));
+    box->SetPos(pos);
+    box->SetCollide(true);
+    box->SetSleepMinSpeed(0.05f);
+    box->SetSleepMinWvel(0.05f);
+    box->SetSleepTime(0.1f);
+
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(mat, 0.5, 0.5, 0.5);
+    box->GetCollisionModel()->BuildModel();
+
+    system.AddBody(box);
+    return box;
+}
+
+TEST(ChronoParallel, sleeping) {
+    ChSystemParallelNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetNumThreads(1);
+    system.SetUseSleeping(true);
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 100;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.GetSettings()->solver.tolerance = 1e-4;
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(mat, 10, 0.5, 10, ChVector<>(0, -0.5, 0));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    // Two stacks of boxes, far enough apart to form separate islands
+    std::vector<std::shared_ptr<ChBody>> stackA;
+    std::vector<std::shared_ptr<ChBody>> stackB;
+    for (int i = 0; i < 3; i++) {
+        stackA.push_back(CreateBox(system, mat, ChVector<>(-3, 0.5 + i * 1.0, 0)));
+        stackB.push_back(CreateBox(system, mat, ChVector<>(+3, 0.5 + i * 1.0, 0)));
+    }
+
+    // Let the stacks settle and fall asleep
+    double time_step = 1e-3;
+    while (system.GetChTime() < 1.0)
+        system.DoStepDynamics(time_step);
+
+    ASSERT_EQ(system.GetNumSleepingBodies(), 6u);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(stackA[i]->GetSleeping());
+        ASSERT_TRUE(stackB[i]->GetSleeping());
+    }
+
+    // Drop a box on the first stack
+    CreateBox(system, mat, ChVector<>(-3, 4.0, 0));
+    bool stackA_woken = false;
+    while (system.GetChTime() < 1.5) {
+        system.DoStepDynamics(time_step);
+        for (int i = 0; i < 3; i++) {
+            stackA_woken = stackA_woken || !stackA[i]->GetSleeping();
+            ASSERT_TRUE(stackB[i]->GetSleeping());
+        }
+    }
+
+    ASSERT_TRUE(stackA_woken);
+}
@@ -0,0 +1,186 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for binary checkpoint files.
+// A pile of spheres and a pendulum are simulated, checkpointed, and restored,
+// either into an empty system or in place into an identical system.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+static const char* checkpoint_file = "checkpoint_test.dat";
+
+// Create a pile of spheres (sharing the same material) on a fixed box, and a pendulum.
+static void CreateModel(ChSystemNSC& system) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetSolverMaxIterations(200);
+    std::static_pointer_cast<ChSolverPSOR>(system.GetSolver())->EnableWarmStart(true);
+
+    auto mat_ground = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat_ground->SetFriction(0.8f);
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.1f);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetIdentifier(-1);
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat_ground, ChVector<>(5, 0.5, 5), ChVector<>(0, -0.5, 0));
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    int id = 0;
+    for (int ix = 0; ix < 3; ix++) {
+        for (int iy = 0; iy < 3; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto ball = std::shared_ptr<ChBody>(system.NewBody());
+                ball->SetIdentifier(id++);
+                ball->SetMass(1);
+                ball->SetInertiaXX(ChVector<>(0.004, 0.004, 0.004));
+                ball->SetPos(ChVector<>(0.21 * ix - 0.2, 0.1 + 0.21 * iy, 0.21 * iz - 0.2));
+                ball->SetCollide(true);
+                ball->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(ball.get(), mat, 0.1);
+                ball->GetCollisionModel()->BuildModel();
+                system.AddBody(ball);
+            }
+        }
+    }
+
+    auto pend = std::shared_ptr<ChBody>(system.NewBody());
+    pend->SetIdentifier(100);
+    pend->SetMass(2);
+    pend->SetInertiaXX(ChVector<>(0.1, 0.1, 0.2));
+    pend->SetPos(ChVector<>(3, 2, 0));
+    system.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(2, 2, 0), QUNIT));
+    system.AddLink(rev);
+}
+
+TEST(ChCheckpoint, binary_create) {
+    ChSystemNSC system;
+    CreateModel(system);
+    for (int i = 0; i < 300; i++)
+        system.DoStepDynamics(1e-3);
+    ASSERT_TRUE(utils::WriteCheckpointBinary(&system, checkpoint_file));
+
+    ChSystemNSC restored;
+    ASSERT_TRUE(utils::ReadCheckpointBinary(&restored, checkpoint_file));
+
+    ASSERT_DOUBLE_EQ(restored.GetChTime(), system.GetChTime());
+    ASSERT_EQ(restored.Get_bodylist().size(), system.Get_bodylist().size());
+    for (size_t i = 0; i < system.Get_bodylist().size(); i++) {
+        auto body0 = system.Get_bodylist()[i];
+        auto body1 = restored.Get_bodylist()[i];
+        ASSERT_EQ(body1->GetIdentifier(), body0->GetIdentifier());
+        ASSERT_EQ(body1->GetBodyFixed(), body0->GetBodyFixed());
+        ASSERT_EQ(body1->GetCollide(), body0->GetCollide());
+        ASSERT_DOUBLE_EQ(body1->GetMass(), body0->GetMass());
+        ASSERT_TRUE(body1->GetInertiaXX().Equals(body0->GetInertiaXX()));
+        ASSERT_TRUE(body1->GetPos().Equals(body0->GetPos()));
+        ASSERT_TRUE(body1->GetRot().Equals(body0->GetRot()));
+        ASSERT_TRUE(body1->GetPos_dt().Equals(body0->GetPos_dt()));
+        ASSERT_TRUE(body1->GetRot_dt().Equals(body0->GetRot_dt()));
+
+        auto model0 = body0->GetCollisionModel();
+        auto model1 = body1->GetCollisionModel();
+        ASSERT_EQ(model1->GetNumShapes(), model0->GetNumShapes());
+        for (int j = 0; j < model0->GetNumShapes(); j++) {
+            ASSERT_EQ(model1->GetShape(j)->GetType(), model0->GetShape(j)->GetType());
+            auto dims0 = model0->GetShapeDimensions(j);
+            auto dims1 = model1->GetShapeDimensions(j);
+            ASSERT_EQ(dims1.size(), dims0.size());
+            for (size_t k = 0; k < dims0.size(); k++)
+                ASSERT_NEAR(dims1[k], dims0[k], 1e-6);
+            ASSERT_DOUBLE_EQ(model1->GetShape(j)->GetMaterial()->GetSfriction(),
+                             model0->GetShape(j)->GetMaterial()->GetSfriction());
+        }
+    }
+
+    // Materials shared in the original system are also shared in the restored one
+    auto mat1 = restored.Get_bodylist()[1]->GetCollisionModel()->GetShape(0)->GetMaterial();
+    auto mat2 = restored.Get_bodylist()[2]->GetCollisionModel()->GetShape(0)->GetMaterial();
+    ASSERT_EQ(mat1, mat2);
+
+    // The contact reactions are restored in the reaction cache
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(restored.GetContactContainer());
+    ASSERT_GT(system.GetNcontacts(), 0);
+    ASSERT_EQ((int)container->GetReactionCache().GetNumEntries(), system.GetNcontacts());
+
+    std::remove(checkpoint_file);
+}
+
+TEST(ChCheckpoint, binary_restart) {
+    ChSystemNSC system;
+    CreateModel(system);
+    for (int i = 0; i < 300; i++)
+        system.DoStepDynamics(1e-3);
+    ASSERT_TRUE(utils::WriteCheckpointBinary(&system, checkpoint_file));
+    ChVector<> react_force = system.Get_linklist()[0]->Get_react_force();
+
+    // Restore in place, into an identical model
+    ChSystemNSC restored;
+    CreateModel(restored);
+    ASSERT_TRUE(utils::ReadCheckpointBinary(&restored, checkpoint_file, false));
+    ASSERT_TRUE(restored.Get_linklist()[0]->Get_react_force().Equals(react_force, 1e-12));
+
+    // Continue both simulations
+    for (int i = 0; i < 100; i++) {
+        system.DoStepDynamics(1e-3);
+        restored.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_NEAR(restored.GetChTime(), system.GetChTime(), 1e-12);
+    for (size_t i = 0; i < system.Get_bodylist().size(); i++) {
+        auto pos0 = system.Get_bodylist()[i]->GetPos();
+        auto pos1 = restored.Get_bodylist()[i]->GetPos();
+        ASSERT_NEAR((pos1 - pos0).Length(), 0.0, 1e-4);
+    }
+
+    // An in-place restore requires the same number of bodies
+    ChSystemNSC empty;
+    ASSERT_FALSE(utils::ReadCheckpointBinary(&empty, checkpoint_file, false));
+
+    std::remove(checkpoint_file);
+}
+
+TEST(ChCheckpoint, binary_invalid) {
+    ChSystemNSC system;
+    CreateModel(system);
+    ASSERT_TRUE(utils::WriteCheckpoint(&system, checkpoint_file));
+
+    // A CSV checkpoint is rejected
+    ChSystemNSC restored;
+    ASSERT_FALSE(utils::ReadCheckpointBinary(&restored, checkpoint_file));
+    ASSERT_EQ(restored.Get_bodylist().size(), 0);
+
+    std::remove(checkpoint_file);
+}
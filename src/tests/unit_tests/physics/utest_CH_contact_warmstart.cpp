@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for warm starting of NSC contact reactions.
+// A set of touching sphere columns is allowed to settle, after which the number
+// of PSOR iterations needed to reach the solver tolerance is compared with and
+// without the contact reaction cache. Spheres are used since, unlike boxes, their
+// Bullet contact manifolds do not persist and provide no reactions of their own.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Simulate a pile of stacked spheres and return the average number of solver iterations over the last steps.
+static double AverageIterations(bool use_cache) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetSolverMaxIterations(1000);
+    system.SetSolverTolerance(1e-6);
+
+    auto solver = std::static_pointer_cast<ChSolverPSOR>(system.GetSolver());
+    solver->EnableWarmStart(true);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(system.GetContactContainer());
+    container->EnableReactionCache(use_cache);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    for (int ix = -1; ix <= 1; ix++) {
+        for (int iz = -1; iz <= 1; iz++) {
+            for (int iy = 0; iy < 5; iy++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                ball->SetPos(ChVector<>(1.0 * ix, 0.5 + iy * 1.0, 1.0 * iz));
+                system.AddBody(ball);
+            }
+        }
+    }
+
+    // Let the pile settle
+    for (int i = 0; i < 500; i++)
+        system.DoStepDynamics(1e-3);
+
+    // Collect solver iterations
+    int num_steps = 100;
+    double iterations = 0;
+    for (int i = 0; i < num_steps; i++) {
+        system.DoStepDynamics(1e-3);
+        iterations += solver->GetIterations();
+    }
+
+    return iterations / num_steps;
+}
+
+TEST(ChContactContainerNSC, warm_start) {
+    double iterations_nocache = AverageIterations(false);
+    double iterations_cache = AverageIterations(true);
+    std::cout << "Average PSOR iterations without cache: " << iterations_nocache << std::endl;
+    std::cout << "Average PSOR iterations with cache:    " << iterations_cache << std::endl;
+
+    ASSERT_LT(iterations_cache, iterations_nocache);
+}
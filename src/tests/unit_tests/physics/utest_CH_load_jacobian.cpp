@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the jacobians of body-body loads: the jacobians obtained by
+// automatic differentiation must match those obtained by numerical
+// differentiation.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChLoadsBody.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Create two moving bodies.
+static void CreateBodies(std::shared_ptr<ChBody>& bodyA, std::shared_ptr<ChBody>& bodyB) {
+    bodyA = chrono_types::make_shared<ChBody>();
+    bodyA->SetPos(ChVector<>(0.1, -0.2, 0.3));
+    bodyA->SetRot(Q_from_AngAxis(0.4, ChVector<>(1, 2, 3).GetNormalized()));
+    bodyA->SetPos_dt(ChVector<>(0.5, 0.1, -0.3));
+    bodyA->SetWvel_loc(ChVector<>(0.2, -0.7, 0.4));
+
+    bodyB = chrono_types::make_shared<ChBody>();
+    bodyB->SetPos(ChVector<>(1.1, 0.3, -0.2));
+    bodyB->SetRot(Q_from_AngAxis(-0.9, ChVector<>(-2, 1, 1).GetNormalized()));
+    bodyB->SetPos_dt(ChVector<>(-0.2, 0.4, 0.1));
+    bodyB->SetWvel_loc(ChVector<>(-0.3, 0.1, 0.6));
+}
+
+// Move body B, so that the bushing is deformed.
+static void DeformBushing(std::shared_ptr<ChBody> bodyB) {
+    bodyB->SetPos(bodyB->GetPos() + ChVector<>(0.02, -0.03, 0.01));
+    bodyB->SetRot(bodyB->GetRot() * Q_from_AngAxis(0.3, ChVector<>(1, -1, 2).GetNormalized()));
+}
+
+// Compare the jacobians computed by numerical and by automatic differentiation.
+static void CompareJacobians(std::shared_ptr<ChLoadBodyBody> load) {
+    load->SetAutomaticDifferentiation(false);
+    load->Update(0);
+    ChMatrixDynamic<> K_num = load->GetJacobians()->K;
+    ChMatrixDynamic<> R_num = load->GetJacobians()->R;
+
+    load->SetAutomaticDifferentiation(true);
+    load->Update(0);
+    ChMatrixDynamic<> K_ad = load->GetJacobians()->K;
+    ChMatrixDynamic<> R_ad = load->GetJacobians()->R;
+
+    // Numerical differentiation (with a 1e-8 perturbation) is accurate to about 1e-6 relative to the entries
+    double tol_K = 1e-5 * std::max(1.0, K_ad.cwiseAbs().maxCoeff());
+    double tol_R = 1e-5 * std::max(1.0, R_ad.cwiseAbs().maxCoeff());
+    for (int i = 0; i < 12; i++) {
+        for (int j = 0; j < 12; j++) {
+            ASSERT_NEAR(K_ad(i, j), K_num(i, j), tol_K) << "K(" << i << "," << j << ")";
+            ASSERT_NEAR(R_ad(i, j), R_num(i, j), tol_R) << "R(" << i << "," << j << ")";
+        }
+    }
+}
+
+// ====================================================================================
+
+TEST(ChLoadBodyBody, jacobian_spherical) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    CreateBodies(bodyA, bodyB);
+    auto load = chrono_types::make_shared<ChLoadBodyBodyBushingSpherical>(
+        bodyA, bodyB, ChFrame<>(ChVector<>(0.5, 0, 0), Q_from_AngZ(0.3)), ChVector<>(1000, 2000, 3000),
+        ChVector<>(10, 20, 30));
+
+    CompareJacobians(load);
+    DeformBushing(bodyB);
+    CompareJacobians(load);
+}
+
+TEST(ChLoadBodyBody, jacobian_mate) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    CreateBodies(bodyA, bodyB);
+    auto load = chrono_types::make_shared<ChLoadBodyBodyBushingMate>(
+        bodyA, bodyB, ChFrame<>(ChVector<>(0.5, 0, 0), Q_from_AngZ(0.3)), ChVector<>(1000, 2000, 3000),
+        ChVector<>(10, 20, 30), ChVector<>(400, 500, 600), ChVector<>(4, 5, 6));
+
+    // Null relative rotation
+    CompareJacobians(load);
+    DeformBushing(bodyB);
+    CompareJacobians(load);
+}
+
+TEST(ChLoadBodyBody, jacobian_generic) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    CreateBodies(bodyA, bodyB);
+
+    ChMatrixNM<double, 6, 6> K;
+    ChMatrixNM<double, 6, 6> R;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            K(i, j) = (i == j) ? 1000.0 * (i + 1) : 50.0 * (i + j);
+            R(i, j) = (i == j) ? 10.0 * (i + 1) : 0.5 * (i + j);
+        }
+    }
+    auto load = chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(
+        bodyA, bodyB, ChFrame<>(ChVector<>(0.5, 0, 0), Q_from_AngZ(0.3)), K, R);
+    load->NeutralDisplacement() = ChFrame<>(ChVector<>(0.01, 0, -0.02), Q_from_AngX(0.1));
+
+    CompareJacobians(load);
+    DeformBushing(bodyB);
+    CompareJacobians(load);
+}
@@ -0,0 +1,152 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the multithreaded (graph-colored) PSOR solver.
+// - check that the constraint coloring produces non-conflicting colors
+// - check that the multithreaded solver is independent of the number of threads
+// - check that the multithreaded and sequential solvers produce similar results
+//
+// =============================================================================
+
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChConstraintColoring.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Create a system with columns of stacked boxes resting on a fixed ground.
+// If num_threads > 0, use the multithreaded PSOR solver.
+static std::shared_ptr<ChSystemNSC> CreateSystem(int num_threads) {
+    auto system = chrono_types::make_shared<ChSystemNSC>();
+    system->Set_G_acc(ChVector<>(0, -9.81, 0));
+    system->SetSolverMaxIterations(50);
+
+    if (num_threads > 0) {
+        system->SetNumThreads(num_threads, 1, 1);
+        auto solver = std::static_pointer_cast<ChSolverPSOR>(system->GetSolver());
+        solver->EnableMultithreading(true);
+    } else {
+        system->SetNumThreads(1, 1, 1);
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system->AddBody(ground);
+
+    for (int ix = -1; ix <= 1; ix++) {
+        for (int iz = -1; iz <= 1; iz++) {
+            for (int iy = 0; iy < 3; iy++) {
+                auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+                box->SetPos(ChVector<>(1.5 * ix, 0.5 + iy * 1.0, 1.5 * iz));
+                system->AddBody(box);
+            }
+        }
+    }
+
+    return system;
+}
+
+static void Simulate(ChSystemNSC& system, int num_steps) {
+    for (int i = 0; i < num_steps; i++)
+        system.DoStepDynamics(1e-3);
+}
+
+// ====================================================================================
+
+TEST(ChSolverPSOR, coloring) {
+    auto system = CreateSystem(4);
+    Simulate(*system, 20);
+
+    auto& sysd = *system->GetSystemDescriptor();
+    auto& constraints = sysd.GetConstraintsList();
+    ASSERT_GT(system->GetNcontacts(), 0);
+
+    ChConstraintColoring coloring;
+    coloring.Update(sysd);
+
+    // Blocks of a given color must not share active variables
+    const auto& blocks = coloring.GetBlocks();
+    for (int color = 0; color < coloring.GetNumColors(); color++) {
+        std::set<ChVariables*> color_vars;
+        for (unsigned int ib = coloring.GetColorStart(color); ib < coloring.GetColorEnd(color); ib++) {
+            std::set<ChVariables*> block_vars;
+            for (unsigned int k = 0; k < blocks[ib].size; k++) {
+                std::vector<ChVariables*> vars;
+                ASSERT_TRUE(constraints[blocks[ib].start + k]->CollectVariables(vars));
+                for (auto var : vars) {
+                    if (var->IsActive())
+                        block_vars.insert(var);
+                }
+            }
+            for (auto var : block_vars) {
+                ASSERT_TRUE(color_vars.insert(var).second);
+            }
+        }
+    }
+
+    // All active constraints must be covered exactly once
+    std::vector<int> count(constraints.size(), 0);
+    for (const auto& block : blocks) {
+        for (unsigned int k = 0; k < block.size; k++)
+            count[block.start + k]++;
+    }
+    for (const auto& block : coloring.GetSequentialBlocks()) {
+        for (unsigned int k = 0; k < block.size; k++)
+            count[block.start + k]++;
+    }
+    for (size_t ic = 0; ic < constraints.size(); ic++) {
+        ASSERT_EQ(count[ic], constraints[ic]->IsActive() ? 1 : 0);
+    }
+}
+
+TEST(ChSolverPSOR, thread_independence) {
+    auto system1 = CreateSystem(1);
+    auto system4 = CreateSystem(4);
+    Simulate(*system1, 100);
+    Simulate(*system4, 100);
+
+    auto& bodies1 = system1->Get_bodylist();
+    auto& bodies4 = system4->Get_bodylist();
+    ASSERT_EQ(bodies1.size(), bodies4.size());
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_DOUBLE_EQ(bodies1[i]->GetPos().x(), bodies4[i]->GetPos().x());
+        ASSERT_DOUBLE_EQ(bodies1[i]->GetPos().y(), bodies4[i]->GetPos().y());
+        ASSERT_DOUBLE_EQ(bodies1[i]->GetPos().z(), bodies4[i]->GetPos().z());
+    }
+}
+
+TEST(ChSolverPSOR, sequential_vs_multithreaded) {
+    auto system_seq = CreateSystem(0);
+    auto system_mt = CreateSystem(4);
+    Simulate(*system_seq, 100);
+    Simulate(*system_mt, 100);
+
+    auto& bodies_seq = system_seq->Get_bodylist();
+    auto& bodies_mt = system_mt->Get_bodylist();
+    ASSERT_EQ(bodies_seq.size(), bodies_mt.size());
+    for (size_t i = 0; i < bodies_seq.size(); i++) {
+        ASSERT_NEAR(bodies_seq[i]->GetPos().x(), bodies_mt[i]->GetPos().x(), 1e-3);
+        ASSERT_NEAR(bodies_seq[i]->GetPos().y(), bodies_mt[i]->GetPos().y(), 1e-3);
+        ASSERT_NEAR(bodies_seq[i]->GetPos().z(), bodies_mt[i]->GetPos().z(), 1e-3);
+    }
+}
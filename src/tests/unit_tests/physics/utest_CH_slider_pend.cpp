@@ -43,6 +43,7 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChLinkLock.h"
 #include "chrono/physics/ChLinkMate.h"
+#include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 #include "chrono/utils/ChUtilsValidation.h"
 
@@ -385,6 +386,60 @@ bool test_HHT(double step, int num_steps, const utils::Data& ref_data, double to
     return check_state && check_cnstr;
 }
 
+template <typename ChronoModelType>
+bool test_REUSE(ChTimestepper::Type type,
+                double step,
+                int num_steps,
+                const utils::Data& ref_data,
+                double tol_state,
+                double tol_cnstr) {
+    // Create Chrono model.
+    ChronoModelType model;
+    std::shared_ptr<ChSystemNSC> system = model.GetSystem();
+
+    std::cout << "Newton matrix reuse *** " << (type == ChTimestepper::Type::HHT ? "HHT" : "EULER_IMPLICIT")
+              << " *** " << model.GetJointType() << std::endl;
+
+    // Use a direct sparse solver, so that the Newton matrix factorization is actually reused.
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    system->SetSolver(solver);
+
+    // Set integrator and enable reuse of the Newton matrix across steps.
+    system->SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(system->GetTimestepper());
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetJacobianReuse(true);
+    if (type == ChTimestepper::Type::HHT)
+        std::static_pointer_cast<ChTimestepperHHT>(system->GetTimestepper())->SetAlpha(-0.2);
+
+    // Simulate the model for the specified number of steps.
+    model.Simulate(step, num_steps);
+
+    // Check that the Newton matrix was not re-evaluated at every step.
+    bool check_setup = solver->GetNumSetupCalls() < num_steps / 2;
+    std::cout << "  Setup calls: " << solver->GetNumSetupCalls() << "  Solve calls: " << solver->GetNumSolveCalls()
+              << "  " << (check_setup ? "Passed" : "Failed") << std::endl;
+
+    // Validate states (x and y for pendulum body).
+    utils::DataVector norms_state;
+    bool check_state = utils::Validate(model.GetData(), ref_data, utils::RMS_NORM, tol_state, norms_state);
+    std::cout << "  validate states: " << (check_state ? "Passed" : "Failed") << "  (tolerance = " << tol_state
+              << ")" << std::endl;
+    for (size_t col = 0; col < norms_state.size(); col++)
+        std::cout << "    " << norms_state[col] << std::endl;
+
+    // Validate constraint violations.
+    utils::DataVector norms_cnstr;
+    bool check_cnstr = utils::Validate(model.GetCnstrData(), utils::RMS_NORM, tol_cnstr, norms_cnstr);
+    std::cout << "  validate constraints: " << (check_cnstr ? "Passed" : "Failed") << "  (tolerance = " << tol_cnstr
+              << ")" << std::endl;
+    for (size_t col = 0; col < norms_cnstr.size(); col++)
+        std::cout << "    " << norms_cnstr[col] << std::endl;
+
+    return check_setup && check_state && check_cnstr;
+}
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -409,6 +464,15 @@ int main(int argc, char* argv[]) {
     passed &= test_EULER<ChronoModelM>(step, num_steps, ref_data, tol_state, tol_cnstr);
     passed &= test_HHT<ChronoModelL>(step, num_steps, ref_data, tol_state, tol_cnstr);
     passed &= test_HHT<ChronoModelM>(step, num_steps, ref_data, tol_state, tol_cnstr);
+    passed &= test_REUSE<ChronoModelL>(ChTimestepper::Type::HHT, step, num_steps, ref_data, tol_state, tol_cnstr);
+    passed &= test_REUSE<ChronoModelM>(ChTimestepper::Type::HHT, step, num_steps, ref_data, tol_state, tol_cnstr);
+    // Fully implicit Euler is first order and dissipative; with or without Newton matrix reuse, its states differ from
+    // the ODE solution by about 4e-3.
+    double tol_state_euler = 5e-3;
+    passed &= test_REUSE<ChronoModelL>(ChTimestepper::Type::EULER_IMPLICIT, step, num_steps, ref_data, tol_state_euler,
+                                       tol_cnstr);
+    passed &= test_REUSE<ChronoModelM>(ChTimestepper::Type::EULER_IMPLICIT, step, num_steps, ref_data, tol_state_euler,
+                                       tol_cnstr);
 
     // Return 0 if all tests passed.
     return !passed;
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the vehicle batch runner: every sample must be run to
+// completion exactly once, errors in a sample must be reported after all
+// other samples completed, and JSON files must be shared by all samples.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChTypes.h"
+
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleBatch.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// ====================================================================================
+
+// Sample which takes a given number of steps, optionally throwing at the last one, and optionally reads a value from
+// a JSON file when constructed.
+class TestSample : public ChVehicleBatch::Sample {
+  public:
+    TestSample(int num_steps, bool fail = false, const std::string& filename = "")
+        : m_num_steps(num_steps), m_fail(fail), m_filename(filename) {}
+
+    virtual void Construct() override {
+        m_num_constructed++;
+        m_step = 0;
+        if (!m_filename.empty()) {
+            rapidjson::Document d = ReadFileJSON(m_filename);
+            m_value = d["Value"].GetInt();
+        }
+    }
+
+    virtual bool Advance() override {
+        m_step++;
+        if (m_fail && m_step == m_num_steps)
+            throw std::runtime_error("sample error");
+        return m_step < m_num_steps;
+    }
+
+    virtual void Destroy() override {
+        m_num_destroyed++;
+        m_steps_taken = m_step;
+    }
+
+    int m_num_steps;
+    bool m_fail;
+    std::string m_filename;
+
+    int m_step = 0;
+    int m_num_constructed = 0;
+    int m_num_destroyed = 0;
+    int m_steps_taken = 0;
+    int m_value = 0;
+};
+
+// ====================================================================================
+
+TEST(ChVehicleBatch, run) {
+    ChVehicleBatch batch(4);
+    std::vector<std::shared_ptr<TestSample>> samples;
+    long long num_steps = 0;
+    for (int i = 0; i < 50; i++) {
+        // Unbalanced samples, so that workers steal samples from each other
+        int n = (i % 4 == 0) ? 2000 : 1 + i;
+        samples.push_back(chrono_types::make_shared<TestSample>(n));
+        batch.AddSample(samples.back());
+        num_steps += n;
+    }
+    ASSERT_EQ(batch.GetNumSamples(), samples.size());
+
+    batch.Run();
+
+    ASSERT_EQ(batch.GetNumSteps(), num_steps);
+    for (const auto& sample : samples) {
+        ASSERT_EQ(sample->m_num_constructed, 1);
+        ASSERT_EQ(sample->m_num_destroyed, 1);
+        ASSERT_EQ(sample->m_steps_taken, sample->m_num_steps);
+    }
+}
+
+TEST(ChVehicleBatch, error) {
+    ChVehicleBatch batch(3);
+    std::vector<std::shared_ptr<TestSample>> samples;
+    for (int i = 0; i < 12; i++) {
+        samples.push_back(chrono_types::make_shared<TestSample>(10 + i, i == 4));
+        batch.AddSample(samples.back());
+    }
+
+    ASSERT_THROW(batch.Run(), std::runtime_error);
+
+    // All other samples are completed
+    for (int i = 0; i < 12; i++) {
+        ASSERT_EQ(samples[i]->m_num_constructed, 1);
+        ASSERT_EQ(samples[i]->m_num_destroyed, i == 4 ? 0 : 1);
+    }
+}
+
+TEST(ChVehicleBatch, json_cache) {
+    std::string filename = "utest_VEH_batch.json";
+    {
+        std::ofstream ofs(filename);
+        ofs << "{\n  // test file\n  \"Value\": 42\n}\n";
+    }
+
+    ChVehicleBatch batch(4);
+    std::vector<std::shared_ptr<TestSample>> samples;
+    for (int i = 0; i < 20; i++) {
+        samples.push_back(chrono_types::make_shared<TestSample>(5, false, filename));
+        batch.AddSample(samples.back());
+    }
+
+    EnableCacheJSON(false);
+    batch.Run();
+
+    // Caching is only enabled while the batch runs
+    ASSERT_FALSE(IsCacheJSONEnabled());
+    for (const auto& sample : samples)
+        ASSERT_EQ(sample->m_value, 42);
+
+    std::remove(filename.c_str());
+}
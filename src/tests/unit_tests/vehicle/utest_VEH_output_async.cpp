@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the asynchronous vehicle output database: frames must reach
+// the wrapped database in order, and an exception thrown by the wrapped
+// database on the writer thread must be reported to the caller.
+//
+// =============================================================================
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// ====================================================================================
+
+// Output database which records the frames it serializes and throws when asked to write a given frame.
+class TestOutput : public ChVehicleOutput {
+  public:
+    TestOutput(std::vector<int>& frames, int fail_frame) : m_frames(frames), m_fail_frame(fail_frame) {}
+
+    virtual void WriteFrame(const Frame& frame) override {
+        if (frame.frame == m_fail_frame)
+            throw std::runtime_error("write error");
+        m_frames.push_back(frame.frame);
+    }
+
+  private:
+    std::vector<int>& m_frames;
+    int m_fail_frame;
+};
+
+// Queue a complete output frame.
+static void AddFrame(ChVehicleOutput& output, int frame) {
+    output.WriteTime(frame, 0.01 * frame);
+    output.EndFrame();
+}
+
+// ====================================================================================
+
+TEST(ChVehicleOutputAsync, frame_order) {
+    std::vector<int> frames;
+    ChVehicleOutputAsync output(std::unique_ptr<ChVehicleOutput>(new TestOutput(frames, -1)), 2);
+
+    int num_frames = 100;
+    for (int i = 0; i < num_frames; i++)
+        AddFrame(output, i);
+    output.Flush();
+
+    ASSERT_EQ(frames.size(), (size_t)num_frames);
+    for (int i = 0; i < num_frames; i++)
+        ASSERT_EQ(frames[i], i);
+}
+
+TEST(ChVehicleOutputAsync, error_in_flush) {
+    std::vector<int> frames;
+    ChVehicleOutputAsync output(std::unique_ptr<ChVehicleOutput>(new TestOutput(frames, 2)), 4);
+
+    // The last frame fails, so the error can only be reported once the writer is done
+    for (int i = 0; i <= 2; i++)
+        AddFrame(output, i);
+    ASSERT_THROW(output.Flush(), std::runtime_error);
+    ASSERT_EQ(frames.size(), 2u);
+
+    // The error is reported again for any further frame, which is discarded
+    ASSERT_THROW(AddFrame(output, 3), std::runtime_error);
+    ASSERT_THROW(output.Flush(), std::runtime_error);
+    ASSERT_EQ(frames.size(), 2u);
+}
+
+TEST(ChVehicleOutputAsync, error_in_write) {
+    std::vector<int> frames;
+    ChVehicleOutputAsync output(std::unique_ptr<ChVehicleOutput>(new TestOutput(frames, 5)), 2);
+
+    // The error is reported when queueing one of the frames following the failed one
+    int num_thrown = 0;
+    for (int i = 0; i < 100; i++) {
+        try {
+            AddFrame(output, i);
+        } catch (const std::runtime_error&) {
+            ASSERT_GT(i, 5);
+            num_thrown++;
+        }
+    }
+    ASSERT_THROW(output.Flush(), std::runtime_error);
+    ASSERT_GT(num_thrown, 0);
+
+    // Frames queued after the failed one are discarded
+    ASSERT_EQ(frames.size(), 5u);
+    for (int i = 0; i < 5; i++)
+        ASSERT_EQ(frames[i], i);
+}
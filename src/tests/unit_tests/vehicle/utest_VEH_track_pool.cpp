@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the pooled connection mode of tracked vehicles: an M113 whose
+// track shoe connections are evaluated by a ChTrackConnectionPool must follow
+// the same motion as one using individual force elements.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_models/vehicle/m113/M113_SimplePowertrain.h"
+#include "chrono_models/vehicle/m113/M113_Vehicle.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::m113;
+
+// ====================================================================================
+
+// M113 vehicle on flat rigid terrain, accelerating with constant throttle.
+class M113Model {
+  public:
+    M113Model(TrackShoeType shoe_type, bool pooled) {
+        m_m113 = new M113_Vehicle(false, shoe_type, BrakeType::SIMPLE, ChContactMethod::NSC, CollisionType::NONE);
+        m_m113->GetTrackAssembly(LEFT)->UseConnectionPool(pooled);
+        m_m113->GetTrackAssembly(RIGHT)->UseConnectionPool(pooled);
+        m_m113->Initialize(ChCoordsys<>(ChVector<>(0, 0, 0.9), QUNIT));
+        m_m113->InitializePowertrain(chrono_types::make_shared<M113_SimplePowertrain>("Powertrain"));
+
+        auto solver = chrono_types::make_shared<ChSolverPSOR>();
+        solver->SetMaxIterations(50);
+        solver->SetOmega(0.8);
+        solver->SetSharpnessLambda(1.0);
+        m_m113->GetSystem()->SetSolver(solver);
+        m_m113->GetSystem()->SetMaxPenetrationRecoverySpeed(1.5);
+        m_m113->GetSystem()->SetMinBounceSpeed(2.0);
+
+        m_terrain = new RigidTerrain(m_m113->GetSystem());
+        auto patch_material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        patch_material->SetFriction(0.9f);
+        patch_material->SetRestitution(0.01f);
+        m_terrain->AddPatch(patch_material, ChVector<>(0, 0, 0), ChVector<>(0, 0, 1), 50, 10, 1, false, 1, false);
+        m_terrain->Initialize();
+
+        m_shoeL.resize(m_m113->GetNumTrackShoes(LEFT));
+        m_shoeR.resize(m_m113->GetNumTrackShoes(RIGHT));
+    }
+
+    ~M113Model() {
+        delete m_terrain;
+        delete m_m113;
+    }
+
+    void Advance(double step) {
+        double time = m_m113->GetChTime();
+        ChDriver::Inputs driver_inputs = {0, time < 0.2 ? 0.0 : 0.5, 0};
+        m_terrain->Synchronize(time);
+        m_m113->Synchronize(time, driver_inputs, m_shoeL, m_shoeR);
+        m_terrain->Advance(step);
+        m_m113->Advance(step);
+    }
+
+    M113_Vehicle* m_m113;
+    RigidTerrain* m_terrain;
+    TerrainForces m_shoeL;
+    TerrainForces m_shoeR;
+};
+
+// Simulate the vehicle with and without the connection pool and compare the track shoe states.
+void CompareTracks(TrackShoeType shoe_type) {
+    M113Model model_I(shoe_type, false);
+    M113Model model_P(shoe_type, true);
+
+    ASSERT_FALSE(model_I.m_m113->GetTrackAssembly(LEFT)->GetConnectionPool());
+    ASSERT_TRUE(model_P.m_m113->GetTrackAssembly(LEFT)->GetConnectionPool());
+    ASSERT_TRUE(model_P.m_m113->GetTrackAssembly(RIGHT)->GetConnectionPool());
+
+    double step = 1e-3;
+    int num_steps = 500;
+    for (int i = 0; i < num_steps; i++) {
+        model_I.Advance(step);
+        model_P.Advance(step);
+    }
+
+    // The vehicle started moving
+    ASSERT_GT(model_P.m_m113->GetVehicleSpeed(), 0.1);
+
+    // Both models only differ by the summation order of the connection forces
+    double tol_pos = 1e-4;
+    double tol_vel = 1e-3;
+    for (auto side : {LEFT, RIGHT}) {
+        BodyStates states_I(model_I.m_m113->GetNumTrackShoes(side));
+        BodyStates states_P(model_P.m_m113->GetNumTrackShoes(side));
+        model_I.m_m113->GetTrackShoeStates(side, states_I);
+        model_P.m_m113->GetTrackShoeStates(side, states_P);
+        ASSERT_EQ(states_I.size(), states_P.size());
+        for (size_t i = 0; i < states_I.size(); i++) {
+            ASSERT_NEAR((states_I[i].pos - states_P[i].pos).Length(), 0, tol_pos);
+            ASSERT_NEAR((states_I[i].lin_vel - states_P[i].lin_vel).Length(), 0, tol_vel);
+        }
+    }
+}
+
+// ====================================================================================
+
+TEST(ChTrackConnectionPool, single_pin) {
+    CompareTracks(TrackShoeType::SINGLE_PIN);
+}
+
+TEST(ChTrackConnectionPool, double_pin) {
+    CompareTracks(TrackShoeType::DOUBLE_PIN);
+}
+
+TEST(ChTrackConnectionPool, band_bushing) {
+    CompareTracks(TrackShoeType::BAND_BUSHING);
+}